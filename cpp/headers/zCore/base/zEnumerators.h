@@ -125,7 +125,7 @@ namespace zSpace
 	*	\brief	input and ouput file types.
 	*	\since	version 0.0.2
 	*/
-	enum zFileTpye { zJSON = 150, zUSD, zOBJ, zTXT,zMAYATXT, zCSV, zBMP, zPNG, zJPEG, zMESH , zGRAPH};
+	enum zFileTpye { zJSON = 150, zUSD, zOBJ, zTXT,zMAYATXT, zCSV, zBMP, zPNG, zJPEG, zMESH , zGRAPH, zPLY, zPLYASCII, zXYZ, zFIELD};
 
 	/*! \enum	zFnType
 	*	\brief	functionset types.
@@ -199,6 +199,36 @@ namespace zSpace
 	*/
 	enum zFieldColorType { zFieldRegular = 290, zFieldSDF, zFieldSlime };
 
+	/*! \enum	zBinaryBlockType
+	*	\brief	block types of the binary zMESH, zGRAPH, zXYZ and point cloud store index file formats. The values are stored in the files and must not be changed.
+	*	\since	version 0.0.4
+	*/
+	enum zBinaryBlockType { zBinVertices = 300, zBinHalfEdges, zBinFaces, zBinVertexPositions, zBinVertexPositionsQuantized, zBinPositionDomain, zBinVertexNormals, zBinVertexColors, zBinVertexWeights, zBinEdgeColors, zBinEdgeWeights, zBinFaceNormals, zBinFaceColors, zBinVertexColorsRGB8, zBinStoreNodes, zBinStoreInfo };
+
+	/*! \enum	zPlyFormat
+	*	\brief	body formats of the PLY file format.
+	*	\since	version 0.0.4
+	*/
+	enum zPlyFormat { zPlyASCII = 320, zPlyBinaryLittleEndian, zPlyBinaryBigEndian };
+
+	/*! \enum	zPlyDataType
+	*	\brief	property data types of the PLY file format.
+	*	\since	version 0.0.4
+	*/
+	enum zPlyDataType { zPlyInt8 = 330, zPlyUInt8, zPlyInt16, zPlyUInt16, zPlyInt32, zPlyUInt32, zPlyFloat32, zPlyFloat64 };
+
+	/*! \enum	zFieldPrecision
+	*	\brief	value precisions of the binary zFIELD file format. The values are stored in the files and must not be changed.
+	*	\since	version 0.0.4
+	*/
+	enum zFieldPrecision { zFieldFloat32 = 340, zFieldFloat16 };
+
+	/*! \enum	zFieldExpressionType
+	*	\brief	node types of the field expression.
+	*	\since	version 0.0.4
+	*/
+	enum zFieldExpressionType { zExprCircle = 350, zExprLine, zExprPolygon, zExprGraphDistance, zExprUnion, zExprSubtract, zExprIntersect, zExprSmoothUnion, zExprClipPlane, zExprTransform };
+
 
 	/** @}*/
 
@@ -17,7 +17,11 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>    // std::sort
+#include <map>
+#include <functional>
+#include <climits>
 using namespace std;
 
 #include<depends/SQLITE/sqlite3.h>
@@ -34,6 +38,241 @@ namespace  zSpace
 	*  @{
 	*/
 
+	/** \addtogroup zData
+	*	\brief The data classes and structs of the library.
+	*  @{
+	*/
+
+	class zDatabase;
+
+	/*! \struct zBlobView
+	*	\brief A non owning view of the bytes of a blob column.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zBlobView
+	{
+		/*!	\brief blob data, nullptr if the blob is empty or NULL.  */
+		const unsigned char* data;
+
+		/*!	\brief blob size in bytes.  */
+		int size;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zData
+	*	\brief The data classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zDatabaseCursor
+	*	\brief A forward cursor over the rows of a prepared statement. Rows are stepped one at a time and the columns are read straight from the statement, so queries of any size run in constant memory.
+	*	\details Text and blob views stay valid until the cursor is stepped or reset. The statement is owned by the database and reset when the cursor is destroyed. Closing the database or clearing its statements detaches the live cursors, which then have no rows.
+	*	Cursors are move only, so a statement is never reset by another cursor.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zDatabaseCursor
+	{
+	private:
+		//--------------------------
+		//---- PRIVATE ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief statement stepped by the cursor  */
+		sqlite3_stmt * stmt;
+
+		/*!	\brief result code of the last step  */
+		int RC;
+
+		/*!	\brief database the statement was queried from, which detaches the cursor when it finalizes the statement. nullptr for a statement set by the caller  */
+		zDatabase *owner;
+
+		friend class zDatabase;
+
+		//--------------------------
+		//---- PRIVATE METHODS
+		//--------------------------
+
+		/*! \brief This method detaches the cursor from the database it was queried from.
+		*
+		*	\since version 0.0.4
+		*/
+		void detach();
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor();
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_stmt			- prepared statement with its parameters bound.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor(sqlite3_stmt* _stmt);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. The statement is reset.
+		*
+		*	\since version 0.0.4
+		*/
+		~zDatabaseCursor();
+
+		zDatabaseCursor(const zDatabaseCursor&) = delete;
+
+		zDatabaseCursor& operator=(const zDatabaseCursor&) = delete;
+
+		/*! \brief Move constructor. The input cursor is left without a statement.
+		*
+		*	\param		[in]	other			- input cursor.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor(zDatabaseCursor &&other);
+
+		/*! \brief Move assignment operator. The statement of this cursor is reset and the input cursor is left without a statement.
+		*
+		*	\param		[in]	other			- input cursor.
+		*	\since version 0.0.4
+		*/
+		zDatabaseCursor& operator=(zDatabaseCursor &&other);
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method sets the statement of the cursor, resetting the previous one.
+		*
+		*	\param		[in]	_stmt			- prepared statement with its parameters bound.
+		*	\since version 0.0.4
+		*/
+		void setStatement(sqlite3_stmt* _stmt);
+
+		/*! \brief This method returns the statement of the cursor.
+		*
+		*	\return				sqlite3_stmt*	- statement of the cursor.
+		*	\since version 0.0.4
+		*/
+		sqlite3_stmt* getStatement();
+
+		/*! \brief This method steps the cursor to the next row.
+		*
+		*	\return				bool			- true if the cursor is on a row, false at the end of the rows or on error.
+		*	\since version 0.0.4
+		*/
+		bool next();
+
+		/*! \brief This method resets the cursor to before the first row. The parameter bindings are kept.
+		*
+		*	\since version 0.0.4
+		*/
+		void reset();
+
+		/*! \brief This method checks if the last step failed.
+		*
+		*	\return				bool			- true if the last step returned an error, else false.
+		*	\since version 0.0.4
+		*/
+		bool hasError();
+
+		/*! \brief This method returns the number of columns of the result.
+		*
+		*	\return				int				- number of columns.
+		*	\since version 0.0.4
+		*/
+		int numColumns();
+
+		/*! \brief This method returns the name of a column of the result.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				const char*		- column name.
+		*	\since version 0.0.4
+		*/
+		const char* getColumnName(int col);
+
+		/*! \brief This method returns the SQLite storage class of a column in the current row.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				int				- SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT, SQLITE_BLOB or SQLITE_NULL.
+		*	\since version 0.0.4
+		*/
+		int getColumnType(int col);
+
+		/*! \brief This method checks if a column in the current row is NULL.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				bool			- true if the value is NULL, else false.
+		*	\since version 0.0.4
+		*/
+		bool isNull(int col);
+
+		/*! \brief This method returns a column in the current row as an integer.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				int64_t			- column value.
+		*	\since version 0.0.4
+		*/
+		int64_t getInteger(int col);
+
+		/*! \brief This method returns a column in the current row as a double.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				double			- column value.
+		*	\since version 0.0.4
+		*/
+		double getDouble(int col);
+
+		/*! \brief This method returns a view of a column in the current row as text, without copying.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				string_view		- column text, empty if the value is NULL.
+		*	\since version 0.0.4
+		*/
+		string_view getText(int col);
+
+		/*! \brief This method returns a column in the current row as a string.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				string			- column value, empty if the value is NULL.
+		*	\since version 0.0.4
+		*/
+		string getString(int col);
+
+		/*! \brief This method returns a view of a column in the current row as a blob, without copying.
+		*
+		*	\param		[in]	col				- column index, starting at 0.
+		*	\return				zBlobView		- view of the blob bytes.
+		*	\since version 0.0.4
+		*/
+		zBlobView getBlob(int col);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
 	/** \addtogroup zData
 	*	\brief The data classes and structs of the library.
 	*  @{
@@ -41,6 +280,8 @@ namespace  zSpace
 
 	/*! \class zDatabase
 	*	\brief A database class for accessing a SQL database using SQLite library.
+	*	\details Prepared statements are cached by their SQL text and reused, so repeated inserts only bind new values. Inserts executed inside a transaction started with a batch size are committed every batch size rows.
+	*	Geometry tables store binary geometry blobs keyed by id, with bounding box columns to select the geometry in a region before any blob is loaded. Blobs can be read in part with incremental blob I/O.
 	*	\since version 0.0.1
 	*/
 
@@ -58,6 +299,23 @@ namespace  zSpace
 		/*!	\brief SQL database  */
 		sqlite3 * database;
 
+		/*!	\brief cache of prepared statements, keyed by their SQL text. A SQL text has more than one statement when it was queried again while its statements were in use  */
+		map<string, vector<sqlite3_stmt*>> statements;
+
+		/*!	\brief live cursors on cached statements  */
+		vector<zDatabaseCursor*> cursors;
+
+		friend class zDatabaseCursor;
+
+		/*!	\brief true if a transaction is open  */
+		bool transaction;
+
+		/*!	\brief number of executed statements after which an open transaction is committed and a new one started, 0 if never  */
+		int batchSize;
+
+		/*!	\brief number of statements executed in the open transaction  */
+		int batchCount;
+
 	public:
 
 		//--------------------------
@@ -98,7 +356,7 @@ namespace  zSpace
 		*/
 		bool open(char* filename);
 
-		/*! \brief This method closes the current database.
+		/*! \brief This method closes the current database. An open transaction is committed and the cached statements are finalized.
 		*		
 		*	\since version 0.0.1
 		*/
@@ -137,8 +395,252 @@ namespace  zSpace
 		*	\since version 0.0.1
 		*/		
 		void tableInsert(zStringArray &sqlStatment, string &tableName, zStringArray& columnNames, zStringArray &values);
-		
-	
+
+		/*! \brief This method inserts rows of values into an existing table in the database, using a cached prepared statement with the values bound as text. SQLite converts them to the column type affinity. The rows are committed every batch size rows, so on failure the batches before the failed one stay in the table.
+		*
+		*	\details Called inside an open transaction, the rows are committed with it and batched as set by beginTransaction. Use a batch size of 0 to insert all the rows or none.
+		*	\param		[in]	tableName			- name of the table.
+		*	\param		[in]	columnNames			- column names of the table.
+		*	\param		[in]	values				- container of values, row after row, with the number of column names per row.
+		*	\param		[in]	_batchSize			- number of rows inserted per transaction, 0 for a single transaction.
+		*	\return				bool				- true if all the rows are inserted, else false with the failed batch rolled back and the earlier batches committed.
+		*	\since version 0.0.4
+		*/
+		bool tableInsertBatch(string &tableName, zStringArray &columnNames, zStringArray &values, int _batchSize = 10000);
+
+		/*! \brief This method inserts rows into an existing table in the database, using a cached prepared statement with the values bound by the input method. The rows are committed every batch size rows, so on failure the batches before the failed one stay in the table.
+		*
+		*	\details Called inside an open transaction, the rows are committed with it and batched as set by beginTransaction. Use a batch size of 0 to insert all the rows or none.
+		*	\param		[in]	tableName			- name of the table.
+		*	\param		[in]	columnNames			- column names of the table.
+		*	\param		[in]	numRows				- number of rows to insert.
+		*	\param		[in]	bindRow				- method binding the values of a row to the statement, taking the statement and the row index. Parameter indices start at 1, in the order of the column names.
+		*	\param		[in]	_batchSize			- number of rows inserted per transaction, 0 for a single transaction.
+		*	\return				bool				- true if all the rows are inserted, else false with the failed batch rolled back and the earlier batches committed.
+		*	\since version 0.0.4
+		*/
+		bool tableInsertBatch(string &tableName, zStringArray &columnNames, int numRows, const function<bool(sqlite3_stmt*, int)> &bindRow, int _batchSize = 10000);
+
+		//--------------------------
+		//---- STATEMENT METHODS
+		//--------------------------
+
+		/*! \brief This method returns a cached prepared statement of the input SQL, preparing it on first use. The statement is reset and its bindings are cleared.
+		*
+		*	\details Statements being stepped or held by a live cursor are not reused, a new statement is prepared and cached instead. So queries nested in the rows of the same SQL do not reset the outer rows.
+		*
+		*	\param		[in]	sql				- SQL statement, with ? or :name parameters.
+		*	\param		[in]	displayError	- error is displayed in the console if true.
+		*	\return				sqlite3_stmt*	- prepared statement owned by the database, nullptr if the SQL is invalid.
+		*	\since version 0.0.4
+		*/
+		sqlite3_stmt* getStatement(const string &sql, bool displayError = true);
+
+		/*! \brief This method binds an integer value to a parameter of the input statement.
+		*
+		*	\param		[in]	stmt			- prepared statement.
+		*	\param		[in]	index			- parameter index, starting at 1.
+		*	\param		[in]	value			- value to bind.
+		*	\return				bool			- true if the value is bound, else false.
+		*	\since version 0.0.4
+		*/
+		bool bindInteger(sqlite3_stmt* stmt, int index, int64_t value);
+
+		/*! \brief This method binds a double value to a parameter of the input statement.
+		*
+		*	\param		[in]	stmt			- prepared statement.
+		*	\param		[in]	index			- parameter index, starting at 1.
+		*	\param		[in]	value			- value to bind.
+		*	\return				bool			- true if the value is bound, else false.
+		*	\since version 0.0.4
+		*/
+		bool bindDouble(sqlite3_stmt* stmt, int index, double value);
+
+		/*! \brief This method binds a text value to a parameter of the input statement. The text is copied.
+		*
+		*	\param		[in]	stmt			- prepared statement.
+		*	\param		[in]	index			- parameter index, starting at 1.
+		*	\param		[in]	value			- value to bind.
+		*	\return				bool			- true if the value is bound, else false.
+		*	\since version 0.0.4
+		*/
+		bool bindText(sqlite3_stmt* stmt, int index, const string &value);
+
+		/*! \brief This method binds a blob to a parameter of the input statement. The data is copied.
+		*
+		*	\param		[in]	stmt			- prepared statement.
+		*	\param		[in]	index			- parameter index, starting at 1.
+		*	\param		[in]	data			- pointer to the blob data.
+		*	\param		[in]	size			- size of the blob in bytes.
+		*	\return				bool			- true if the blob is bound, else false.
+		*	\since version 0.0.4
+		*/
+		bool bindBlob(sqlite3_stmt* stmt, int index, const void* data, int size);
+
+		/*! \brief This method binds NULL to a parameter of the input statement.
+		*
+		*	\param		[in]	stmt			- prepared statement.
+		*	\param		[in]	index			- parameter index, starting at 1.
+		*	\return				bool			- true if NULL is bound, else false.
+		*	\since version 0.0.4
+		*/
+		bool bindNull(sqlite3_stmt* stmt, int index);
+
+		/*! \brief This method executes the input statement, which does not return rows, and resets it for reuse. Inside a transaction started with a batch size, the transaction is committed and a new one started every batch size statements.
+		*
+		*	\param		[in]	stmt			- prepared statement with its parameters bound.
+		*	\param		[in]	displayError	- error is displayed in the console if true.
+		*	\return				bool			- true if the statement is executed, else false.
+		*	\since version 0.0.4
+		*/
+		bool executeStatement(sqlite3_stmt* stmt, bool displayError = true);
+
+		/*! \brief This method finalizes all the cached statements, detaching the live cursors.
+		*
+		*	\since version 0.0.4
+		*/
+		void clearStatements();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method sets the input cursor to the cached prepared statement of the input SQL. Parameters can be bound to the statement of the cursor before the first step.
+		*
+		*	\details The cursor holds the statement until it is destroyed or queried again, other queries of the same SQL get their own statement.
+		*	\param		[in]	sql				- SQL statement.
+		*	\param		[out]	cursor			- cursor before the first row.
+		*	\param		[in]	displayError	- error is displayed in the console if true.
+		*	\return				bool			- true if the statement is prepared, else false.
+		*	\since version 0.0.4
+		*/
+		bool query(const string &sql, zDatabaseCursor &cursor, bool displayError = true);
+
+		/*! \brief This method steps the rows of the input SQL, calling the input method on each row.
+		*
+		*	\param		[in]	sql				- SQL statement.
+		*	\param		[in]	rowMethod		- method called with the cursor on each row, returning false to stop.
+		*	\param		[in]	displayError	- error is displayed in the console if true.
+		*	\return				int				- number of rows visited, -1 if the statement failed.
+		*	\since version 0.0.4
+		*/
+		int queryRows(const string &sql, const function<bool(zDatabaseCursor&)> &rowMethod, bool displayError = true);
+
+		//--------------------------
+		//---- GEOMETRY METHODS
+		//--------------------------
+
+		/*! \brief This method creates a geometry table, if it does not exist, with the columns id, type, minX, minY, minZ, maxX, maxY, maxZ and geometry.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\return				bool			- true if the table exists, else false.
+		*	\since version 0.0.4
+		*/
+		bool geometryTableCreate(const string &tableName);
+
+		/*! \brief This method inserts or replaces a geometry blob in a geometry table.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\param		[in]	id				- geometry id.
+		*	\param		[in]	type			- geometry type - zMESH, zGRAPH or zFIELD.
+		*	\param		[in]	minBB			- minimum bounds of the geometry.
+		*	\param		[in]	maxBB			- maximum bounds of the geometry.
+		*	\param		[in]	data			- pointer to the blob data.
+		*	\param		[in]	size			- size of the blob in bytes.
+		*	\return				bool			- true if the geometry is stored, else false.
+		*	\since version 0.0.4
+		*/
+		bool geometryInsert(const string &tableName, int64_t id, int type, const zPoint &minBB, const zPoint &maxBB, const void* data, size_t size);
+
+		/*! \brief This method reads a geometry blob of a geometry table.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\param		[in]	id				- geometry id.
+		*	\param		[out]	type			- geometry type.
+		*	\param		[out]	data			- blob data.
+		*	\return				bool			- true if the geometry exists, else false.
+		*	\since version 0.0.4
+		*/
+		bool geometrySelect(const string &tableName, int64_t id, int &type, vector<unsigned char> &data);
+
+		/*! \brief This method reads a range of bytes of a geometry blob with incremental blob I/O, without loading the rest of the blob.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\param		[in]	id				- geometry id.
+		*	\param		[in]	offset			- byte offset of the range in the blob.
+		*	\param		[out]	data			- pointer to the output, of at least size bytes.
+		*	\param		[in]	size			- size of the range in bytes.
+		*	\return				bool			- true if the range is read, else false.
+		*	\since version 0.0.4
+		*/
+		bool geometryRead(const string &tableName, int64_t id, int64_t offset, void* data, int64_t size);
+
+		/*! \brief This method returns the size of a geometry blob.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\param		[in]	id				- geometry id.
+		*	\return				int64_t			- size of the blob in bytes, -1 if the geometry does not exist.
+		*	\since version 0.0.4
+		*/
+		int64_t geometrySize(const string &tableName, int64_t id);
+
+		/*! \brief This method gets the ids of the geometry whose bounds overlap the input bounds.
+		*
+		*	\param		[in]	tableName		- name of the table.
+		*	\param		[in]	minBB			- minimum of the query bounds.
+		*	\param		[in]	maxBB			- maximum of the query bounds.
+		*	\param		[out]	ids				- container of geometry ids.
+		*	\param		[in]	type			- geometry type to select, -1 for all types.
+		*	\return				bool			- true if the query succeeded, else false.
+		*	\since version 0.0.4
+		*/
+		bool geometryQuery(const string &tableName, const zPoint &minBB, const zPoint &maxBB, vector<int64_t> &ids, int type = -1);
+
+		//--------------------------
+		//---- TRANSACTION METHODS
+		//--------------------------
+
+		/*! \brief This method starts a transaction.
+		*
+		*	\param		[in]	_batchSize		- number of statements executed with executeStatement after which the transaction is committed and a new one started, 0 to commit only on commitTransaction.
+		*	\return				bool			- true if the transaction is started, else false.
+		*	\since version 0.0.4
+		*/
+		bool beginTransaction(int _batchSize = 0);
+
+		/*! \brief This method commits the open transaction.
+		*
+		*	\return				bool			- true if the transaction is committed, else false.
+		*	\since version 0.0.4
+		*/
+		bool commitTransaction();
+
+		/*! \brief This method rolls back the open transaction, or the current batch of a transaction started with a batch size.
+		*
+		*	\return				bool			- true if the transaction is rolled back, else false.
+		*	\since version 0.0.4
+		*/
+		bool rollbackTransaction();
+
+		/*! \brief This method checks if a transaction is open.
+		*
+		*	\return				bool			- true if a transaction is open, else false.
+		*	\since version 0.0.4
+		*/
+		bool inTransaction();
+
+	private:
+		//--------------------------
+		//---- PRIVATE METHODS
+		//--------------------------
+
+		/*! \brief This method checks if a cached statement is being stepped or held by a live cursor.
+		*
+		*	\param		[in]	stmt			- cached statement.
+		*	\return				bool			- true if the statement is in use, else false.
+		*	\since version 0.0.4
+		*/
+		bool isStatementInUse(sqlite3_stmt* stmt);
 	};
 }
 
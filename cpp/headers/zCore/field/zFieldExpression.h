@@ -0,0 +1,332 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_FIELD_EXPRESSION_H
+#define ZSPACE_FIELD_EXPRESSION_H
+
+#pragma once
+
+#include <headers/zCore/base/zVector.h>
+#include <headers/zCore/base/zMatrix.h>
+#include <headers/zCore/utilities/zUtilsCore.h>
+
+#include <headers/zCore/base/zTypeDef.h>
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zFields
+	*	\brief The field classes of the library.
+	*  @{
+	*/
+
+	/*! \struct zFieldExpressionNode
+	*	\brief A node of the field expression.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zFieldExpressionNode
+	{
+		/*!	\brief type of the node.  */
+		zFieldExpressionType type;
+
+		/*!	\brief index of the first child node, -1 for primitives.  */
+		int child0;
+
+		/*!	\brief index of the second child node, -1 for primitives and unary nodes.  */
+		int child1;
+
+		/*!	\brief centre of the circle, start of the line or origin of the clip plane.  */
+		zPoint p0;
+
+		/*!	\brief end of the line or unit normal of the clip plane.  */
+		zPoint p1;
+
+		/*!	\brief radius of the circle, offset of the graph distance or smoothing distance of the smooth union.  */
+		float radius;
+
+		/*!	\brief annular value of the primitive, 0 for none.  */
+		float annularVal;
+
+		/*!	\brief start of the polygon vertices or graph edges of the node in the expression containers.  */
+		int start;
+
+		/*!	\brief end of the polygon vertices or graph edges of the node in the expression containers (exclusive).  */
+		int end;
+
+		/*!	\brief first three rows of the inverse of the transform of a transform node.  */
+		float inverse[12];
+
+		/*!	\brief minimum corner of the bounds of the node.  */
+		float minBB[3];
+
+		/*!	\brief maximum corner of the bounds of the node.  */
+		float maxBB[3];
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zFields
+	*	\brief The field classes of the library.
+	*  @{
+	*/
+
+	/*! \class zFieldExpression
+	*	\brief A lazy expression of signed distance primitives, booleans and transforms, evaluated in one pass per position.
+	*	\details Nodes are added bottom up and refer to their children by index. Every node keeps bounds such that outside them its value is at least the distance to them.
+	*	Union, subtract and smooth union nodes skip their second child where its bounds show it cannot change the value, so the children far from a position are never evaluated.
+	*	The bounds hold for the distance primitives and rigid transforms, so transforms should not scale.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zFieldExpression
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief nodes of the expression, children before their parents.  */
+		vector<zFieldExpressionNode> nodes;
+
+		/*!	\brief polygon vertices and graph edge end points of the primitives.  */
+		zPointArray positions;
+
+		/*!	\brief core utilities Object  */
+		zUtilsCore coreUtils;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zFieldExpression();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zFieldExpression();
+
+		//--------------------------
+		//---- PRIMITIVE METHODS
+		//--------------------------
+
+		/*! \brief This method adds a circle node, a sphere on 3D fields.
+		*
+		*	\param		[in]	cen				- centre of the circle.
+		*	\param		[in]	r				- radius of the circle.
+		*	\param		[in]	annularVal		- input annular / offset value.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addCircle(zPoint cen, float r, double annularVal = 0);
+
+		/*! \brief This method adds a line node.
+		*
+		*	\param		[in]	v0				- start position of the line.
+		*	\param		[in]	v1				- end position of the line.
+		*	\param		[in]	annularVal		- input annular / offset value.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addLine(zPoint v0, zPoint v1, double annularVal = 0);
+
+		/*! \brief This method adds a signed distance node of a closed polygon in the XY plane, negative inside.
+		*
+		*	\param		[in]	vertices		- vertex positions of the polygon in order.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addPolygon(zPointArray &vertices);
+
+		/*! \brief This method adds a node of the distance to the edges of a graph minus an offset.
+		*
+		*	\param		[in]	vertices		- vertex positions of the graph.
+		*	\param		[in]	edges			- edges of the graph as pairs of indicies in to vertices.
+		*	\param		[in]	offset			- input distance variable.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addGraphDistance(zPointArray &vertices, zIntArray &edges, float offset);
+
+		//--------------------------
+		//---- OPERATOR METHODS
+		//--------------------------
+
+		/*! \brief This method adds a union node of two nodes.
+		*
+		*	\param		[in]	nodeA			- index of node A.
+		*	\param		[in]	nodeB			- index of node B.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addUnion(int nodeA, int nodeB);
+
+		/*! \brief This method adds a node subtracting node B from node A.
+		*
+		*	\param		[in]	nodeA			- index of node A.
+		*	\param		[in]	nodeB			- index of node B.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addSubtract(int nodeA, int nodeB);
+
+		/*! \brief This method adds an intersection node of two nodes.
+		*
+		*	\param		[in]	nodeA			- index of node A.
+		*	\param		[in]	nodeB			- index of node B.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addIntersect(int nodeA, int nodeB);
+
+		/*! \brief This method adds a smooth union node of two nodes, using the polynomial smooth minimum.
+		*
+		*	\details based on https://iquilezles.org/articles/smin/
+		*	\param		[in]	nodeA			- index of node A.
+		*	\param		[in]	nodeB			- index of node B.
+		*	\param		[in]	k				- smoothing distance.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addSmoothUnion(int nodeA, int nodeB, float k);
+
+		/*! \brief This method adds a node clipping the input node with a plane, keeping the side the normal points to as boolean_clipwithPlane(scalars, result, O, Z) of the field function sets.
+		*
+		*	\param		[in]	node			- index of the input node.
+		*	\param		[in]	O				- origin of the clip plane.
+		*	\param		[in]	Z				- normal of the clip plane.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addClipPlane(int node, zPoint O, zVector Z);
+
+		/*! \brief This method adds a node transforming the input node.
+		*
+		*	\param		[in]	node			- index of the input node.
+		*	\param		[in]	transform		- rigid transform applied to the input node, an exception is thrown if it scales or shears.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addTransform(int node, zTransform &transform);
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method gets the number of nodes of the expression.
+		*
+		*	\return				int				- number of nodes.
+		*	\since version 0.0.4
+		*/
+		int numNodes();
+
+		/*! \brief This method gets the value of a node at the input position.
+		*
+		*	\param		[in]	pos				- input position.
+		*	\param		[in]	nodeId			- index of the node, -1 for the last node added.
+		*	\return				float			- value of the node.
+		*	\since version 0.0.4
+		*/
+		float getValue(zPoint &pos, int nodeId = -1);
+
+		/*! \brief This method gets the values of a node at the input positions in parallel.
+		*
+		*	\param		[in]	inPositions		- input positions.
+		*	\param		[in]	numInPositions	- number of input positions.
+		*	\param		[out]	values			- container of values per position.
+		*	\param		[in]	nodeId			- index of the node, -1 for the last node added.
+		*	\since version 0.0.4
+		*/
+		void getValues(zPoint *inPositions, int numInPositions, zScalarArray &values, int nodeId = -1);
+
+		/*! \brief This method clears the expression.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method adds a node, checking its children.
+		*
+		*	\param		[in]	node			- input node.
+		*	\return				int				- index of the node.
+		*	\since version 0.0.4
+		*/
+		int addNode(zFieldExpressionNode &node);
+
+		/*! \brief This method sets the bounds of a node to the bounds of the input positions, grown by the input distance.
+		*
+		*	\param		[in]	node			- input node.
+		*	\param		[in]	inPositions		- input positions.
+		*	\param		[in]	numInPositions	- number of input positions.
+		*	\param		[in]	grow			- distance the bounds are grown by.
+		*	\since version 0.0.4
+		*/
+		void setBounds(zFieldExpressionNode &node, zPoint *inPositions, int numInPositions, float grow);
+
+		/*! \brief This method gets the distance from the input position to the bounds of a node.
+		*
+		*	\param		[in]	nodeId			- index of the node.
+		*	\param		[in]	pos				- input position.
+		*	\return				float			- distance, lowest float inside the bounds.
+		*	\since version 0.0.4
+		*/
+		float getBoundsDistance(int nodeId, zPoint &pos);
+
+		/*! \brief This method evaluates a node at the input position, skipping the children which cannot change the value.
+		*
+		*	\param		[in]	nodeId			- index of the node.
+		*	\param		[in]	pos				- input position.
+		*	\return				float			- value of the node.
+		*	\since version 0.0.4
+		*/
+		float evaluate(int nodeId, zPoint &pos);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/field/zFieldExpression.cpp>
+#endif
+
+#endif
@@ -0,0 +1,234 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_SPARSE_FIELD_3D_H
+#define ZSPACE_SPARSE_FIELD_3D_H
+
+#pragma once
+
+#include<headers/zCore/base/zVector.h>
+#include<headers/zCore/base/zColor.h>
+
+#include <unordered_map>
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zFields
+	*	\brief The field classes of the library.
+	*  @{
+	*/
+
+	/*! \class zSparseField3D
+	*	\brief A template class for sparse 3D fields - scalar and vector.
+	*	\details The field is split in to blocks of 8 x 8 x 8 values, and only the active blocks store their values. Inactive blocks read as a uniform tile value if one is set, else as the background value.
+	*	The voxel lattice is the same as the one of zField3D with the same bounds and resolution.
+	*	\tparam				T			- Type to work with zScalar(scalar field) and zVector(vector field).
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	template <typename T>
+	class ZSPACE_CORE zSparseField3D
+	{
+	public:
+		//--------------------------
+		//----  ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief number of values per side of a block  */
+		static const int blockSize = 8;
+
+		/*!	\brief number of values per block  */
+		static const int blockVolume = 512;
+
+		/*!	\brief stores the resolution in X direction  */
+		int n_X;
+
+		/*!	\brief stores the resolution in Y direction  */
+		int n_Y;
+
+		/*!	\brief stores the resolution in Z direction  */
+		int n_Z;
+
+		/*!	\brief stores the size of one unit in X direction  */
+		double unit_X;
+
+		/*!	\brief stores the size of one unit in Y direction  */
+		double unit_Y;
+
+		/*!	\brief stores the size of one unit in Z direction  */
+		double unit_Z;
+
+		/*!	\brief stores the minimum bounds of the field  */
+		zVector minBB;
+
+		/*!	\brief stores the maximum bounds of the field  */
+		zVector maxBB;
+
+		/*!	\brief value of the voxels of inactive blocks without a tile value  */
+		T background;
+
+		/*!	\brief key of each active block  */
+		vector<int64_t> blockKeys;
+
+		/*!	\brief map of block key to the index of the active block  */
+		unordered_map<int64_t, int> blockIndices;
+
+		/*!	\brief values of the active blocks, blockVolume values per block in x, y, z order with z changing fastest  */
+		vector<T> blockValues;
+
+		/*!	\brief map of block key to the uniform value of an inactive block, for blocks which do not read as the background  */
+		unordered_map<int64_t, T> tileValues;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zSparseField3D();
+
+		/*! \brief Overloaded constructor.
+		*	\param		[in]	_minBB		- minimum bounds of the field.
+		*	\param		[in]	_maxBB		- maximum bounds of the field.
+		*	\param		[in]	_n_X		- number of voxels in x direction.
+		*	\param		[in]	_n_Y		- number of voxels in y direction.
+		*	\param		[in]	_n_Z		- number of voxels in z direction.
+		*	\param		[in]	_background	- value of the voxels of inactive blocks.
+		*	\since version 0.0.4
+		*/
+		zSparseField3D(zVector _minBB, zVector _maxBB, int _n_X, int _n_Y, int _n_Z, T _background = T());
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zSparseField3D();
+
+		//--------------------------
+		//---- BLOCK METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of active blocks.
+		*
+		*	\return				int			- number of active blocks.
+		*	\since version 0.0.4
+		*/
+		int numBlocks();
+
+		/*! \brief This method returns the number of blocks in each direction.
+		*
+		*	\param		[out]	nb_X		- number of blocks in x direction.
+		*	\param		[out]	nb_Y		- number of blocks in y direction.
+		*	\param		[out]	nb_Z		- number of blocks in z direction.
+		*	\since version 0.0.4
+		*/
+		void getBlockResolution(int &nb_X, int &nb_Y, int &nb_Z);
+
+		/*! \brief This method returns the key of the block at the input block coordinates.
+		*
+		*	\param		[in]	b_X			- block coordinate in x direction.
+		*	\param		[in]	b_Y			- block coordinate in y direction.
+		*	\param		[in]	b_Z			- block coordinate in z direction.
+		*	\return				int64_t		- block key.
+		*	\since version 0.0.4
+		*/
+		int64_t getBlockKey(int b_X, int b_Y, int b_Z);
+
+		/*! \brief This method returns the block coordinates of the input block key.
+		*
+		*	\param		[in]	key			- block key.
+		*	\param		[out]	b_X			- block coordinate in x direction.
+		*	\param		[out]	b_Y			- block coordinate in y direction.
+		*	\param		[out]	b_Z			- block coordinate in z direction.
+		*	\since version 0.0.4
+		*/
+		void getBlockCoordinates(int64_t key, int &b_X, int &b_Y, int &b_Z);
+
+		/*! \brief This method returns the index of the active block with the input key.
+		*
+		*	\param		[in]	key			- block key.
+		*	\return				int			- index of the active block, -1 if the block is inactive.
+		*	\since version 0.0.4
+		*/
+		int getBlockIndex(int64_t key);
+
+		/*! \brief This method activates the block with the input key, filling it with its tile or background value.
+		*
+		*	\param		[in]	key			- block key.
+		*	\return				int			- index of the active block.
+		*	\since version 0.0.4
+		*/
+		int activateBlock(int64_t key);
+
+		/*! \brief This method returns the value an inactive block reads as.
+		*
+		*	\param		[in]	key			- block key.
+		*	\return				T			- tile value if one is set, else the background value.
+		*	\since version 0.0.4
+		*/
+		T getTileValue(int64_t key);
+
+		/*! \brief This method clears all active blocks and tile values.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- VALUE METHODS
+		//--------------------------
+
+		/*! \brief This method returns the value of the input voxel.
+		*
+		*	\param		[in]	i			- voxel index in x direction.
+		*	\param		[in]	j			- voxel index in y direction.
+		*	\param		[in]	k			- voxel index in z direction.
+		*	\return				T			- voxel value.
+		*	\since version 0.0.4
+		*/
+		T getValue(int i, int j, int k);
+
+		/*! \brief This method sets the value of the input voxel, activating its block if needed.
+		*
+		*	\param		[in]	i			- voxel index in x direction.
+		*	\param		[in]	j			- voxel index in y direction.
+		*	\param		[in]	k			- voxel index in z direction.
+		*	\param		[in]	value		- voxel value.
+		*	\since version 0.0.4
+		*/
+		void setValue(int i, int j, int k, T value);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/field/zSparseField3D.cpp>
+#endif
+
+#endif
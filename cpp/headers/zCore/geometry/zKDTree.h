@@ -0,0 +1,291 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_KDTREE_H
+#define ZSPACE_KDTREE_H
+
+#pragma once
+
+#include <headers/zCore/base/zVector.h>
+#include <headers/zCore/utilities/zUtilsCore.h>
+
+#include <headers/zCore/base/zTypeDef.h>
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zGeometry
+	*	\brief The geometry classes of the library.
+	*  @{
+	*/
+
+	/*! \struct zKDTreeNode
+	*	\brief A node of the KD-tree.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zKDTreeNode
+	{
+		/*!	\brief minimum corner of the points of the node.  */
+		float minBB[3];
+
+		/*!	\brief maximum corner of the points of the node.  */
+		float maxBB[3];
+
+		/*!	\brief start of the points of the node in the sorted points.  */
+		int start;
+
+		/*!	\brief end of the points of the node in the sorted points (exclusive).  */
+		int end;
+
+		/*!	\brief index of the right child node, -1 for leaves. The left child node is the next node.  */
+		int right;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zGeometry
+	*	\brief The geometry classes of the library.
+	*  @{
+	*/
+
+	/*! \class zKDTree
+	*	\brief A static KD-tree of a point set for closest point, k-nearest and radius queries.
+	*	\details The nodes are split at the median of the widest axis of their points, and the points are reordered in to one contiguous block per node. The sub trees are built in parallel.
+	*	The tree keeps a copy of the points, so it has to be created again after the points change. Queries are thread safe.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zKDTree
+	{
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief nodes of the tree in depth first order, the root is the first node.  */
+		vector<zKDTreeNode> nodes;
+
+		/*!	\brief points sorted by node.  */
+		zPointArray points;
+
+		/*!	\brief input index of each sorted point.  */
+		zIntArray indices;
+
+		/*!	\brief maximum number of points per leaf.  */
+		int leafSize;
+
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zKDTree();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zKDTree();
+
+		//--------------------------
+		//---- CREATE METHODS
+		//--------------------------
+
+		/*! \brief This method creates the tree from the input points.
+		*
+		*	\param		[in]	positions		- input positions.
+		*	\param		[in]	_leafSize		- maximum number of points per leaf.
+		*	\since version 0.0.4
+		*/
+		void create(const zPointArray &positions, int _leafSize = 16);
+
+		/*! \brief This method clears the tree.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method gets the number of points in the tree.
+		*
+		*	\return				int				- number of points.
+		*	\since version 0.0.4
+		*/
+		int numPoints();
+
+		/*! \brief This method gets the number of nodes in the tree.
+		*
+		*	\return				int				- number of nodes.
+		*	\since version 0.0.4
+		*/
+		int numNodes();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method gets the point closest to the input position.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[out]	distanceSquared	- squared distance to the closest point.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				int				- index of the closest point, -1 if no point is found.
+		*	\since version 0.0.4
+		*/
+		int getClosest(const zPoint &pos, double &distanceSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the points closest to each of the input positions, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[out]	closest			- index of the closest point per query, -1 if no point is found.
+		*	\param		[out]	distancesSquared- squared distance to the closest point per query.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getClosest(const zPointArray &positions, zIntArray &closest, zDoubleArray &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the k points nearest to the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- number of points.
+		*	\param		[out]	neighbours		- indicies of the nearest points.
+		*	\param		[out]	distancesSquared- squared distances of the nearest points.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int getKNearest(const zPoint &pos, int k, zIntArray &neighbours, zDoubleArray &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the k points nearest to each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	k				- number of points.
+		*	\param		[out]	neighbours		- indicies of the nearest points per query.
+		*	\param		[out]	distancesSquared- squared distances of the nearest points per query.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getKNearest(const zPointArray &positions, int k, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the points within the input radius of the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- indicies of the points within the radius.
+		*	\param		[out]	distancesSquared- squared distances of the points within the radius.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int getInRadius(const zPoint &pos, double radius, zIntArray &neighbours, zDoubleArray &distancesSquared);
+
+		/*! \brief This method gets the points within the input radius of each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- indicies of the points within the radius per query.
+		*	\param		[out]	distancesSquared- squared distances of the points within the radius per query.
+		*	\since version 0.0.4
+		*/
+		void getInRadius(const zPointArray &positions, double radius, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method gets the number of nodes of a sub tree with the input number of points.
+		*
+		*	\param		[in]	count			- number of points.
+		*	\return				int				- number of nodes.
+		*	\since version 0.0.4
+		*/
+		int getNumNodes(int count);
+
+		/*! \brief This method computes the bounds of the points of the input node.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\since version 0.0.4
+		*/
+		void computeBounds(int nodeId);
+
+		/*! \brief This method splits the points of the input node at the median of its widest axis, and sets up the child nodes.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\since version 0.0.4
+		*/
+		void splitNode(int nodeId);
+
+		/*! \brief This method builds the sub tree of the input node.
+		*
+		*	\param		[in]	nodeId			- input node index, with start and end set.
+		*	\since version 0.0.4
+		*/
+		void buildNode(int nodeId);
+
+		/*! \brief This method gets the squared distance from the input position to the bounds of the input node.
+		*
+		*	\param		[in]	nodeId			- input node index.
+		*	\param		[in]	pos				- input position.
+		*	\return				double			- squared distance, 0 if the position is inside the bounds.
+		*	\since version 0.0.4
+		*/
+		double getDistanceSquared(int nodeId, const zPoint &pos);
+
+		/*! \brief This method searches the tree for the nearest points, closer sub trees first.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- maximum number of points.
+		*	\param		[in]	maxDistanceSq	- maximum squared distance.
+		*	\param		[out]	neighbours		- indicies of the nearest points, sorted by distance.
+		*	\param		[out]	distancesSquared- squared distances of the nearest points.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int searchNearest(const zPoint &pos, int k, double maxDistanceSq, zIntArray &neighbours, zDoubleArray &distancesSquared);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/geometry/zKDTree.cpp>
+#endif
+
+#endif
@@ -160,6 +160,13 @@ namespace zSpace
 		*/
 		void removeFromPositionMap(zPoint &pos, int precisionfactor = 6);
 
+		/*! \brief This method rebuilds the positionVertex Map from all the vertex positions.
+		*	\details The hash keys are formatted in parallel and inserted in vertex order, so the result matches adding the positions one by one.
+		*	\param		[in]		precisionfactor	- input precision factor.
+		*	\since version 0.0.4
+		*/
+		void setPositionMap(int precisionfactor = 6);
+
 	};
 }
 
@@ -0,0 +1,473 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_POINTCLOUD_STORE_H
+#define ZSPACE_POINTCLOUD_STORE_H
+
+#pragma once
+
+#include <headers/zCore/base/zVector.h>
+#include <headers/zCore/base/zColor.h>
+#include <headers/zCore/utilities/zUtilsCore.h>
+
+#include <headers/zCore/base/zTypeDef.h>
+
+#include <list>
+#include <memory>
+#include <functional>
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zGeometry
+	*	\brief The geometry classes of the library.
+	*  @{
+	*/
+
+	/*! \struct zPointStoreRecord
+	*	\brief A point of the out of core point cloud store, as stored in the tile files.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zPointStoreRecord
+	{
+		/*!	\brief position of the point.  */
+		float x, y, z;
+
+		/*!	\brief 8 bit red, green, blue and alpha values of the point.  */
+		uint8_t r, g, b, a;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zGeometry
+	*	\brief The geometry classes of the library.
+	*  @{
+	*/
+
+	/*! \struct zPointStoreNode
+	*	\brief An octree node of the out of core point cloud store, as stored in the index file.
+	*	\details Interior nodes keep a level of detail sample of the points that passed through them, leaves keep the remaining points.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zPointStoreNode
+	{
+		/*!	\brief minimum corner of the octree cell.  */
+		float cellMin[3];
+
+		/*!	\brief maximum corner of the octree cell.  */
+		float cellMax[3];
+
+		/*!	\brief minimum corner of the points in the sub tree.  */
+		float pointsMin[3];
+
+		/*!	\brief maximum corner of the points in the sub tree.  */
+		float pointsMax[3];
+
+		/*!	\brief child node indicies per octant, -1 if the child does not exist.  */
+		int32_t children[8];
+
+		/*!	\brief depth of the node, 0 for the root.  */
+		int32_t depth;
+
+		/*!	\brief 1 if the node is a leaf, else 0.  */
+		int32_t leaf;
+
+		/*!	\brief number of points stored in the tile of the node.  */
+		uint64_t numPoints;
+
+		/*!	\brief number of points stored in the sub tree.  */
+		uint64_t totalPoints;
+
+		/*!	\brief number of points routed through the node, drives the level of detail sampling.  */
+		uint64_t numVisits;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zGeometry
+	*	\brief The geometry classes of the library.
+	*  @{
+	*/
+
+	/*! \class zPointCloudStore
+	*	\brief A disk backed octree point cloud store for clouds which do not fit in memory.
+	*	\details Points are streamed in with addPoints and written to one tile file per octree node. Leaves are split when they exceed the tile capacity, and interior nodes keep every lodStride-th point that passes through them, up to the tile capacity, as their level of detail sample.
+	*	Once finalised or opened, tiles are memory mapped on demand and the least recently used tiles are unmapped when the mapped bytes exceed the memory budget.
+	*	Pointers returned by getTile are only valid until the next call which maps a tile. The store is not thread safe.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zPointCloudStore
+	{
+	public:
+		//--------------------------
+		//----  ATTRIBUTES
+		//--------------------------
+
+		/*! \brief core utilities object			*/
+		zUtilsCore coreUtils;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zPointCloudStore();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Pending points are written and the index is finalised.
+		*
+		*	\since version 0.0.4
+		*/
+		~zPointCloudStore();
+
+		zPointCloudStore(const zPointCloudStore&) = delete;
+
+		zPointCloudStore& operator=(const zPointCloudStore&) = delete;
+
+		//--------------------------
+		//---- CREATE METHODS
+		//--------------------------
+
+		/*! \brief This method creates an empty store in the input directory. Existing tiles in the directory are overwritten.
+		*
+		*	\param		[in]	_directory		- store directory, created if it does not exist.
+		*	\param		[in]	minBB			- minimum corner of the root cell.
+		*	\param		[in]	maxBB			- maximum corner of the root cell. Points outside the root cell are stored in the border cells.
+		*	\param		[in]	_maxTilePoints	- maximum number of points per tile before a leaf is split.
+		*	\param		[in]	_maxDepth		- maximum depth of the octree. Leaves at the maximum depth are not split.
+		*	\return				bool			- true if the store was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool create(string _directory, zPoint &minBB, zPoint &maxBB, int _maxTilePoints = 65536, int _maxDepth = 16);
+
+		/*! \brief This method streams the input points in to the store. Points are buffered in memory and written to the tiles when the buffers exceed the memory budget.
+		*
+		*	\param		[in]	positions		- pointer to the point positions.
+		*	\param		[in]	colors			- pointer to the point colors, nullptr for white.
+		*	\param		[in]	count			- number of points.
+		*	\since version 0.0.4
+		*/
+		void addPoints(const zPoint* positions, const zColor* colors, size_t count);
+
+		/*! \brief This method writes all pending points and the index file. The store is read only afterwards.
+		*
+		*	\return				bool			- true if the index was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool finalise();
+
+		/*! \brief This method opens a finalised store.
+		*
+		*	\param		[in]	_directory		- store directory.
+		*	\return				bool			- true if the store was opened, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string _directory);
+
+		/*! \brief This method closes the store and unmaps all tiles.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		//--------------------------
+		//---- MEMORY METHODS
+		//--------------------------
+
+		/*! \brief This method sets the number of bytes of pending points and mapped tiles the store keeps in memory.
+		*
+		*	\param		[in]	numBytes		- memory budget in bytes.
+		*	\since version 0.0.4
+		*/
+		void setMemoryBudget(size_t numBytes);
+
+		/*! \brief This method returns the memory budget.
+		*
+		*	\return				size_t			- memory budget in bytes.
+		*	\since version 0.0.4
+		*/
+		size_t getMemoryBudget();
+
+		/*! \brief This method returns the number of bytes of the currently mapped tiles.
+		*
+		*	\return				size_t			- mapped bytes.
+		*	\since version 0.0.4
+		*/
+		size_t getResidentBytes();
+
+		/*! \brief This method unmaps all tiles.
+		*
+		*	\since version 0.0.4
+		*/
+		void evictAll();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method returns if the store is finalised or opened and can be queried.
+		*
+		*	\return				bool			- true if the store can be queried, else false.
+		*	\since version 0.0.4
+		*/
+		bool isReadable();
+
+		/*! \brief This method returns the number of points in the store.
+		*
+		*	\return				size_t			- number of points.
+		*	\since version 0.0.4
+		*/
+		size_t numPoints();
+
+		/*! \brief This method returns the number of octree nodes.
+		*
+		*	\return				int				- number of nodes.
+		*	\since version 0.0.4
+		*/
+		int numNodes();
+
+		/*! \brief This method returns the depth of the deepest node.
+		*
+		*	\return				int				- maximum node depth.
+		*	\since version 0.0.4
+		*/
+		int getDepth();
+
+		/*! \brief This method returns the input node.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\return				zPointStoreNode&	- node.
+		*	\since version 0.0.4
+		*/
+		zPointStoreNode& getNode(int nodeId);
+
+		/*! \brief This method gets the bounds of all points in the store, without reading any tile.
+		*
+		*	\param		[out]	minBB			- minimum corner of the bounds.
+		*	\param		[out]	maxBB			- maximum corner of the bounds.
+		*	\since version 0.0.4
+		*/
+		void getBounds(zPoint &minBB, zPoint &maxBB);
+
+		/*! \brief This method maps the tile of the input node, evicting the least recently used tiles if the memory budget is exceeded.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\param		[out]	count			- number of points in the tile.
+		*	\return				const zPointStoreRecord*	- pointer to the points of the tile, nullptr if the tile is empty or could not be mapped.
+		*	\since version 0.0.4
+		*/
+		const zPointStoreRecord* getTile(int nodeId, size_t &count);
+
+		/*! \brief This method gets the nodes up to the input level of detail whose points intersect the input box.
+		*
+		*	\param		[in]	minBB			- minimum corner of the box.
+		*	\param		[in]	maxBB			- maximum corner of the box.
+		*	\param		[in]	lod				- maximum node depth, -1 for all nodes.
+		*	\param		[out]	nodeIds			- node indicies.
+		*	\since version 0.0.4
+		*/
+		void getNodes(zPoint &minBB, zPoint &maxBB, int lod, zIntArray &nodeIds);
+
+		/*! \brief This method gets the points inside the input box, up to the input level of detail.
+		*
+		*	\param		[in]	minBB			- minimum corner of the box.
+		*	\param		[in]	maxBB			- maximum corner of the box.
+		*	\param		[in]	lod				- maximum node depth, -1 for all points.
+		*	\param		[out]	positions		- point positions.
+		*	\param		[out]	colors			- point colors.
+		*	\since version 0.0.4
+		*/
+		void getPoints(zPoint &minBB, zPoint &maxBB, int lod, zPointArray &positions, zColorArray &colors);
+
+		/*! \brief This method gets the k nearest points to the input position, nodes are visited closest first.
+		*
+		*	\param		[in]	pos				- query position.
+		*	\param		[in]	k				- number of points.
+		*	\param		[out]	positions		- positions of the nearest points, sorted by distance.
+		*	\param		[out]	distances		- distances to the nearest points.
+		*	\since version 0.0.4
+		*/
+		void getKNearest(zPoint &pos, int k, zPointArray &positions, zFloatArray &distances);
+
+		/*! \brief This method gets the closest point to the input position.
+		*
+		*	\param		[in]	pos				- query position.
+		*	\param		[out]	closest			- closest point.
+		*	\return				bool			- true if the store has points, else false.
+		*	\since version 0.0.4
+		*/
+		bool getClosestPoint(zPoint &pos, zPoint &closest);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief store directory.  */
+		string directory;
+
+		/*!	\brief octree nodes.  */
+		vector<zPointStoreNode> nodes;
+
+		/*!	\brief maximum number of points per tile.  */
+		int maxTilePoints;
+
+		/*!	\brief maximum depth of the octree.  */
+		int maxDepth;
+
+		/*!	\brief every lodStride-th point routed through an interior node is kept in its level of detail sample.  */
+		int lodStride;
+
+		/*!	\brief memory budget in bytes.  */
+		size_t memoryBudget;
+
+		/*!	\brief true while points can be added.  */
+		bool writable;
+
+		/*!	\brief true once the store is finalised or opened.  */
+		bool readable;
+
+		/*!	\brief pending points per node, not yet written to the tiles.  */
+		vector<vector<zPointStoreRecord>> pending;
+
+		/*!	\brief number of pending points of all nodes.  */
+		size_t numPending;
+
+		/*!	\brief mapped tiles per node.  */
+		vector<unique_ptr<zUtilsMappedFile>> tiles;
+
+		/*!	\brief mapped node indicies, most recently used first.  */
+		list<int> tileOrder;
+
+		/*!	\brief position of each mapped node in tileOrder.  */
+		vector<list<int>::iterator> tileOrderIters;
+
+		/*!	\brief number of bytes of the mapped tiles.  */
+		size_t residentBytes;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method returns the path of the tile file of the input node.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\return				string			- tile path.
+		*	\since version 0.0.4
+		*/
+		string getTilePath(int nodeId);
+
+		/*! \brief This method adds a node to the octree.
+		*
+		*	\param		[in]	cellMin			- minimum corner of the cell.
+		*	\param		[in]	cellMax			- maximum corner of the cell.
+		*	\param		[in]	depth			- depth of the node.
+		*	\return				int				- index of the new node.
+		*	\since version 0.0.4
+		*/
+		int addNode(const float* cellMin, const float* cellMax, int depth);
+
+		/*! \brief This method routes the input point from the input node to the node that stores it, splitting full leaves.
+		*
+		*	\param		[in]	record			- point.
+		*	\param		[in]	nodeId			- start node index.
+		*	\since version 0.0.4
+		*/
+		void insert(const zPointStoreRecord &record, int nodeId);
+
+		/*! \brief This method splits the input leaf, keeping the level of detail sample and routing the other points to the children.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\since version 0.0.4
+		*/
+		void split(int nodeId);
+
+		/*! \brief This method appends the pending points of the input node to its tile file.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\return				bool			- true if the points were written, else false.
+		*	\since version 0.0.4
+		*/
+		bool flushNode(int nodeId);
+
+		/*! \brief This method appends the pending points of all nodes to their tile files.
+		*
+		*	\return				bool			- true if the points were written, else false.
+		*	\since version 0.0.4
+		*/
+		bool flushAll();
+
+		/*! \brief This method reads the tile file and the pending points of the input node.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\param		[out]	records			- points of the node.
+		*	\since version 0.0.4
+		*/
+		void readNode(int nodeId, vector<zPointStoreRecord> &records);
+
+		/*! \brief This method unmaps the tile of the input node.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\since version 0.0.4
+		*/
+		void evict(int nodeId);
+
+		/*! \brief This method returns the squared distance from the input position to the point bounds of the input node.
+		*
+		*	\param		[in]	nodeId			- node index.
+		*	\param		[in]	pos				- query position.
+		*	\return				float			- squared distance, 0 if inside.
+		*	\since version 0.0.4
+		*/
+		float getSquaredDistance(int nodeId, zPoint &pos);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/geometry/zPointCloudStore.cpp>
+#endif
+
+#endif
@@ -0,0 +1,338 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_ARENA_H
+#define ZSPACE_UTILS_ARENA_H
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zVector.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zScratchArena
+	*	\brief A bump allocator for short lived algorithm temporaries.
+	*	\details Memory is handed out linearly from large blocks and is only reclaimed when the arena is rewound to an earlier marker, typically by a zScratchScope at the end of an algorithm call. Every thread owns its own arena, accessed through threadLocal().
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zScratchArena
+	{
+	public:
+		//--------------------------
+		//---- PUBLIC ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief stores a rewind position of the arena - block index and byte offset in the block.  */
+		struct zScratchMarker
+		{
+			int block = 0;
+			size_t offset = 0;
+		};
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\param		[in]	_blockSize		- size in bytes of each memory block requested from the system.
+		*	\since version 0.0.4
+		*/
+		zScratchArena(size_t _blockSize = 65536);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zScratchArena();
+
+		zScratchArena(const zScratchArena&) = delete;
+
+		zScratchArena& operator=(const zScratchArena&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method returns the arena of the calling thread.
+		*
+		*	\return				zScratchArena&		- thread local arena.
+		*	\since version 0.0.4
+		*/
+		static zScratchArena& threadLocal();
+
+		/*! \brief This method allocates the input number of bytes from the arena.
+		*
+		*	\param		[in]	numBytes		- number of bytes.
+		*	\param		[in]	alignment		- alignment of the returned address, needs to be a power of 2.
+		*	\return				void*			- pointer to the allocated memory.
+		*	\since version 0.0.4
+		*/
+		void* allocate(size_t numBytes, size_t alignment = alignof(std::max_align_t));
+
+		/*! \brief This method releases the input allocation. Only the most recent allocation is reclaimed immediately, all others are reclaimed when the arena is rewound.
+		*
+		*	\param		[in]	ptr				- pointer returned by allocate.
+		*	\since version 0.0.4
+		*/
+		void deallocate(void* ptr);
+
+		/*! \brief This method returns the current position of the arena.
+		*
+		*	\return				zScratchMarker	- current position.
+		*	\since version 0.0.4
+		*/
+		zScratchMarker getMarker();
+
+		/*! \brief This method rewinds the arena to the input marker, releasing all allocations made after it. The memory blocks are retained for reuse.
+		*
+		*	\param		[in]	marker			- marker returned by getMarker.
+		*	\since version 0.0.4
+		*/
+		void rewind(zScratchMarker &marker);
+
+		/*! \brief This method rewinds the arena to the start.
+		*
+		*	\since version 0.0.4
+		*/
+		void reset();
+
+		/*! \brief This method releases all the memory blocks of the arena back to the system.
+		*
+		*	\since version 0.0.4
+		*/
+		void release();
+
+		/*! \brief This method returns the total number of bytes reserved from the system.
+		*
+		*	\return				size_t			- reserved bytes.
+		*	\since version 0.0.4
+		*/
+		size_t getReservedBytes();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief stores a memory block of the arena.  */
+		struct zScratchBlock
+		{
+			unique_ptr<char[]> data;
+			size_t size = 0;
+		};
+
+		/*!	\brief container of memory blocks.  */
+		vector<zScratchBlock> blocks;
+
+		/*!	\brief index of the block currently allocated from.  */
+		int currentBlock;
+
+		/*!	\brief byte offset in the current block.  */
+		size_t currentOffset;
+
+		/*!	\brief default size of a memory block in bytes.  */
+		size_t blockSize;
+
+		/*!	\brief pointer to the most recent allocation.  */
+		void* lastAllocation;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zScratchScope
+	*	\brief A scoped marker of the thread local scratch arena. The arena is rewound when the scope is destroyed, so scratch containers need to be declared after the scope.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zScratchScope
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor. Records the current position of the thread local arena.
+		*
+		*	\since version 0.0.4
+		*/
+		zScratchScope();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Rewinds the thread local arena to the recorded position.
+		*
+		*	\since version 0.0.4
+		*/
+		~zScratchScope();
+
+		zScratchScope(const zScratchScope&) = delete;
+
+		zScratchScope& operator=(const zScratchScope&) = delete;
+
+	protected:
+		/*!	\brief pointer to the arena of the scope.  */
+		zScratchArena* arena;
+
+		/*!	\brief arena position at the start of the scope.  */
+		zScratchArena::zScratchMarker marker;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zScratchAllocator
+	*	\brief A standard library compatible allocator drawing from a zScratchArena.
+	*	\tparam				T			- Type of element.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	template <typename T>
+	class zScratchAllocator
+	{
+	public:
+		typedef T value_type;
+
+		/*!	\brief pointer to the arena the allocator draws from.  */
+		zScratchArena* arena;
+
+		/*! \brief Default constructor. Uses the thread local arena.
+		*
+		*	\since version 0.0.4
+		*/
+		zScratchAllocator() : arena(&zScratchArena::threadLocal()) {}
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_arena			- input arena.
+		*	\since version 0.0.4
+		*/
+		zScratchAllocator(zScratchArena &_arena) : arena(&_arena) {}
+
+		template <typename U>
+		zScratchAllocator(const zScratchAllocator<U> &other) : arena(other.arena) {}
+
+		T* allocate(size_t n)
+		{
+			return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* ptr, size_t)
+		{
+			arena->deallocate(ptr);
+		}
+
+		template <typename U>
+		bool operator==(const zScratchAllocator<U> &other) const { return arena == other.arena; }
+
+		template <typename U>
+		bool operator!=(const zScratchAllocator<U> &other) const { return arena != other.arena; }
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \typedef zScratchArray
+	*	\brief A vector drawing its memory from the thread local scratch arena.
+	*
+	*	\since version 0.0.4
+	*/
+	template <typename T>
+	using zScratchArray = vector<T, zScratchAllocator<T>>;
+
+	/*! \typedef zScratchIntArray
+	*	\brief A scratch vector of integers.
+	*
+	*	\since version 0.0.4
+	*/
+	typedef zScratchArray<int> zScratchIntArray;
+
+	/*! \typedef zScratchPointArray
+	*	\brief A scratch vector of zPoints.
+	*
+	*	\since version 0.0.4
+	*/
+	typedef zScratchArray<zVector> zScratchPointArray;
+
+	/** @}*/
+
+	/** @}*/
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsArena.cpp>
+#endif
+
+#endif
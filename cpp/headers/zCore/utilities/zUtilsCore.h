@@ -49,6 +49,9 @@ using namespace std;
 
 #include<headers/zCore/utilities/zUtilsPointerMethods.h>
 #include<headers/zCore/utilities/zUtilsBMP.h>
+#include<headers/zCore/utilities/zUtilsArena.h>
+#include<headers/zCore/utilities/zUtilsParallel.h>
+#include<headers/zCore/utilities/zUtilsIO.h>
 
 #include <depends/nlohmann/json.hpp>
 using json = nlohmann::json;;
@@ -0,0 +1,2191 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_IO_H
+#define ZSPACE_UTILS_IO_H
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <charconv>
+#include <ostream>
+#include <fstream>
+
+#include<headers/zCore/base/zInline.h>
+#include<headers/zCore/base/zEnumerators.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsMappedFile
+	*	\brief A read only memory mapped file.
+	*	\details The file contents are mapped in the address space of the process and paged in by the operating system on access, so large files can be parsed without copying them into memory first.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsMappedFile
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsMappedFile();
+
+		/*! \brief Overloaded constructor. Maps the input file.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\since version 0.0.4
+		*/
+		zUtilsMappedFile(string path);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsMappedFile();
+
+		zUtilsMappedFile(const zUtilsMappedFile&) = delete;
+
+		zUtilsMappedFile& operator=(const zUtilsMappedFile&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file, unmapping any previously mapped file.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\return				bool			- true if the file is mapped, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns if a file is mapped.
+		*
+		*	\return				bool			- true if a file is mapped, else false.
+		*	\since version 0.0.4
+		*/
+		bool isOpen();
+
+		/*! \brief This method returns the pointer to the start of the mapped contents.
+		*
+		*	\return				const char*		- pointer to the file contents, nullptr for empty or unmapped files.
+		*	\since version 0.0.4
+		*/
+		const char* getData();
+
+		/*! \brief This method returns the size of the mapped file.
+		*
+		*	\return				size_t			- size in bytes.
+		*	\since version 0.0.4
+		*/
+		size_t getSize();
+
+		/*! \brief This method splits the input byte range of the file in contiguous chunks starting at line beginnings.
+		*
+		*	\param		[in]	numChunks		- requested number of chunks.
+		*	\param		[out]	chunks			- container of chunk byte ranges [start, end).
+		*	\param		[in]	start			- start byte of the range to split.
+		*	\since version 0.0.4
+		*/
+		void getLineChunks(int numChunks, vector<pair<size_t, size_t>> &chunks, size_t start = 0);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief pointer to the mapped contents.  */
+		const char* data;
+
+		/*!	\brief size of the mapped contents in bytes.  */
+		size_t size;
+
+		/*!	\brief platform file handle.  */
+		void* fileHandle;
+
+		/*!	\brief platform mapping handle.  */
+		void* mapHandle;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsTextCursor
+	*	\brief A forward only cursor to tokenise and parse numbers from a text buffer without copying.
+	*	\details Numbers are parsed with std::from_chars, so parsing is locale independent and allocation free.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsTextCursor
+	{
+	public:
+		//--------------------------
+		//---- PUBLIC ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief current position of the cursor.  */
+		const char* ptr;
+
+		/*!	\brief end of the text buffer.  */
+		const char* end;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_begin			- start of the text buffer.
+		*	\param		[in]	_end			- end of the text buffer.
+		*	\since version 0.0.4
+		*/
+		zUtilsTextCursor(const char* _begin, const char* _end);
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method returns if the cursor reached the end of the buffer.
+		*
+		*	\return				bool			- true if at end, else false.
+		*	\since version 0.0.4
+		*/
+		bool atEnd();
+
+		/*! \brief This method returns if the cursor is at the end of the current line, after skipping spaces.
+		*
+		*	\return				bool			- true if at line end, else false.
+		*	\since version 0.0.4
+		*/
+		bool atLineEnd();
+
+		/*! \brief This method skips spaces, tabs and carriage returns on the current line.
+		*
+		*	\since version 0.0.4
+		*/
+		void skipSpaces();
+
+		/*! \brief This method moves the cursor to the start of the next line.
+		*
+		*	\since version 0.0.4
+		*/
+		void skipLine();
+
+		/*! \brief This method skips the input character if it is the next character on the line.
+		*
+		*	\param		[in]	c				- character to skip.
+		*	\return				bool			- true if the character was skipped, else false.
+		*	\since version 0.0.4
+		*/
+		bool skipChar(char c);
+
+		/*! \brief This method skips the remaining characters of the current token, without skipping leading spaces.
+		*
+		*	\since version 0.0.4
+		*/
+		void skipToken();
+
+		/*! \brief This method reads the next token delimited by white space or any of the input delimiters.
+		*
+		*	\param		[out]	token			- start of the token.
+		*	\param		[out]	length			- length of the token.
+		*	\param		[in]	delimiters		- additional delimiter characters.
+		*	\return				bool			- true if a token was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readToken(const char* &token, size_t &length, const char* delimiters = "");
+
+		/*! \brief This method reads the next token and compares it with the input keyword.
+		*
+		*	\param		[in]	keyword			- keyword to match.
+		*	\return				bool			- true if the token matches, the cursor is only advanced on a match.
+		*	\since version 0.0.4
+		*/
+		bool matchToken(const char* keyword);
+
+		/*! \brief This method parses a double at the cursor.
+		*
+		*	\param		[out]	value			- parsed value.
+		*	\return				bool			- true if a number was parsed, else false.
+		*	\since version 0.0.4
+		*/
+		bool readDouble(double &value);
+
+		/*! \brief This method parses a float at the cursor. The value is parsed as a double and narrowed, the same as atof.
+		*
+		*	\param		[out]	value			- parsed value.
+		*	\return				bool			- true if a number was parsed, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFloat(float &value);
+
+		/*! \brief This method parses an integer at the cursor.
+		*
+		*	\param		[out]	value			- parsed value.
+		*	\return				bool			- true if a number was parsed, else false.
+		*	\since version 0.0.4
+		*/
+		bool readInt(int &value);
+
+		/*! \brief This method parses a 64 bit integer at the cursor.
+		*
+		*	\param		[out]	value			- parsed value.
+		*	\return				bool			- true if a number was parsed, else false.
+		*	\since version 0.0.4
+		*/
+		bool readInt64(int64_t &value);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsTextWriter
+	*	\brief A growable text buffer to format numbers without iostreams.
+	*	\details Numbers are formatted with std::to_chars. Floating point values use the general format at the set precision, which matches the default iostream formatting (%g) at the same precision.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsTextWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_precision		- number of significant digits of floating point values.
+		*	\since version 0.0.4
+		*/
+		zUtilsTextWriter(int _precision = 6);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsTextWriter();
+
+		//--------------------------
+		//---- SET METHODS
+		//--------------------------
+
+		/*! \brief This method sets the number of significant digits of floating point values.
+		*
+		*	\param		[in]	_precision		- number of significant digits.
+		*	\since version 0.0.4
+		*/
+		void setPrecision(int _precision);
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of significant digits of floating point values.
+		*
+		*	\return				int				- number of significant digits.
+		*	\since version 0.0.4
+		*/
+		int getPrecision();
+
+		/*! \brief This method returns the pointer to the start of the buffer.
+		*
+		*	\return				const char*		- pointer to the buffer.
+		*	\since version 0.0.4
+		*/
+		const char* getData();
+
+		/*! \brief This method returns the number of characters in the buffer.
+		*
+		*	\return				size_t			- number of characters.
+		*	\since version 0.0.4
+		*/
+		size_t getSize();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method reserves capacity for the input number of additional characters.
+		*
+		*	\param		[in]	numChars		- number of characters.
+		*	\since version 0.0.4
+		*/
+		void reserve(size_t numChars);
+
+		/*! \brief This method appends a character.
+		*
+		*	\param		[in]	c				- input character.
+		*	\since version 0.0.4
+		*/
+		void write(char c);
+
+		/*! \brief This method appends a null terminated string.
+		*
+		*	\param		[in]	str				- input string.
+		*	\since version 0.0.4
+		*/
+		void write(const char* str);
+
+		/*! \brief This method appends an integer.
+		*
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void write(int value);
+
+		/*! \brief This method appends a float at the set precision. The value is formatted as a double, the same as iostreams.
+		*
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void write(float value);
+
+		/*! \brief This method appends a double at the set precision.
+		*
+		*	\param		[in]	value			- input value.
+		*	\since version 0.0.4
+		*/
+		void write(double value);
+
+		/*! \brief This method clears the buffer, retaining its capacity.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		/*! \brief This method writes the buffer to the input stream in a single call and clears it.
+		*
+		*	\param		[in]	out				- output stream.
+		*	\return				bool			- true if the stream is in a good state after writing, else false.
+		*	\since version 0.0.4
+		*/
+		bool flush(ostream &out);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief character buffer, only the first size characters are valid.  */
+		vector<char> buffer;
+
+		/*!	\brief number of valid characters in the buffer.  */
+		size_t size;
+
+		/*!	\brief number of significant digits of floating point values.  */
+		int precision;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsCSVLayout
+	*	\brief The column mapping of a delimited text file of points.
+	*	\details Columns are separated by white space, commas or semicolons. Rows where a mapped column is not a number, such as header rows, are skipped.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsCSVLayout
+	{
+		/*!	\brief column indicies of the x, y and z coordinates.  */
+		int positionColumns[3];
+
+		/*!	\brief column indicies of the red, green and blue values, -1 if the file has no colors.  */
+		int colorColumns[3];
+
+		/*!	\brief factor mapping the color values of the file to the 0 - 1 range.  */
+		float colorScale;
+
+		/*!	\brief column indicies of additional scalar values.  */
+		vector<int> scalarColumns;
+
+		/*!	\brief true if a leading 'v' token on a row is skipped, to read the legacy zCSV export.  */
+		bool skipVertexToken;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor. Maps x, y, z to the first three columns, without colors or scalars.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsCSVLayout();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method returns if all three color columns are mapped.
+		*
+		*	\return				bool			- true if the layout has colors, else false.
+		*	\since version 0.0.4
+		*/
+		bool hasColors();
+
+		/*! \brief This method returns the number of columns that need to be read per row.
+		*
+		*	\return				int				- one more than the highest mapped column index.
+		*	\since version 0.0.4
+		*/
+		int getNumColumns();
+	};
+
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsBinaryHeader
+	*	\brief The header of the little endian binary block file format.
+	*	\details A file is the header, followed by the block table and the data blocks, each starting on a 64 byte boundary.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsBinaryHeader
+	{
+		/*!	\brief file type identifier.  */
+		char magic[4];
+
+		/*!	\brief file format version.  */
+		uint32_t version;
+
+		/*!	\brief byte order tag, 0x01020304 stored in little endian order.  */
+		uint32_t byteOrder;
+
+		/*!	\brief number of entries in the block table.  */
+		uint32_t numBlocks;
+
+		/*!	\brief size of the file in bytes.  */
+		uint64_t fileSize;
+
+		/*!	\brief reserved for future use.  */
+		uint64_t reserved;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsBinaryBlock
+	*	\brief A block table entry of the binary block file format.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsBinaryBlock
+	{
+		/*!	\brief block type - zBinaryBlockType.  */
+		uint32_t type;
+
+		/*!	\brief size of an element of the block in bytes.  */
+		uint32_t stride;
+
+		/*!	\brief number of elements in the block.  */
+		uint64_t count;
+
+		/*!	\brief byte offset of the block from the start of the file.  */
+		uint64_t offset;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsBinaryWriter
+	*	\brief A writer of the binary block file format.
+	*	\details Blocks reference the caller's memory and are written directly from it, so the data needs to stay valid until write is called.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsBinaryWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsBinaryWriter();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsBinaryWriter();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method adds a data block.
+		*
+		*	\param		[in]	type			- block type.
+		*	\param		[in]	data			- pointer to the block data.
+		*	\param		[in]	stride			- size of an element in bytes.
+		*	\param		[in]	count			- number of elements.
+		*	\since version 0.0.4
+		*/
+		void addBlock(int type, const void* data, size_t stride, size_t count);
+
+		/*! \brief This method writes the header, block table and blocks to the output file.
+		*
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	magic			- four character file type identifier.
+		*	\param		[in]	version			- file format version.
+		*	\return				bool			- true if the file was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool write(string path, const char* magic, int version);
+
+		/*! \brief This method writes the header, block table and blocks to the output buffer, with the same layout as the file.
+		*
+		*	\param		[out]	buffer			- output buffer, resized to the size of the data.
+		*	\param		[in]	magic			- four character file type identifier.
+		*	\param		[in]	version			- file format version.
+		*	\return				bool			- true if the buffer was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool write(vector<unsigned char> &buffer, const char* magic, int version);
+
+		/*! \brief This method removes all the blocks.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of block table entries.  */
+		vector<zUtilsBinaryBlock> blocks;
+
+		/*!	\brief container of block data pointers.  */
+		vector<const void*> blockData;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method computes the block offsets and the header.
+		*
+		*	\param		[out]	header			- header of the data.
+		*	\param		[in]	magic			- four character file type identifier.
+		*	\param		[in]	version			- file format version.
+		*	\return				bool			- true if the platform can write the format, else false.
+		*	\since version 0.0.4
+		*/
+		bool layout(zUtilsBinaryHeader &header, const char* magic, int version);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsBinaryReader
+	*	\brief A reader of the binary block file format.
+	*	\details The file is memory mapped and the blocks are returned as pointers in to the mapping, so no data is parsed or copied while reading. Data already in memory, such as a database blob, can be read in place as well.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsBinaryReader
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsBinaryReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsBinaryReader();
+
+		zUtilsBinaryReader(const zUtilsBinaryReader&) = delete;
+
+		zUtilsBinaryReader& operator=(const zUtilsBinaryReader&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file and validates its header and block table.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\param		[in]	magic			- expected four character file type identifier.
+		*	\param		[in]	maxVersion		- highest supported file format version.
+		*	\return				bool			- true if the file is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path, const char* magic, int maxVersion);
+
+		/*! \brief This method validates the header and block table of the input data in memory. The data is not copied and needs to stay valid until the reader is closed.
+		*
+		*	\param		[in]	_data			- pointer to the data.
+		*	\param		[in]	_size			- size of the data in bytes.
+		*	\param		[in]	magic			- expected four character file type identifier.
+		*	\param		[in]	maxVersion		- highest supported file format version.
+		*	\return				bool			- true if the data is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(const void* _data, size_t _size, const char* magic, int maxVersion);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns the file format version of the open file.
+		*
+		*	\return				int				- file format version.
+		*	\since version 0.0.4
+		*/
+		int getVersion();
+
+		/*! \brief This method returns if the file contains a block of the input type.
+		*
+		*	\param		[in]	type			- block type.
+		*	\return				bool			- true if the block exists, else false.
+		*	\since version 0.0.4
+		*/
+		bool hasBlock(int type);
+
+		/*! \brief This method returns the pointer to the data of the block of the input type.
+		*
+		*	\param		[in]	type			- block type.
+		*	\param		[in]	stride			- expected size of an element in bytes.
+		*	\param		[out]	count			- number of elements of the block.
+		*	\return				const void*		- pointer to the block data in the mapped file, nullptr if the block does not exist or has a different stride.
+		*	\since version 0.0.4
+		*/
+		const void* getBlock(int type, size_t stride, size_t &count);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief mapped file.  */
+		zUtilsMappedFile file;
+
+		/*!	\brief pointer to the data, in the mapped file or in memory.  */
+		const char* data;
+
+		/*!	\brief size of the data in bytes.  */
+		size_t size;
+
+		/*!	\brief file format version.  */
+		int version;
+
+		/*!	\brief container of block table entries.  */
+		vector<zUtilsBinaryBlock> blocks;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method validates the header and block table of the data.
+		*
+		*	\param		[in]	magic			- expected four character file type identifier.
+		*	\param		[in]	maxVersion		- highest supported file format version.
+		*	\return				bool			- true if the data is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool parse(const char* magic, int maxVersion);
+	};
+
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsPlyProperty
+	*	\brief A property of an element of the PLY file format.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsPlyProperty
+	{
+		/*!	\brief property name.  */
+		string name;
+
+		/*!	\brief value type - zPlyDataType.  */
+		int type;
+
+		/*!	\brief list count type - zPlyDataType, -1 if the property is not a list.  */
+		int countType;
+
+		/*!	\brief byte offset of the property in a binary record, only valid for elements without list properties.  */
+		size_t offset;
+
+		/*!	\brief source values of a scalar property, used when writing.  */
+		const float* data;
+
+		/*!	\brief number of floats between consecutive source values, used when writing.  */
+		size_t stride;
+
+		/*!	\brief scale applied to the source values, used when writing.  */
+		float scale;
+
+		/*!	\brief source list sizes of a list property, used when writing.  */
+		const int* counts;
+
+		/*!	\brief source list values of a list property, used when writing.  */
+		const int* values;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsPlyElement
+	*	\brief An element of the PLY file format.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsPlyElement
+	{
+		/*!	\brief element name.  */
+		string name;
+
+		/*!	\brief number of records.  */
+		size_t count;
+
+		/*!	\brief container of properties, in file order.  */
+		vector<zUtilsPlyProperty> properties;
+
+		/*!	\brief size of a binary record in bytes, 0 if the element has list properties.  */
+		size_t stride;
+
+		/*!	\brief byte offset of the first record from the start of the file.  */
+		size_t begin;
+
+		/*!	\brief byte offset past the last record from the start of the file.  */
+		size_t end;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsPlyReader
+	*	\brief A reader of the PLY file format, supporting ascii and binary bodies.
+	*	\details The file is memory mapped and the header is parsed on open. Properties are read as columns straight from the mapping in to strided float arrays. Binary records of fixed size are converted in parallel.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsPlyReader
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsPlyReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsPlyReader();
+
+		zUtilsPlyReader(const zUtilsPlyReader&) = delete;
+
+		zUtilsPlyReader& operator=(const zUtilsPlyReader&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file, parses the header and locates the records of every element.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\return				bool			- true if the file is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns the body format of the open file.
+		*
+		*	\return				int				- zPlyFormat.
+		*	\since version 0.0.4
+		*/
+		int getFormat();
+
+		/*! \brief This method returns the element of the input name.
+		*
+		*	\param		[in]	name			- element name.
+		*	\return				zUtilsPlyElement*	- pointer to the element, nullptr if it does not exist.
+		*	\since version 0.0.4
+		*/
+		zUtilsPlyElement* getElement(string name);
+
+		/*! \brief This method returns if the input element has a property of the input name.
+		*
+		*	\param		[in]	element			- input element.
+		*	\param		[in]	name			- property name.
+		*	\return				bool			- true if the property exists, else false.
+		*	\since version 0.0.4
+		*/
+		bool hasProperty(zUtilsPlyElement &element, string name);
+
+		/*! \brief This method reads a scalar property of every record of the input element.
+		*
+		*	\param		[in]	element			- input element.
+		*	\param		[in]	name			- property name.
+		*	\param		[out]	out				- output values, element.count * outStride floats.
+		*	\param		[in]	outStride		- number of floats between consecutive output values.
+		*	\param		[in]	normalize		- maps integer values to the 0 to 1 range of their type if true, as used for colors.
+		*	\return				bool			- true if the property exists and was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readProperty(zUtilsPlyElement &element, string name, float* out, size_t outStride, bool normalize = false);
+
+		/*! \brief This method reads a list property of every record of the input element.
+		*
+		*	\param		[in]	element			- input element.
+		*	\param		[in]	name			- property name.
+		*	\param		[out]	counts			- list size per record.
+		*	\param		[out]	values			- list values of all records.
+		*	\return				bool			- true if the property exists and was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readList(zUtilsPlyElement &element, string name, vector<int> &counts, vector<int> &values);
+
+		//--------------------------
+		//---- TYPE METHODS
+		//--------------------------
+
+		/*! \brief This method returns the size in bytes of the input data type.
+		*
+		*	\param		[in]	type			- zPlyDataType.
+		*	\return				size_t			- size in bytes, 0 if the type is invalid.
+		*	\since version 0.0.4
+		*/
+		static size_t getTypeSize(int type);
+
+		/*! \brief This method returns the header name of the input data type.
+		*
+		*	\param		[in]	type			- zPlyDataType.
+		*	\return				string			- type name.
+		*	\since version 0.0.4
+		*/
+		static string getTypeName(int type);
+
+		/*! \brief This method returns the data type of the input header name. Both the legacy and the sized names are supported.
+		*
+		*	\param		[in]	name			- type name.
+		*	\return				int				- zPlyDataType, -1 if the name is unknown.
+		*	\since version 0.0.4
+		*/
+		static int getType(string name);
+
+		/*! \brief This method decodes a binary value of the input data type.
+		*
+		*	\param		[in]	ptr				- pointer to the value.
+		*	\param		[in]	type			- zPlyDataType.
+		*	\param		[in]	swap			- swaps the byte order if true.
+		*	\return				double			- value.
+		*	\since version 0.0.4
+		*/
+		static double decodeValue(const char* ptr, int type, bool swap);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief mapped file.  */
+		zUtilsMappedFile file;
+
+		/*!	\brief body format - zPlyFormat.  */
+		int format;
+
+		/*!	\brief container of elements, in file order.  */
+		vector<zUtilsPlyElement> elements;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method parses the header and returns the byte offset of the body.
+		*
+		*	\param		[out]	bodyStart		- byte offset of the body.
+		*	\return				bool			- true if the header is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool readHeader(size_t &bodyStart);
+
+		/*! \brief This method locates the records of every element in the body.
+		*
+		*	\param		[in]	bodyStart		- byte offset of the body.
+		*	\return				bool			- true if all records are within the file, else false.
+		*	\since version 0.0.4
+		*/
+		bool locateElements(size_t bodyStart);
+
+		/*! \brief This method walks the records of the input element one by one, as required by ascii bodies and binary records with lists.
+		*
+		*	\param		[in]	element			- input element.
+		*	\param		[in]	propertyId		- index of the property to read.
+		*	\param		[in]	func			- callable executed per record with the list size and values of the property. Scalars are passed as lists of size 1.
+		*	\return				bool			- true if all records were read, else false.
+		*	\since version 0.0.4
+		*/
+		template <typename F>
+		bool walkRecords(zUtilsPlyElement &element, int propertyId, F func);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsPlyWriter
+	*	\brief A writer of the PLY file format, supporting ascii and binary bodies.
+	*	\details Elements and their properties are added as columns over the source containers, which need to stay valid until write. Records are formatted in parallel blocks and written in order.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsPlyWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsPlyWriter();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsPlyWriter();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method adds an element. The properties added next belong to it.
+		*
+		*	\param		[in]	name			- element name.
+		*	\param		[in]	count			- number of records.
+		*	\since version 0.0.4
+		*/
+		void addElement(string name, size_t count);
+
+		/*! \brief This method adds a scalar property to the last element.
+		*
+		*	\param		[in]	name			- property name.
+		*	\param		[in]	type			- value type - zPlyDataType. Integer values are rounded and clamped to the type.
+		*	\param		[in]	data			- source values.
+		*	\param		[in]	stride			- number of floats between consecutive source values.
+		*	\param		[in]	scale			- scale applied to the source values, 255 to write 0 to 1 colors as uchar.
+		*	\since version 0.0.4
+		*/
+		void addProperty(string name, int type, const float* data, size_t stride, float scale = 1.0f);
+
+		/*! \brief This method adds a list property to the last element.
+		*
+		*	\param		[in]	name			- property name.
+		*	\param		[in]	countType		- list size type - zPlyDataType.
+		*	\param		[in]	type			- value type - zPlyDataType.
+		*	\param		[in]	counts			- source list size per record.
+		*	\param		[in]	values			- source list values of all records.
+		*	\since version 0.0.4
+		*/
+		void addListProperty(string name, int countType, int type, const int* counts, const int* values);
+
+		/*! \brief This method writes the file.
+		*
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	format			- body format - zPlyFormat.
+		*	\param		[in]	precision		- number of significant digits of floating point values in ascii bodies.
+		*	\return				bool			- true if the file was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool write(string path, int format, int precision = 6);
+
+		/*! \brief This method clears the elements.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of elements.  */
+		vector<zUtilsPlyElement> elements;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method encodes a value as the input data type. Integer types are rounded and clamped.
+		*
+		*	\param		[out]	ptr				- pointer to the output bytes.
+		*	\param		[in]	type			- zPlyDataType.
+		*	\param		[in]	value			- value.
+		*	\param		[in]	swap			- swaps the byte order if true.
+		*	\since version 0.0.4
+		*/
+		static void encodeValue(char* ptr, int type, double value, bool swap);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsCompression
+	*	\brief A collection of lossless compression and value packing methods for binary file formats.
+	*	\details The LZ methods implement a byte oriented LZ77 codec with a 64 KB window, in the spirit of LZ4. It favours decoding speed over ratio, and works best on byte shuffled numeric data.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsCompression
+	{
+	public:
+		//--------------------------
+		//---- LZ METHODS
+		//--------------------------
+
+		/*! \brief This method compresses the input bytes and appends them to the output container.
+		*
+		*	\param		[in]	src				- pointer to the input bytes.
+		*	\param		[in]	size			- number of input bytes.
+		*	\param		[out]	dst				- container the compressed bytes are appended to.
+		*	\since version 0.0.4
+		*/
+		static void compressLZ(const unsigned char* src, size_t size, vector<unsigned char> &dst);
+
+		/*! \brief This method decompresses the input bytes. The input is validated, so corrupt data fails instead of writing out of bounds.
+		*
+		*	\param		[in]	src				- pointer to the compressed bytes.
+		*	\param		[in]	srcSize			- number of compressed bytes.
+		*	\param		[out]	dst				- pointer to the output bytes.
+		*	\param		[in]	dstSize			- number of decompressed bytes.
+		*	\return				bool			- true if the input decompressed to exactly dstSize bytes, else false.
+		*	\since version 0.0.4
+		*/
+		static bool decompressLZ(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
+
+		/*! \brief This method splits the input bytes in chunks which are compressed in parallel, and appends them with their chunk table to the output container. Chunks which do not compress are stored as is.
+		*
+		*	\param		[in]	src				- pointer to the input bytes.
+		*	\param		[in]	size			- number of input bytes.
+		*	\param		[out]	dst				- container the chunk table and chunks are appended to.
+		*	\param		[in]	chunkSize		- number of input bytes per chunk.
+		*	\since version 0.0.4
+		*/
+		static void compressChunks(const unsigned char* src, size_t size, vector<unsigned char> &dst, size_t chunkSize = 1 << 20);
+
+		/*! \brief This method decompresses the chunks written by compressChunks in parallel.
+		*
+		*	\param		[in]	src				- pointer to the chunk table.
+		*	\param		[in]	srcSize			- number of bytes of the chunk table and chunks.
+		*	\param		[out]	dst				- pointer to the output bytes.
+		*	\param		[in]	dstSize			- number of decompressed bytes.
+		*	\return				bool			- true if all chunks decompressed, else false.
+		*	\since version 0.0.4
+		*/
+		static bool decompressChunks(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
+
+		//--------------------------
+		//---- PACKING METHODS
+		//--------------------------
+
+		/*! \brief This method groups the bytes of the input elements by byte position, so the slowly changing high bytes of numeric values end up next to each other.
+		*
+		*	\param		[in]	src				- pointer to the input elements.
+		*	\param		[in]	numElements		- number of elements.
+		*	\param		[in]	elementSize		- size of an element in bytes.
+		*	\param		[out]	dst				- pointer to the output bytes, of numElements * elementSize bytes.
+		*	\since version 0.0.4
+		*/
+		static void shuffleBytes(const unsigned char* src, size_t numElements, size_t elementSize, unsigned char* dst);
+
+		/*! \brief This method reverts shuffleBytes.
+		*
+		*	\param		[in]	src				- pointer to the shuffled bytes.
+		*	\param		[in]	numElements		- number of elements.
+		*	\param		[in]	elementSize		- size of an element in bytes.
+		*	\param		[out]	dst				- pointer to the output elements, of numElements * elementSize bytes.
+		*	\since version 0.0.4
+		*/
+		static void unshuffleBytes(const unsigned char* src, size_t numElements, size_t elementSize, unsigned char* dst);
+
+		/*! \brief This method converts a single precision value to IEEE 754 half precision, rounding to the nearest even value.
+		*
+		*	\param		[in]	value			- input value.
+		*	\return				uint16_t		- half precision bits.
+		*	\since version 0.0.4
+		*/
+		static uint16_t floatToHalf(float value);
+
+		/*! \brief This method converts an IEEE 754 half precision value to single precision.
+		*
+		*	\param		[in]	half			- half precision bits.
+		*	\return				float			- output value.
+		*	\since version 0.0.4
+		*/
+		static float halfToFloat(uint16_t half);
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsFieldHeader
+	*	\brief The header of the little endian binary zFIELD file format.
+	*	\details A file is the header, followed by the frames, each starting on a 64 byte boundary, and the frame index table. The frame index is written when the file is closed.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsFieldHeader
+	{
+		/*!	\brief file type identifier.  */
+		char magic[4];
+
+		/*!	\brief file format version.  */
+		uint32_t version;
+
+		/*!	\brief byte order tag, 0x01020304 stored in little endian order.  */
+		uint32_t byteOrder;
+
+		/*!	\brief number of floats per field value - 1 for scalar fields, 3 for vector fields.  */
+		uint32_t numComponents;
+
+		/*!	\brief value precision - zFieldPrecision.  */
+		uint32_t precision;
+
+		/*!	\brief 1 if frames are delta encoded and compressed, else 0.  */
+		uint32_t compression;
+
+		/*!	\brief number of frames between frames which do not depend on the previous frame.  */
+		uint32_t keyFrameInterval;
+
+		/*!	\brief resolution in X, Y and Z direction.  */
+		int32_t n_X, n_Y, n_Z;
+
+		/*!	\brief size of one unit in X, Y and Z direction.  */
+		double unit_X, unit_Y, unit_Z;
+
+		/*!	\brief minimum bounds of the field.  */
+		double minBB[3];
+
+		/*!	\brief maximum bounds of the field.  */
+		double maxBB[3];
+
+		/*!	\brief number of field values per frame.  */
+		uint64_t numValues;
+
+		/*!	\brief number of frames.  */
+		uint64_t numFrames;
+
+		/*!	\brief byte offset of the frame index table from the start of the file.  */
+		uint64_t indexOffset;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsFieldFrame
+	*	\brief A frame index table entry of the binary zFIELD file format.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsFieldFrame
+	{
+		/*!	\brief the frame values are XOR encoded against the values of the previous frame.  */
+		static const uint32_t deltaFlag = 1;
+
+		/*!	\brief the frame values are byte shuffled and LZ compressed in chunks.  */
+		static const uint32_t compressedFlag = 2;
+
+		/*!	\brief byte offset of the frame from the start of the file.  */
+		uint64_t offset;
+
+		/*!	\brief size of the frame in bytes.  */
+		uint64_t size;
+
+		/*!	\brief time of the frame.  */
+		double time;
+
+		/*!	\brief frame encoding flags.  */
+		uint32_t flags;
+
+		/*!	\brief reserved for future use.  */
+		uint32_t reserved;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsFieldWriter
+	*	\brief A writer of the binary zFIELD file format for time series of scalar and vector fields.
+	*	\details Frames are appended to the file as they are added, so only the previous frame is kept in memory. 
+	*	With compression every frame but the key frames is XOR encoded against the previous frame, which turns the unchanged bits of slowly changing fields in to zeros, then byte shuffled and LZ compressed. The encoding is lossless for the stored precision.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsFieldWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsFieldWriter();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Closes the file if it is open.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsFieldWriter();
+
+		zUtilsFieldWriter(const zUtilsFieldWriter&) = delete;
+
+		zUtilsFieldWriter& operator=(const zUtilsFieldWriter&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method creates the output file. 
+		*
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	_header			- field header. The resolution, units, bounds, numValues, numComponents, precision, compression and keyFrameInterval are used, the other attributes are set by the writer.
+		*	\return				bool			- true if the file was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path, zUtilsFieldHeader &_header);
+
+		/*! \brief This method encodes and appends a frame to the file.
+		*
+		*	\param		[in]	values			- pointer to numValues * numComponents floats.
+		*	\param		[in]	time			- time of the frame.
+		*	\return				bool			- true if the frame was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool addFrame(const float* values, double time = 0.0);
+
+		/*! \brief This method writes the frame index table and the final header, and closes the file.
+		*
+		*	\return				bool			- true if the file was completed, else false.
+		*	\since version 0.0.4
+		*/
+		bool close();
+
+		/*! \brief This method returns if a file is open.
+		*
+		*	\return				bool			- true if a file is open, else false.
+		*	\since version 0.0.4
+		*/
+		bool isOpen();
+
+		/*! \brief This method returns the header of the open file.
+		*
+		*	\return				zUtilsFieldHeader	- field header.
+		*	\since version 0.0.4
+		*/
+		const zUtilsFieldHeader& getHeader();
+
+		/*! \brief This method returns the number of frames added to the open file.
+		*
+		*	\return				int				- number of frames.
+		*	\since version 0.0.4
+		*/
+		int numFrames();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief output file.  */
+		ofstream file;
+
+		/*!	\brief file header.  */
+		zUtilsFieldHeader header;
+
+		/*!	\brief container of frame index table entries.  */
+		vector<zUtilsFieldFrame> frames;
+
+		/*!	\brief packed values of the previous frame.  */
+		vector<unsigned char> previous;
+
+		/*!	\brief packed values of the current frame.  */
+		vector<unsigned char> current;
+
+		/*!	\brief encoding buffers.  */
+		vector<unsigned char> shuffled, compressed;
+
+		/*!	\brief write position in the file.  */
+		uint64_t position;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsFieldReader
+	*	\brief A reader of the binary zFIELD file format.
+	*	\details The file is memory mapped. Uncompressed single precision frames are read directly from the mapping, compressed frames are decoded from the closest preceding key frame, or from the last decoded frame when reading sequentially.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsFieldReader
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsFieldReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsFieldReader();
+
+		zUtilsFieldReader(const zUtilsFieldReader&) = delete;
+
+		zUtilsFieldReader& operator=(const zUtilsFieldReader&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file and validates its header and frame index table.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\return				bool			- true if the file is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns if a file is open.
+		*
+		*	\return				bool			- true if a file is open, else false.
+		*	\since version 0.0.4
+		*/
+		bool isOpen();
+
+		/*! \brief This method returns the header of the open file.
+		*
+		*	\return				zUtilsFieldHeader	- field header.
+		*	\since version 0.0.4
+		*/
+		const zUtilsFieldHeader& getHeader();
+
+		/*! \brief This method returns the number of frames of the open file.
+		*
+		*	\return				int				- number of frames.
+		*	\since version 0.0.4
+		*/
+		int numFrames();
+
+		/*! \brief This method returns the time of the input frame.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\return				double			- frame time.
+		*	\since version 0.0.4
+		*/
+		double getFrameTime(int frame);
+
+		/*! \brief This method returns the pointer to the values of the input frame in the mapped file.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\return				const float*	- pointer to numValues * numComponents floats, nullptr if the frame is compressed or half precision.
+		*	\since version 0.0.4
+		*/
+		const float* getFrameData(int frame);
+
+		/*! \brief This method decodes the values of the input frame.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\param		[out]	values			- pointer to numValues * numComponents floats.
+		*	\return				bool			- true if the frame was decoded, else false.
+		*	\since version 0.0.4
+		*/
+		bool getFrame(int frame, float* values);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief mapped file.  */
+		zUtilsMappedFile file;
+
+		/*!	\brief file header.  */
+		zUtilsFieldHeader header;
+
+		/*!	\brief container of frame index table entries.  */
+		vector<zUtilsFieldFrame> frames;
+
+		/*!	\brief packed values of the last decoded frame.  */
+		vector<unsigned char> current;
+
+		/*!	\brief index of the last decoded frame, -1 if none.  */
+		int currentFrame;
+
+		/*!	\brief decoding buffers.  */
+		vector<unsigned char> packed, shuffled;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method decodes the packed values of the input frame in to the current values.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\return				bool			- true if the frame was decoded, else false.
+		*	\since version 0.0.4
+		*/
+		bool decodeFrame(int frame);
+
+		/*! \brief This method returns the number of bytes of the packed values of a frame.
+		*
+		*	\return				size_t			- number of bytes.
+		*	\since version 0.0.4
+		*/
+		size_t getFrameBytes();
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \struct zUtilsVertexCacheHeader
+	*	\brief The header of the little endian binary vertex animation cache file format.
+	*	\details A file is the header, followed by the topology, the frames, each starting on a 64 byte boundary, and the frame index table of zUtilsFieldFrame entries. The frame index is written when the file is closed.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	struct ZSPACE_CORE zUtilsVertexCacheHeader
+	{
+		/*!	\brief topology type of points without connectivity.  */
+		static const uint32_t pointTopology = 0;
+
+		/*!	\brief topology type of polygon meshes - polygon counts and connects.  */
+		static const uint32_t meshTopology = 1;
+
+		/*!	\brief topology type of graphs - edge connects.  */
+		static const uint32_t graphTopology = 2;
+
+		/*!	\brief file type identifier.  */
+		char magic[4];
+
+		/*!	\brief file format version.  */
+		uint32_t version;
+
+		/*!	\brief byte order tag, 0x01020304 stored in little endian order.  */
+		uint32_t byteOrder;
+
+		/*!	\brief topology type.  */
+		uint32_t topology;
+
+		/*!	\brief number of vertices per frame.  */
+		uint32_t numVertices;
+
+		/*!	\brief number of topology counts.  */
+		uint32_t numCounts;
+
+		/*!	\brief number of topology connects.  */
+		uint32_t numConnects;
+
+		/*!	\brief number of frames between frames which do not depend on the previous frame.  */
+		uint32_t keyFrameInterval;
+
+		/*!	\brief quantization step of the vertex coordinates.  */
+		double quantization;
+
+		/*!	\brief number of frames.  */
+		uint64_t numFrames;
+
+		/*!	\brief byte offset of the topology counts and connects from the start of the file.  */
+		uint64_t topologyOffset;
+
+		/*!	\brief byte offset of the frame index table from the start of the file.  */
+		uint64_t indexOffset;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsVertexCacheWriter
+	*	\brief A writer of the binary vertex animation cache file format, which stores the topology once and the vertex positions per frame.
+	*	\details Coordinates are quantized to integer multiples of the quantization step. Key frames store the quantized coordinates, the other frames store their difference to the previous frame, which is small for simulations.
+	*	The frames are byte shuffled and LZ compressed, and appended to the file as they are added.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsVertexCacheWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsVertexCacheWriter();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Closes the file if it is open.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsVertexCacheWriter();
+
+		zUtilsVertexCacheWriter(const zUtilsVertexCacheWriter&) = delete;
+
+		zUtilsVertexCacheWriter& operator=(const zUtilsVertexCacheWriter&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method creates the output file and writes the topology.
+		*
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	_header			- cache header. The topology, numVertices, keyFrameInterval and quantization are used, the other attributes are set by the writer.
+		*	\param		[in]	counts			- container of topology counts - polygon vertex counts for meshes, empty for graphs.
+		*	\param		[in]	connects		- container of topology connects - polygon connects for meshes, edge vertex pairs for graphs.
+		*	\return				bool			- true if the file was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path, zUtilsVertexCacheHeader &_header, vector<int> &counts, vector<int> &connects);
+
+		/*! \brief This method encodes and appends a frame to the file.
+		*
+		*	\param		[in]	positions		- pointer to numVertices * 3 floats.
+		*	\param		[in]	time			- time of the frame.
+		*	\return				bool			- true if the frame was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool addFrame(const float* positions, double time = 0.0);
+
+		/*! \brief This method writes the frame index table and the final header, and closes the file.
+		*
+		*	\return				bool			- true if the file was completed, else false.
+		*	\since version 0.0.4
+		*/
+		bool close();
+
+		/*! \brief This method returns if a file is open.
+		*
+		*	\return				bool			- true if a file is open, else false.
+		*	\since version 0.0.4
+		*/
+		bool isOpen();
+
+		/*! \brief This method returns the header of the open file.
+		*
+		*	\return				zUtilsVertexCacheHeader	- cache header.
+		*	\since version 0.0.4
+		*/
+		const zUtilsVertexCacheHeader& getHeader();
+
+		/*! \brief This method returns the number of frames added to the open file.
+		*
+		*	\return				int				- number of frames.
+		*	\since version 0.0.4
+		*/
+		int numFrames();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief output file.  */
+		ofstream file;
+
+		/*!	\brief file header.  */
+		zUtilsVertexCacheHeader header;
+
+		/*!	\brief container of frame index table entries.  */
+		vector<zUtilsFieldFrame> frames;
+
+		/*!	\brief quantized coordinates of the previous frame.  */
+		vector<int32_t> previous;
+
+		/*!	\brief encoded coordinates of the current frame.  */
+		vector<uint32_t> current;
+
+		/*!	\brief encoding buffers.  */
+		vector<unsigned char> shuffled, compressed;
+
+		/*!	\brief write position in the file.  */
+		uint64_t position;
+	};
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsVertexCacheReader
+	*	\brief A reader of the binary vertex animation cache file format.
+	*	\details The file is memory mapped. Frames are decoded from the closest preceding key frame, or from the last decoded frame when playing forward, so scrubbing costs at most a key frame interval of decoding.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsVertexCacheReader
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsVertexCacheReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsVertexCacheReader();
+
+		zUtilsVertexCacheReader(const zUtilsVertexCacheReader&) = delete;
+
+		zUtilsVertexCacheReader& operator=(const zUtilsVertexCacheReader&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method maps the input file and validates its header, topology and frame index table.
+		*
+		*	\param		[in]	path			- input file path.
+		*	\return				bool			- true if the file is valid, else false.
+		*	\since version 0.0.4
+		*/
+		bool open(string path);
+
+		/*! \brief This method unmaps the file.
+		*
+		*	\since version 0.0.4
+		*/
+		void close();
+
+		/*! \brief This method returns if a file is open.
+		*
+		*	\return				bool			- true if a file is open, else false.
+		*	\since version 0.0.4
+		*/
+		bool isOpen();
+
+		/*! \brief This method returns the header of the open file.
+		*
+		*	\return				zUtilsVertexCacheHeader	- cache header.
+		*	\since version 0.0.4
+		*/
+		const zUtilsVertexCacheHeader& getHeader();
+
+		/*! \brief This method gets the topology of the open file.
+		*
+		*	\param		[out]	counts			- container of topology counts.
+		*	\param		[out]	connects		- container of topology connects.
+		*	\since version 0.0.4
+		*/
+		void getTopology(vector<int> &counts, vector<int> &connects);
+
+		/*! \brief This method returns the number of frames of the open file.
+		*
+		*	\return				int				- number of frames.
+		*	\since version 0.0.4
+		*/
+		int numFrames();
+
+		/*! \brief This method returns the time of the input frame.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\return				double			- frame time.
+		*	\since version 0.0.4
+		*/
+		double getFrameTime(int frame);
+
+		/*! \brief This method decodes the vertex positions of the input frame.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\param		[out]	positions		- pointer to numVertices * 3 floats.
+		*	\return				bool			- true if the frame was decoded, else false.
+		*	\since version 0.0.4
+		*/
+		bool getFrame(int frame, float* positions);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief mapped file.  */
+		zUtilsMappedFile file;
+
+		/*!	\brief file header.  */
+		zUtilsVertexCacheHeader header;
+
+		/*!	\brief container of frame index table entries.  */
+		vector<zUtilsFieldFrame> frames;
+
+		/*!	\brief quantized coordinates of the last decoded frame.  */
+		vector<int32_t> current;
+
+		/*!	\brief index of the last decoded frame, -1 if none.  */
+		int currentFrame;
+
+		/*!	\brief decoding buffers.  */
+		vector<uint32_t> packed;
+
+		/*!	\brief decoding buffers.  */
+		vector<unsigned char> shuffled;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method decodes the input frame in to the current quantized coordinates.
+		*
+		*	\param		[in]	frame			- frame index.
+		*	\return				bool			- true if the frame was decoded, else false.
+		*	\since version 0.0.4
+		*/
+		bool decodeFrame(int frame);
+	};
+
+	//--------------------------
+	//---- TEMPLATE METHODS INLINE DEFINITIONS
+	//--------------------------
+
+	template <typename F>
+	inline bool zUtilsPlyReader::walkRecords(zUtilsPlyElement &element, int propertyId, F func)
+	{
+		const char* data = file.getData();
+		const char* end = data + element.end;
+
+		vector<int> list;
+
+		if (format == zPlyASCII)
+		{
+			zUtilsTextCursor cursor(data + element.begin, end);
+
+			for (size_t i = 0; i < element.count; i++)
+			{
+				while (!cursor.atEnd() && cursor.atLineEnd()) cursor.skipLine();
+
+				for (int k = 0; k < (int)element.properties.size(); k++)
+				{
+					zUtilsPlyProperty &prop = element.properties[k];
+
+					int n = 1;
+					if (prop.countType != -1 && !cursor.readInt(n)) return false;
+					if (n < 0) return false;
+
+					list.clear();
+
+					for (int j = 0; j < n; j++)
+					{
+						if (k == propertyId)
+						{
+							double value;
+							if (!cursor.readDouble(value)) return false;
+
+							list.push_back((int)value);
+							if (prop.countType == -1) func(1, &list[0], value);
+						}
+						else
+						{
+							cursor.skipSpaces();
+							if (cursor.atLineEnd()) return false;
+							cursor.skipToken();
+						}
+					}
+
+					if (k == propertyId && prop.countType != -1) func(n, list.data(), 0.0);
+				}
+
+				cursor.skipLine();
+			}
+
+			return true;
+		}
+
+		bool swap = (format == zPlyBinaryBigEndian);
+		const char* ptr = data + element.begin;
+
+		for (size_t i = 0; i < element.count; i++)
+		{
+			for (int k = 0; k < (int)element.properties.size(); k++)
+			{
+				zUtilsPlyProperty &prop = element.properties[k];
+				size_t typeSize = getTypeSize(prop.type);
+
+				int n = 1;
+
+				if (prop.countType != -1)
+				{
+					size_t countSize = getTypeSize(prop.countType);
+					if (ptr + countSize > end) return false;
+
+					n = (int)decodeValue(ptr, prop.countType, swap);
+					ptr += countSize;
+				}
+
+				if (n < 0 || (size_t)(end - ptr) < (size_t)n * typeSize) return false;
+
+				if (k == propertyId)
+				{
+					if (prop.countType == -1)
+					{
+						double value = decodeValue(ptr, prop.type, swap);
+						int id = (int)value;
+						func(1, &id, value);
+					}
+					else
+					{
+						list.resize(n);
+						for (int j = 0; j < n; j++) list[j] = (int)decodeValue(ptr + j * typeSize, prop.type, swap);
+
+						func(n, list.data(), 0.0);
+					}
+				}
+
+				ptr += n * typeSize;
+			}
+		}
+
+		return true;
+	}
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsIO.cpp>
+#endif
+
+#endif
@@ -0,0 +1,256 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_IMAGEWRITER_H
+#define ZSPACE_UTILS_IMAGEWRITER_H
+
+#pragma once
+
+#include<headers/zCore/utilities/zUtilsCore.h>
+
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsImageWriter
+	*	\brief A background writer for image sequences in the PNG, JPEG and BMP file formats.
+	*	\details Frames are submitted to a bounded queue and encoded in parallel by a pool of worker threads. The files are written in submission order.
+	*	Submitting blocks while the number of frames not yet written equals the queue capacity, so memory stays bounded if encoding is slower than the caller.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsImageWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Overloaded constructor. The worker threads are started straight away.
+		*
+		*	\param		[in]	numWorkers		- number of encoding threads, values less than 1 use the number of hardware threads.
+		*	\param		[in]	_capacity		- maximum number of submitted frames not yet written.
+		*	\since version 0.0.4
+		*/
+		zUtilsImageWriter(int numWorkers = 0, int _capacity = 8);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Waits for all submitted frames to be written.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsImageWriter();
+
+		zUtilsImageWriter(const zUtilsImageWriter&) = delete;
+
+		zUtilsImageWriter& operator=(const zUtilsImageWriter&) = delete;
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method submits an image from the input matrices, with the same channel layout as zUtilsCore::matrixToPNG. The pixels are copied, so the matrices can be reused straight away.
+		*
+		*	\param		[in]	matrices		- input container of 1 to 4 matrices of equal size with values in the 0 - 1 range, as red, green, blue and alpha.
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	type			- zPNG, zJPEG or zBMP.
+		*	\return				bool			- true if the frame was submitted, else false.
+		*	\since version 0.0.4
+		*/
+		bool submit(vector<MatrixXf> &matrices, string path, zFileTpye type);
+
+		/*! \brief This method submits an image from RGBA pixels. The pixel container is swapped in to the writer and is empty on return.
+		*
+		*	\param		[in]	pixels			- 8 bit RGBA pixels, indexed by y * width + x.
+		*	\param		[in]	width			- image width.
+		*	\param		[in]	height			- image height.
+		*	\param		[in]	path			- output file path.
+		*	\param		[in]	type			- zPNG, zJPEG or zBMP.
+		*	\param		[in]	alpha			- true if the alpha channel is written to BMP files.
+		*	\return				bool			- true if the frame was submitted, else false.
+		*	\since version 0.0.4
+		*/
+		bool submit(vector<unsigned char> &pixels, int width, int height, string path, zFileTpye type, bool alpha = true);
+
+		/*! \brief This method blocks until all submitted frames are written.
+		*
+		*	\since version 0.0.4
+		*/
+		void flush();
+
+		/*! \brief This method writes all submitted frames and stops the worker threads. Later submits are rejected.
+		*
+		*	\since version 0.0.4
+		*/
+		void join();
+
+		/*! \brief This method returns the number of submitted frames not yet written.
+		*
+		*	\return				int				- number of pending frames.
+		*	\since version 0.0.4
+		*/
+		int numPending();
+
+		/*! \brief This method returns the number of frames which failed to encode or write.
+		*
+		*	\return				int				- number of failed frames.
+		*	\since version 0.0.4
+		*/
+		int numErrors();
+
+		/*! \brief This method converts the input matrices to RGBA pixels, with the same channel layout as zUtilsCore::matrixToPNG.
+		*
+		*	\param		[in]	matrices		- input container of 1 to 4 matrices of equal size.
+		*	\param		[out]	pixels			- 8 bit RGBA pixels, indexed by y * width + x.
+		*	\param		[out]	width			- image width, the number of matrix rows.
+		*	\param		[out]	height			- image height, the number of matrix columns.
+		*	\since version 0.0.4
+		*/
+		static void getPixels(vector<MatrixXf> &matrices, vector<unsigned char> &pixels, int &width, int &height);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*! \struct zImageFrame
+		*	\brief A submitted frame. The encoded file is either bytes or a bitmap.
+		*/
+		struct zImageFrame
+		{
+			int64_t sequence;
+			string path;
+			int type;
+			int width, height;
+			bool alpha;
+			bool valid;
+
+			vector<unsigned char> pixels;
+			vector<unsigned char> bytes;
+			unique_ptr<zUtilsBMP> bmp;
+		};
+
+		/*!	\brief maximum number of submitted frames not yet written.  */
+		int capacity;
+
+		/*!	\brief worker threads.  */
+		vector<thread> workers;
+
+		/*!	\brief frames waiting to be encoded.  */
+		deque<unique_ptr<zImageFrame>> queue;
+
+		/*!	\brief encoded frames waiting for the preceding frames to be written.  */
+		map<int64_t, unique_ptr<zImageFrame>> encoded;
+
+		/*!	\brief sequence number of the next submitted frame.  */
+		int64_t nextSubmit;
+
+		/*!	\brief sequence number of the next frame to write.  */
+		int64_t nextWrite;
+
+		/*!	\brief number of frames which failed to encode or write.  */
+		int errors;
+
+		/*!	\brief true while a worker writes the encoded frames.  */
+		bool writing;
+
+		/*!	\brief true once join was called.  */
+		bool stopping;
+
+		/*!	\brief lock of the queues and counters.  */
+		mutex lock;
+
+		/*!	\brief signals frames in the queue, or stopping, to the workers.  */
+		condition_variable queueSignal;
+
+		/*!	\brief signals written frames to submit and flush.  */
+		condition_variable writeSignal;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method adds the input frame to the queue, waiting for space if the writer is at capacity.
+		*
+		*	\param		[in]	frame			- frame to submit.
+		*	\return				bool			- true if the frame was submitted, else false.
+		*	\since version 0.0.4
+		*/
+		bool enqueue(unique_ptr<zImageFrame> &frame);
+
+		/*! \brief This method is executed by each worker thread, encoding frames until the writer is stopped.
+		*
+		*	\since version 0.0.4
+		*/
+		void work();
+
+		/*! \brief This method encodes the input frame in to its file bytes or bitmap.
+		*
+		*	\param		[in]	frame			- frame to encode.
+		*	\since version 0.0.4
+		*/
+		void encode(zImageFrame &frame);
+
+		/*! \brief This method writes the input encoded frame to disk.
+		*
+		*	\param		[in]	frame			- frame to write.
+		*	\since version 0.0.4
+		*/
+		void write(zImageFrame &frame);
+
+		/*! \brief This method returns the thread local buffer the JPEG encoder writes to.
+		*
+		*	\return				vector<unsigned char>*&		- pointer to the buffer of the calling thread.
+		*	\since version 0.0.4
+		*/
+		static vector<unsigned char>*& jpegBuffer();
+
+		/*! \brief This method appends a byte of the JPEG encoder to the thread local buffer.
+		*
+		*	\param		[in]	byte			- encoded byte.
+		*	\since version 0.0.4
+		*/
+		static void jpegWriteByte(unsigned char byte);
+	};
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsImageWriter.cpp>
+#endif
+
+#endif
@@ -16,6 +16,7 @@
 #pragma once
 
 #include<headers/zCore/base/zInline.h>
+#include<headers/zCore/utilities/zUtilsIO.h>
 
 #include <depends/nlohmann/json.hpp>
 using json = nlohmann::json;;
@@ -184,7 +185,318 @@ namespace zSpace
 				
 	};
 
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsJsonHEReader
+	*	\brief A streaming json reader for the half edge datastructure file format.
+	*	\details The file is memory mapped and parsed with the SAX interface of the JSON Modern Library. No json document is built, the known keys are collected in to flat arrays with a uniform row size, unknown keys are skipped.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsJsonHEReader : public nlohmann::json_sax<json>
+	{
+	public:
+		//--------------------------
+		//---- PUBLIC ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief container of vertex data, one half edge id per vertex.  */
+		zIntArray vertices;
+
+		/*!	\brief container of half edge data, halfedgeStride ids per half edge.  */
+		zIntArray halfedges;
+
+		/*!	\brief container of face data, one half edge id per face.  */
+		zIntArray faces;
+
+		/*!	\brief container of vertex attribute data, vertexAttributeStride values per vertex.  */
+		zDoubleArray vertexAttributes;
+
+		/*!	\brief container of half edge attribute data, halfedgeAttributeStride values per half edge.  */
+		zDoubleArray halfedgeAttributes;
+
+		/*!	\brief container of face attribute data, faceAttributeStride values per face.  */
+		zDoubleArray faceAttributes;
+
+		/*!	\brief number of values per half edge row, -1 if there are no rows.  */
+		int halfedgeStride;
+
+		/*!	\brief number of values per vertex attribute row, -1 if there are no rows.  */
+		int vertexAttributeStride;
+
+		/*!	\brief number of values per half edge attribute row, -1 if there are no rows.  */
+		int halfedgeAttributeStride;
+
+		/*!	\brief number of values per face attribute row, -1 if there are no rows.  */
+		int faceAttributeStride;
+
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Default constructor.
+		*
+		*	\since version 0.0.4
+		*/
+		zUtilsJsonHEReader();
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsJsonHEReader();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method reads the input json file in to the containers.
+		*
+		*	\param		[in]	path		- input file path.
+		*	\return				bool		- true if the file was parsed and matches the expected layout, else false. See getError.
+		*	\since version 0.0.4
+		*/
+		bool read(std::string path);
+
+		/*! \brief This method clears the containers, retaining their capacity.
+		*
+		*	\since version 0.0.4
+		*/
+		void clear();
+
+		/*! \brief This method returns the description of the last error.
+		*
+		*	\return				string		- error description, empty if there was no error.
+		*	\since version 0.0.4
+		*/
+		std::string getError();
+
+		//--------------------------
+		//---- SAX METHODS
+		//--------------------------
+
+		bool null() override;
+
+		bool boolean(bool val) override;
+
+		bool number_integer(number_integer_t val) override;
+
+		bool number_unsigned(number_unsigned_t val) override;
+
+		bool number_float(number_float_t val, const string_t &s) override;
+
+		bool string(string_t &val) override;
+
+		bool binary(binary_t &val) override;
+
+		bool start_object(std::size_t elements) override;
+
+		bool end_object() override;
+
+		bool start_array(std::size_t elements) override;
+
+		bool end_array() override;
+
+		bool key(string_t &val) override;
+
+		bool parse_error(std::size_t position, const std::string &last_token, const nlohmann::detail::exception &ex) override;
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief number of open objects and arrays.  */
+		int depth;
+
+		/*!	\brief integer container of the current key, nullptr if the key is not an integer key.  */
+		zIntArray* intTarget;
+
+		/*!	\brief double container of the current key, nullptr if the key is not a double key.  */
+		zDoubleArray* doubleTarget;
+
+		/*!	\brief row size of the current key, nullptr if the key holds a flat array.  */
+		int* strideTarget;
+
+		/*!	\brief number of values read in the current row.  */
+		int rowSize;
+
+		/*!	\brief description of the last error.  */
+		std::string error;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method adds a number to the container of the current key.
+		*
+		*	\param		[in]	value		- input value.
+		*	\param		[in]	integral	- true if the value was written as an integer.
+		*	\return				bool		- true if the value is valid at the current position, else false.
+		*	\since version 0.0.4
+		*/
+		bool addNumber(double value, bool integral);
+
+		/*! \brief This method returns true if the parser is inside the value of a known key.
+		*
+		*	\return				bool		- true if inside a known key.
+		*	\since version 0.0.4
+		*/
+		bool inKnownKey();
+	};
+
+
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsJsonWriter
+	*	\brief A streaming json writer.
+	*	\details Values are formatted in to a buffer which is flushed to the output stream in large blocks. Numbers are formatted the same as json::dump, so written files match the output of the JSON Modern Library. Keys are written as is and are not escaped.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsJsonWriter
+	{
+	public:
+		//--------------------------
+		//---- CONSTRUCTOR
+		//--------------------------
+
+		/*! \brief Overloaded constructor.
+		*
+		*	\param		[in]	_out		- output stream.
+		*	\since version 0.0.4
+		*/
+		zUtilsJsonWriter(ostream &_out);
+
+		//--------------------------
+		//---- DESTRUCTOR
+		//--------------------------
+
+		/*! \brief Default destructor. Flushes the remaining buffer.
+		*
+		*	\since version 0.0.4
+		*/
+		~zUtilsJsonWriter();
+
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method opens an object.
+		*
+		*	\since version 0.0.4
+		*/
+		void beginObject();
+
+		/*! \brief This method closes the current object.
+		*
+		*	\since version 0.0.4
+		*/
+		void endObject();
+
+		/*! \brief This method opens an array.
+		*
+		*	\since version 0.0.4
+		*/
+		void beginArray();
+
+		/*! \brief This method closes the current array.
+		*
+		*	\since version 0.0.4
+		*/
+		void endArray();
+
+		/*! \brief This method writes an object key. The next call writes its value.
+		*
+		*	\param		[in]	name		- key name.
+		*	\since version 0.0.4
+		*/
+		void key(const char* name);
+
+		/*! \brief This method writes an integer value.
+		*
+		*	\param		[in]	value		- input value.
+		*	\since version 0.0.4
+		*/
+		void value(int value);
+
+		/*! \brief This method writes a double value. Non finite values are written as null.
+		*
+		*	\param		[in]	value		- input value.
+		*	\since version 0.0.4
+		*/
+		void value(double value);
+
+		/*! \brief This method writes the buffer to the output stream.
+		*
+		*	\return				bool		- true if the stream is in a good state after writing, else false.
+		*	\since version 0.0.4
+		*/
+		bool flush();
+
+	protected:
+		//--------------------------
+		//---- PROTECTED ATTRIBUTES
+		//--------------------------
+
+		/*!	\brief output stream.  */
+		ostream* out;
+
+		/*!	\brief text buffer.  */
+		zUtilsTextWriter buffer;
+
+		/*!	\brief stack of open objects and arrays, true if no element has been written to it yet.  */
+		vector<bool> firstElement;
+
+		/*!	\brief true if a key was written and its value is pending.  */
+		bool afterKey;
+
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method writes the separator before a new element, and flushes the buffer if it is full.
+		*
+		*	\since version 0.0.4
+		*/
+		void beginElement();
+	};
+
 }
 
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsJson.cpp>
+#endif
 
 #endif
\ No newline at end of file
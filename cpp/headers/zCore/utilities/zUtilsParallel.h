@@ -0,0 +1,203 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#ifndef ZSPACE_UTILS_PARALLEL_H
+#define ZSPACE_UTILS_PARALLEL_H
+
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <algorithm>
+
+#include<headers/zCore/base/zInline.h>
+
+using namespace std;
+
+namespace zSpace
+{
+	/** \addtogroup zCore
+	*	\brief The core datastructures of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zUtilities
+	*	\brief The utility classes and structs of the library.
+	*  @{
+	*/
+
+	/*! \class zUtilsParallel
+	*	\brief A utility class to split loops over the hardware threads.
+	*	\details Work is split in contiguous ranges, one per thread, with the last range running on the calling thread. Calls made from inside a parallel loop run serially on the calling thread.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+
+	/** @}*/
+
+	class ZSPACE_CORE zUtilsParallel
+	{
+	public:
+		//--------------------------
+		//---- METHODS
+		//--------------------------
+
+		/*! \brief This method returns the number of threads used by the parallel loops.
+		*
+		*	\return				int			- number of threads.
+		*	\since version 0.0.4
+		*/
+		static int getNumThreads();
+
+		/*! \brief This method sets the number of threads used by the parallel loops.
+		*
+		*	\param		[in]	numThreads	- number of threads. Values less than 1 reset to the number of hardware threads.
+		*	\since version 0.0.4
+		*/
+		static void setNumThreads(int numThreads);
+
+		/*! \brief This method returns true if the calling thread is executing a parallel loop.
+		*
+		*	\return				bool		- true if inside a parallel loop.
+		*	\since version 0.0.4
+		*/
+		static bool inParallelRegion();
+
+		/*! \brief This method splits the input index range in contiguous sub ranges and executes them in parallel.
+		*
+		*	\tparam				F			- callable with signature void(int start, int end, int threadId).
+		*	\param		[in]	begin		- start index of the range.
+		*	\param		[in]	end			- end index of the range (exclusive).
+		*	\param		[in]	func		- callable executed per sub range.
+		*	\param		[in]	grain		- minimum number of indicies per sub range.
+		*	\since version 0.0.4
+		*/
+		template <typename F>
+		static void forRange(int begin, int end, F func, int grain = 1);
+
+		/*! \brief This method executes the input callable for every index of the input range in parallel.
+		*
+		*	\tparam				F			- callable with signature void(int index).
+		*	\param		[in]	begin		- start index of the range.
+		*	\param		[in]	end			- end index of the range (exclusive).
+		*	\param		[in]	func		- callable executed per index.
+		*	\param		[in]	grain		- minimum number of indicies per thread.
+		*	\since version 0.0.4
+		*/
+		template <typename F>
+		static void forEach(int begin, int end, F func, int grain = 1);
+
+		/*! \brief This method returns the number of sub ranges forRange would split the input number of indicies into.
+		*
+		*	\param		[in]	numIndicies	- number of indicies.
+		*	\param		[in]	grain		- minimum number of indicies per sub range.
+		*	\return				int			- number of sub ranges.
+		*	\since version 0.0.4
+		*/
+		static int getNumRanges(int numIndicies, int grain = 1);
+
+	protected:
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method returns the flag marking the calling thread as a parallel worker.
+		*
+		*	\return				bool&		- thread local flag.
+		*	\since version 0.0.4
+		*/
+		static bool& workerFlag();
+
+		/*! \brief This method returns the configured number of threads, 0 for hardware threads.
+		*
+		*	\return				int&		- thread count.
+		*	\since version 0.0.4
+		*/
+		static int& threadCount();
+	};
+
+	//--------------------------
+	//---- TEMPLATE METHODS INLINE DEFINITIONS
+	//--------------------------
+
+	template <typename F>
+	inline void zUtilsParallel::forRange(int begin, int end, F func, int grain)
+	{
+		int n = end - begin;
+		if (n <= 0) return;
+
+		int numRanges = (inParallelRegion()) ? 1 : getNumRanges(n, grain);
+
+		if (numRanges <= 1)
+		{
+			func(begin, end, 0);
+			return;
+		}
+
+		exception_ptr error = nullptr;
+		mutex errorLock;
+
+		auto runRange = [&](int t)
+		{
+			int start = begin + (int)(((long long)n * t) / numRanges);
+			int stop = begin + (int)(((long long)n * (t + 1)) / numRanges);
+
+			bool &flag = workerFlag();
+			bool prev = flag;
+			flag = true;
+
+			try
+			{
+				func(start, stop, t);
+			}
+			catch (...)
+			{
+				lock_guard<mutex> lock(errorLock);
+				if (!error) error = current_exception();
+			}
+
+			flag = prev;
+		};
+
+		vector<thread> workers;
+		workers.reserve(numRanges - 1);
+
+		for (int t = 0; t < numRanges - 1; t++) workers.push_back(thread(runRange, t));
+
+		runRange(numRanges - 1);
+
+		for (auto &w : workers) w.join();
+
+		if (error) rethrow_exception(error);
+	}
+
+	template <typename F>
+	inline void zUtilsParallel::forEach(int begin, int end, F func, int grain)
+	{
+		forRange(begin, end, [&](int start, int stop, int /*threadId*/)
+		{
+			for (int i = start; i < stop; i++) func(i);
+		}, grain);
+	}
+
+}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+// All defined OK so do nothing
+#else
+#include<source/zCore/utilities/zUtilsParallel.cpp>
+#endif
+
+#endif
@@ -70,6 +70,12 @@ namespace zSpace
 
 		/*!	\brief core utilities Object  */
 		zUtilsCore coreUtils;
+
+		/*!	\brief number of significant digits of floating point values in text file exports  */
+		int filePrecision;
+
+		/*!	\brief true if positions are quantized in binary file exports  */
+		bool fileQuantization;
 		
 
 	public:
@@ -286,6 +292,20 @@ namespace zSpace
 		*	\since version 0.0.2
 		*/
 		virtual void setPivot(zVector &pivot) = 0;
+
+		/*! \brief This method sets the number of significant digits of floating point values in text file exports.
+		*
+		*	\param [in]		precision			- number of significant digits. Default set to 6, the same as the default iostream precision.
+		*	\since version 0.0.4
+		*/
+		void setFilePrecision(int precision);
+
+		/*! \brief This method sets if positions are quantized to 16 bits per axis over the object bounds in binary file exports (zMESH, zGRAPH).
+		*
+		*	\param [in]		quantize			- true to quantize positions. Default set to false.
+		*	\since version 0.0.4
+		*/
+		void setFileQuantization(bool quantize);
 	
 		//--------------------------
 		//---- GET METHODS
@@ -297,6 +317,20 @@ namespace zSpace
 		*/
 		virtual  void getTransform(zTransform &transform) = 0;
 
+		/*! \brief This method gets the number of significant digits of floating point values in text file exports.
+		*
+		*	\return			int					- number of significant digits.
+		*	\since version 0.0.4
+		*/
+		int getFilePrecision();
+
+		/*! \brief This method gets if positions are quantized in binary file exports.
+		*
+		*	\return			bool				- true if positions are quantized.
+		*	\since version 0.0.4
+		*/
+		bool getFileQuantization();
+
 		//--------------------------
 		//---- TRANSFORMATION METHODS
 		//--------------------------
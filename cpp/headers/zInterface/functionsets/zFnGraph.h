@@ -463,6 +463,31 @@ namespace zSpace
 
 		void getTransform(zTransform &transform) override;
 
+		//--------------------------
+		//---- DATABASE METHODS
+		//--------------------------
+
+		/*! \brief This method stores the graph in a geometry table of the input database as a binary zGRAPH blob, with its bounds. The table is created if it does not exist.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id, an existing geometry with the same id is replaced.
+		*	\return				bool				- true if the graph was stored, else false.
+		*	\since version 0.0.4
+		*/
+		bool to(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method loads the graph from a zGRAPH blob in a geometry table of the input database.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\param		[in]	staticGeom			- true if the static containers need to be set.
+		*	\return				bool				- true if the graph was loaded, else false.
+		*	\since version 0.0.4
+		*/
+		bool from(zDatabase &database, string tableName, int64_t id, bool staticGeom = false);
+
 	protected:
 
 		//--------------------------
@@ -501,7 +526,8 @@ namespace zSpace
 		*/
 		bool fromMAYATXT(string infilename);
 
-		/*! \brief This method imports zGraph from a JSON file format using JSON Modern Library.
+		/*! \brief This method imports zGraph from a JSON file format.
+		*	\details The file is memory mapped and parsed with zUtilsJsonHEReader in to flat arrays, without building a json document.
 		*
 		*	\param [in]		inGraph				- graph created from the JSON file.
 		*	\param [in]		infilename			- input file name including the directory path and extension.
@@ -510,16 +536,38 @@ namespace zSpace
 		*/
 		bool fromJSON(string infilename);
 
+		/*! \brief This method imports zGraph from the binary zGRAPH file format.
+		*	\details The file is memory mapped and the blocks are copied in to the graph containers without parsing.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromGRAPH(string infilename);
+
+		/*! \brief This method rebuilds the graph topology from flat half edge arrays, as stored by the zJSON and zGRAPH file formats. The attribute containers are left empty.
+		*
+		*	\param [in]		vertexData			- half edge id per vertex, -1 if none.
+		*	\param [in]		nV					- number of vertices.
+		*	\param [in]		halfEdgeData		- previous, next and vertex id per half edge, -1 if none.
+		*	\param [in]		nHE					- number of half edges.
+		*	\return 		bool				- true if the ids are in range and the graph was rebuilt, else false and the graph is unchanged.
+		*	\since version 0.0.4
+		*/
+		bool setHalfEdgeTopology(const int* vertexData, int nV, const int* halfEdgeData, int nHE);
+
 
 		/*! \brief This method exports zGraph to a TXT file format.
 		*
 		*	\param [in]		inGraph				- input graph.
 		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\details Floating point values are written at the function set file precision, see setFilePrecision.
 		*	\since version 0.0.2
 		*/
 		void toTXT(string outfilename);
 
-		/*! \brief This method exports zGraph to a JSON file format using JSON Modern Library.
+		/*! \brief This method exports zGraph to a JSON file format.
+		*	\details The file is streamed with zUtilsJsonWriter without building a json document. The output matches json::dump of the to method.
 		*
 		*	\param [in]		inGraph				- input graph.
 		*	\param [in]		outfilename			- output file name including the directory path and extension.
@@ -528,6 +576,32 @@ namespace zSpace
 		*/
 		void toJSON(string outfilename);
 
+		/*! \brief This method exports zGraph to the binary zGRAPH file format.
+		*	\details The half edge arrays, positions and attributes are written as aligned little endian blocks. Positions are quantized to 16 bits per axis if set, see setFileQuantization.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toGRAPH(string outfilename);
+
+		/*! \brief This method writes zGraph in the binary zGRAPH format to a file or to a buffer.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension, used for messages if writing to a buffer.
+		*	\param [out]	buffer				- output buffer, nullptr to write the file.
+		*	\return 		bool				- true if the data was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool writeGRAPH(string outfilename, vector<unsigned char>* buffer);
+
+		/*! \brief This method reads zGraph from the binary zGRAPH format of the input reader.
+		*
+		*	\param [in]		reader				- reader opened on a zGRAPH file or buffer.
+		*	\param [in]		infilename			- input name, used for messages.
+		*	\return 		bool				- true if the data was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool readGRAPH(zUtilsBinaryReader &reader, string infilename);
+
 	private:
 
 		//--------------------------
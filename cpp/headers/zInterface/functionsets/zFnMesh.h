@@ -24,6 +24,8 @@
 #include<headers/zInterface/functionsets/zFn.h>
 #include<headers/zInterface/iterators/zItMesh.h>
 
+#include<headers/zCore/data/zDatabase.h>
+
 #include <igl/avg_edge_length.h>
 #include <igl/cotmatrix.h>
 #include <igl/invert_diag.h>
@@ -1099,6 +1101,31 @@ namespace zSpace
 
 		void getTransform(zTransform &transform) override;
 
+		//--------------------------
+		//---- DATABASE METHODS
+		//--------------------------
+
+		/*! \brief This method stores the mesh in a geometry table of the input database as a binary zMESH blob, with its bounds. The table is created if it does not exist.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id, an existing geometry with the same id is replaced.
+		*	\return				bool				- true if the mesh was stored, else false.
+		*	\since version 0.0.4
+		*/
+		bool to(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method loads the mesh from a zMESH blob in a geometry table of the input database.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\param		[in]	staticGeom			- true if the static containers need to be set.
+		*	\return				bool				- true if the mesh was loaded, else false.
+		*	\since version 0.0.4
+		*/
+		bool from(zDatabase &database, string tableName, int64_t id, bool staticGeom = false);
+
 	protected:
 
 		//--------------------------
@@ -1113,18 +1140,37 @@ namespace zSpace
 		/*! \brief This method exports zMesh as an OBJ file.
 		*
 		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\details Floating point values are written at the function set file precision, see setFilePrecision.
 		*	\since version 0.0.2
 		*/
 		void toOBJ(string outfilename);
 
-		/*! \brief This method exports zMesh to a JSON file format using JSON Modern Library.
+		/*! \brief This method exports zMesh to a JSON file format.
+		*	\details The file is streamed with zUtilsJsonWriter without building a json document. The output matches json::dump of the to method.
 		*
 		*	\param [in]		outfilename			- output file name including the directory path and extension.
 		*	\since version 0.0.2
 		*/
 		void toJSON(string outfilename);
 
+		/*! \brief This method exports zMesh to the binary zMESH file format.
+		*	\details The half edge arrays, positions and attributes are written as aligned little endian blocks. Positions are quantized to 16 bits per axis if set, see setFileQuantization.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toMESH(string outfilename);
+
+		/*! \brief This method exports zMesh to the PLY file format, with vertex normals and colors.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\param [in]		format				- body format - zPlyFormat. Floating point values of ascii bodies are written at the function set file precision.
+		*	\since version 0.0.4
+		*/
+		void toPLY(string outfilename, int format);
+
 		/*! \brief This method imports zMesh from an OBJ file.
+		*	\details The file is memory mapped and parsed in parallel chunks. Supports v, vn and f records with v, v/vt, v//vn and v/vt/vn corners and negative indicies. Face normals are averaged from the corner normals if present, else computed.
 		*
 		*	\param	[in]		infilename			- input file name including the directory path and extension.
 		*	\return 			bool				- true if the file was read succesfully.
@@ -1132,7 +1178,8 @@ namespace zSpace
 		*/
 		bool fromOBJ(string infilename);
 
-		/*! \brief This method imports zMesh from a JSON file format using JSON Modern Library.
+		/*! \brief This method imports zMesh from a JSON file format.
+		*	\details The file is memory mapped and parsed with zUtilsJsonHEReader in to flat arrays, without building a json document.
 		*
 		*	\param [in]		infilename			- input file name including the directory path and extension.
 		*	\return 		bool			- true if the file was read succesfully.
@@ -1140,6 +1187,55 @@ namespace zSpace
 		*/
 		bool fromJSON(string infilename);
 
+		/*! \brief This method imports zMesh from the binary zMESH file format.
+		*	\details The file is memory mapped and the blocks are copied in to the mesh containers without parsing.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromMESH(string infilename);
+
+		/*! \brief This method imports zMesh from an ascii or binary PLY file. Vertex normals and colors are read if present.
+		*	\details The file is memory mapped and fixed size binary vertex records are converted in parallel straight in to the mesh containers.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromPLY(string infilename);
+
+		/*! \brief This method writes zMesh in the binary zMESH format to a file or to a buffer.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension, used for messages if writing to a buffer.
+		*	\param [out]	buffer				- output buffer, nullptr to write the file.
+		*	\return 		bool				- true if the data was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool writeMESH(string outfilename, vector<unsigned char>* buffer);
+
+		/*! \brief This method reads zMesh from the binary zMESH format of the input reader.
+		*
+		*	\param [in]		reader				- reader opened on a zMESH file or buffer.
+		*	\param [in]		infilename			- input name, used for messages.
+		*	\return 		bool				- true if the data was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool readMESH(zUtilsBinaryReader &reader, string infilename);
+
+		/*! \brief This method rebuilds the mesh topology from flat half edge arrays, as stored by the zJSON and zMESH file formats. The attribute containers are left empty.
+		*
+		*	\param [in]		vertexData			- half edge id per vertex, -1 if none.
+		*	\param [in]		nV					- number of vertices.
+		*	\param [in]		halfEdgeData		- previous, next, vertex and face id per half edge, -1 if none.
+		*	\param [in]		nHE					- number of half edges.
+		*	\param [in]		faceData			- half edge id per face, -1 if none.
+		*	\param [in]		nF					- number of faces.
+		*	\return 		bool				- true if the ids are in range and the mesh was rebuilt, else false and the mesh is unchanged.
+		*	\since version 0.0.4
+		*/
+		bool setHalfEdgeTopology(const int* vertexData, int nV, const int* halfEdgeData, int nHE, const int* faceData, int nF);
+
 		//--------------------------
 		//---- PROTECTED CONTOUR METHODS
 		//--------------------------
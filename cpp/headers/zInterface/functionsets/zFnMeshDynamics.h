@@ -342,6 +342,39 @@ namespace zSpace
 		*/
 		void update(double dT, zIntergrationType type = zEuler, bool clearForce = true, bool clearVelocity = false, bool clearDerivatives = false);
 
+		//--------------------------
+		//---- CACHE METHODS 
+		//--------------------------
+
+		/*! \brief This method opens the input writer for a vertex animation cache of the mesh, storing its topology once.
+		*
+		*	\param		[out]	writer				- vertex cache writer.
+		*	\param		[in]	path				- output file name including the directory path and extension.
+		*	\param		[in]	quantization		- quantization step of the vertex coordinates, the maximum position error is half the step.
+		*	\param		[in]	keyFrameInterval	- number of frames between frames which do not depend on the previous frame, the cost of random access.
+		*	\return				bool				- true if the file was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool openCache(zUtilsVertexCacheWriter &writer, string path, double quantization = 0.0001, int keyFrameInterval = 30);
+
+		/*! \brief This method appends the current vertex positions as a frame to the input writer. Typically called after each update.
+		*
+		*	\param		[in]	writer				- vertex cache writer, opened with openCache.
+		*	\param		[in]	time				- time of the frame.
+		*	\return				bool				- true if the frame was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool writeCacheFrame(zUtilsVertexCacheWriter &writer, double time = 0.0);
+
+		/*! \brief This method sets the vertex positions to a frame of the input reader. If the vertex count does not match the cache, the mesh is recreated from the cached topology and the particles are cleared, so makeDynamic needs to be called before simulating again.
+		*
+		*	\param		[in]	reader				- vertex cache reader.
+		*	\param		[in]	frame				- frame index.
+		*	\return				bool				- true if the frame was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readCacheFrame(zUtilsVertexCacheReader &reader, int frame);
+
 	};
 }
 
@@ -27,6 +27,8 @@
 #include<headers/zInterface/iterators/zItMeshField.h>
 
 #include<headers/zCore/utilities/zUtilsBMP.h>
+#include<headers/zCore/utilities/zUtilsImageWriter.h>
+#include<headers/zCore/field/zFieldExpression.h>
 
 namespace zSpace
 {
@@ -160,6 +162,16 @@ namespace zSpace
 		*/
 		void to(string path, zFileTpye type);
 
+		/*! \brief This method submits the field colors as an image to the input background writer, so the caller does not wait for the image to be encoded and written.
+		*
+		*	\param [in]		path			- output file name including the directory path and extension.
+		*	\param [in]		type			- type of file to be exported - zBMP, zPNG or zJPEG.
+		*	\param [in]		writer			- background image writer.
+		*	\since version 0.0.4
+		*	\warning	works only with scalar fields
+		*/
+		void to(string path, zFileTpye type, zUtilsImageWriter &writer);
+
 		/*! \brief This method clears the dynamic and array memory the object holds.
 		*
 		*	\param [out]		minBB			- output minimum bounding box.
@@ -209,6 +221,13 @@ namespace zSpace
 		*/
 		void createVectorFromScalarField(zObjMeshField<zScalar> &scalarFieldObj);
 
+		/*! \brief This method builds the KD-tree of the field value positions, used by the closest index constructors of the field iterators.
+		*
+		*	\details The create methods build it. It has to be called again after the field mesh is transformed.
+		*	\since version 0.0.4
+		*/
+		void computeKDTree();
+
 		//--------------------------
 		//---- QUERIES
 		//--------------------------
@@ -298,6 +317,27 @@ namespace zSpace
 		*/
 		bool getScalarValue(zScalarArray &scalars, zPoint& samplePos, zFieldValueType type, zScalar& fieldValue);
 
+		/*! \brief This method gets the bilinear interpolated values of the field at the input sample positions, in parallel over batches of samples.
+		*
+		*	\details The samples are interpolated between the four closest field values on the field grid. Samples outside the field are clamped to it.
+		*	\param		[in]	samplePositions	- input sample positions.
+		*	\param		[out]	fieldValues		- output field value per sample.
+		*	\param		[out]	inBounds		- true per sample if the sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		void getFieldValues_Bilinear(zPointArray &samplePositions, vector<T> &fieldValues, zBoolArray &inBounds);
+
+		/*! \brief This method gets the bilinear interpolated values and gradients of the scalar field at the input sample positions, in parallel over batches of samples.
+		*
+		*	\details The gradients are the derivatives of the bilinear interpolation.
+		*	\param		[in]	samplePositions	- input sample positions.
+		*	\param		[out]	fieldValues		- output field value per sample.
+		*	\param		[out]	gradients		- output gradient per sample.
+		*	\param		[out]	inBounds		- true per sample if the sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		void getFieldValues_Bilinear(zPointArray &samplePositions, zScalarArray &fieldValues, zVectorArray &gradients, zBoolArray &inBounds);
+
 		/*! \brief This method gets all the values of the field.
 		*
 		*	\param		[out]	fieldValues			- container of field values.		
@@ -381,6 +421,78 @@ namespace zSpace
 		*/
 		void setFieldValues(vector<T>& fValues, zFieldColorType type = zFieldColorType::zFieldRegular, float sdfWidth = 0.1);
 
+		//--------------------------
+		//---- FIELD FRAME METHODS
+		//--------------------------
+
+		/*! \brief This method opens the input writer for a zFIELD time series of the field, with its resolution, units and bounds.
+		*
+		*	\param		[out]	writer				- field file writer.
+		*	\param		[in]	path				- output file name including the directory path and extension.
+		*	\param		[in]	precision			- value precision - zFieldFloat32 or zFieldFloat16.
+		*	\param		[in]	compress			- true if the frames are delta encoded and compressed.
+		*	\param		[in]	keyFrameInterval	- number of frames between frames which do not depend on the previous frame, the cost of random access.
+		*	\return				bool				- true if the file was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool openFieldWriter(zUtilsFieldWriter &writer, string path, zFieldPrecision precision = zFieldFloat32, bool compress = true, int keyFrameInterval = 16);
+
+		/*! \brief This method appends the current field values as a frame to the input writer.
+		*
+		*	\param		[in]	writer				- field file writer, opened with openFieldWriter.
+		*	\param		[in]	time				- time of the frame.
+		*	\return				bool				- true if the frame was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool writeFieldFrame(zUtilsFieldWriter &writer, double time = 0.0);
+
+		/*! \brief This method reads the values of a frame of the input reader straight in to the field values. The field is recreated if its resolution does not match the file.
+		*
+		*	\param		[in]	reader				- field file reader.
+		*	\param		[in]	frame				- frame index.
+		*	\return				bool				- true if the frame was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldFrame(zUtilsFieldReader &reader, int frame);
+
+		//--------------------------
+		//---- DATABASE METHODS
+		//--------------------------
+
+		/*! \brief This method stores the field in a geometry table of the input database, with its bounds. The table is created if it does not exist.
+		*	\details The blob is a zFIELD header followed by the uncompressed 32 bit field values, so ranges of values can be read without loading the blob.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id, an existing geometry with the same id is replaced.
+		*	\return				bool				- true if the field was stored, else false.
+		*	\since version 0.0.4
+		*/
+		bool to(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method loads the field values from a geometry table of the input database. The field is recreated if its resolution does not match the stored field.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\return				bool				- true if the field was loaded, else false.
+		*	\since version 0.0.4
+		*/
+		bool from(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method reads a range of the values of a field stored in a geometry table of the input database, without loading the rest of the field.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\param		[in]	startIndex			- index of the first value.
+		*	\param		[in]	numValues			- number of values.
+		*	\param		[out]	values				- container of values.
+		*	\return				bool				- true if the values were read, else false.
+		*	\since version 0.0.4
+		*/
+		bool getFieldValues(zDatabase &database, string tableName, int64_t id, int startIndex, int numValues, vector<T> &values);
+
 		//--------------------------
 		//----  2D IDW FIELD METHODS
 		//--------------------------
@@ -393,9 +505,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values as inverse weighted distance from the input graph vertex positions.
 		*
@@ -405,9 +518,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 	
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -417,9 +531,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -429,9 +544,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -441,9 +557,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
@@ -454,9 +571,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		//--------------------------
 		//----  2D SCALAR FIELD METHODS
@@ -636,6 +754,16 @@ namespace zSpace
 		*/
 		void getScalars_Trapezoid(zScalarArray &scalars, float r1, float r2, float he, float annularVal = 0, bool normalise = true);
 
+		/*! \brief This method gets the scalars of a field expression, evaluated in one parallel pass over the field without intermediate scalars.
+		*
+		*	\param	[out]	scalars			- container for storing scalar values.
+		*	\param	[in]	expression		- input field expression.
+		*	\param	[in]	nodeId			- index of the expression node to evaluate, -1 for the last node added.
+		*	\param	[in]	normalise		- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\since version 0.0.4
+		*/
+		void getScalars_Expression(zScalarArray &scalars, zFieldExpression &expression, int nodeId = -1, bool normalise = true);
+
 		//--------------------------
 		//--- COMPUTE METHODS 
 		//--------------------------
@@ -681,13 +809,15 @@ namespace zSpace
 		
 		/*! \brief This method avarages / smoothens the field values.
 		*
+		*	\details The 3x3 stencil is applied row by row in parallel, alternating between two buffers.
 		* 	\param		[out]	scalars				- container for storing scalar values.
 		*	\param		[in]	numSmooth			- number of times to smooth.
 		*	\param		[in]	diffuseDamp			- damping value of the averaging.
 		*	\param		[in]	type				- smooth type - zlaplacian / zAverage.
+		*	\param		[in]	blockSteps			- number of smoothing steps per pass over the field. Each tile of rows is smoothed blockSteps times in cache, recomputing blockSteps rows on either side.
 		*	\since version 0.0.2
 		*/
-		void smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage);
+		void smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage, int blockSteps = 1);
 
 		/*! \brief This method computes the field index of each input position and stores them in a container per field index.
 		*
@@ -873,6 +1003,40 @@ namespace zSpace
 		*/
 		void createFieldMesh();
 
+		/*! \brief This method reads the values of a frame of the input reader straight in to the field values, recreating the field if its resolution does not match the file.
+		*
+		*	\param		[in]	reader				- field file reader.
+		*	\param		[in]	frame				- frame index.
+		*	\return				bool				- true if the frame was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldValues(zUtilsFieldReader &reader, int frame);
+
+		/*! \brief This method reads the values of a field stored in a geometry table of the input database straight in to the field values, recreating the field if its resolution does not match.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\return				bool				- true if the values were read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldValues(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method sets the resolution, units, bounds and number of values of the input zFIELD header from the field.
+		*
+		*	\param		[out]	header				- field header.
+		*	\since version 0.0.4
+		*/
+		void getFieldHeader(zUtilsFieldHeader &header);
+
+		/*! \brief This method checks the input zFIELD header against the field, recreating the field if its resolution does not match.
+		*
+		*	\param		[in]	header				- field header.
+		*	\return				bool				- true if the field matches the header, else false.
+		*	\since version 0.0.4
+		*/
+		bool setFieldHeader(const zUtilsFieldHeader &header);
+
 		//--------------------------
 		//---- PROTECTED METHODS
 		//--------------------------
@@ -975,6 +1139,82 @@ namespace zSpace
 		*/
 		int getIsobandCase(int vertexTernary[4]);
 
+		/*! \brief This method computes the inverse distance weighted field values of all field vertices in parallel over tiles of field vertices.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values, resized to the number of field vertices.
+		*	\param	[in]	inPositions			- input positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	values				- value of each input position, nullptr to use value for all.
+		*	\param	[in]	value				- value of all input positions.
+		*	\param	[in]	influences			- influence of each input position, nullptr to use influence for all.
+		*	\param	[in]	influence			- influence of all input positions.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	closestOnly			- true if only the input positions closer than all previous ones set the value, as for mesh and graph inputs.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, negative for the exact IDW.
+		*	\since version 0.0.4
+		*/
+		void computeFieldValues_IDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T *values, T value, double *influences, double influence, double power, bool closestOnly, double cutoff);
+
+		/*! \brief This method computes the distance of every field vertex to the closest input position or segment.
+		*
+		*	\details The sources are rasterized to the closest field vertex, and a separable distance transform over the field grid finds the closest rasterized vertex in O(cells).
+		*	Within a band of a few cells of the sources all sources that can be closer are checked, so the distances there are exact. Further away the distance is to the sources of the closest rasterized vertex, within a cell size of the exact one.
+		*	Field meshes which are no longer on the field grid fall back to checking every source.
+		*	\param	[out]	distances			- container of distances per field vertex, maximum double if there are no sources.
+		*	\param	[in]	inPositions			- input positions.
+		*	\param	[in]	inEdges				- input segments as pairs of indicies in to inPositions, empty if the positions are the sources.
+		*	\since version 0.0.4
+		*/
+		void computeDistances_EDT(zDoubleArray &distances, zPointArray &inPositions, zIntArray &inEdges);
+
+		/*! \brief This method computes the 1D squared distance transform of the input samples.
+		*
+		*	\details based on Felzenszwalb and Huttenlocher, Distance Transforms of Sampled Functions. http://cs.brown.edu/people/pfelzens/dt/
+		*	\param	[in]	f					- input samples, maximum double for samples without a source.
+		*	\param	[in]	n					- number of samples.
+		*	\param	[in]	unitSq				- squared distance between two samples.
+		*	\param	[out]	d					- squared distance per sample.
+		*	\param	[out]	nearest				- index of the sample the distance is measured to, -1 if there are no sources.
+		*	\param	[in]	v					- work container of size n.
+		*	\param	[in]	z					- work container of size n + 1.
+		*	\since version 0.0.4
+		*/
+		void getDistanceTransform_1D(const double *f, int n, double unitSq, double *d, int *nearest, int *v, double *z);
+
+		/*! \brief This method sets the scalars as the input distances minus the offset.
+		*
+		*	\param	[out]	scalars				- container for storing scalar values.
+		*	\param	[in]	distances			- input distances per field vertex.
+		*	\param	[in]	offset				- input distance variable.
+		*	\since version 0.0.4
+		*/
+		void setOffsetDistances(zScalarArray &scalars, zDoubleArray &distances, float offset);
+
+		/*! \brief This method smooths the input rows of the field once.
+		*
+		*	\param	[in]	inValues			- input values, starting at row offsetX.
+		*	\param	[out]	outValues			- output values, starting at row offsetX.
+		*	\param	[in]	offsetX				- row of the first value of the containers.
+		*	\param	[in]	startX				- first row to smooth.
+		*	\param	[in]	endX				- end of the rows to smooth (exclusive).
+		*	\param	[in]	diffuseDamp			- damping value of the averaging.
+		*	\param	[in]	type				- smooth type - zlaplacian / zAverage.
+		*	\since version 0.0.4
+		*/
+		void computeSmoothRows(const zScalar *inValues, zScalar *outValues, int offsetX, int startX, int endX, double diffuseDamp, zDiffusionType type);
+
+		/*! \brief This method gets the field grid cells and interpolation parameters of a batch of sample positions.
+		*
+		*	\param	[in]	samplePositions		- input sample positions.
+		*	\param	[in]	numSamples			- number of sample positions.
+		*	\param	[out]	ids					- index of the lower corner of the cell per sample.
+		*	\param	[out]	tX					- interpolation parameter in X per sample.
+		*	\param	[out]	tY					- interpolation parameter in Y per sample.
+		*	\param	[out]	inBounds			- 1 per sample if the sample position is within bounds, else 0.
+		*	\since version 0.0.4
+		*/
+		void getSampleCells_Bilinear(zPoint *samplePositions, int numSamples, int *ids, float *tX, float *tY, char *inBounds);
+
 		/*! \brief This method return the contour position  given 2 input positions at the input field threshold.
 		*
 		*	\param	[in]	threshold		- field threshold.
@@ -16,6 +16,7 @@
 #pragma once
 
 #include<headers/zInterface/objects/zObjPointCloud.h>
+#include<headers/zCore/geometry/zPointCloudStore.h>
 #include<headers/zInterface/functionsets/zFn.h>
 #include<headers/zInterface/iterators/zItPointCloud.h>
 
@@ -117,6 +118,40 @@ namespace zSpace
 		*/
 		void create(zPointArray(&_positions));
 
+		/*! \brief This method creates the point cloud from a delimited text file of points.
+		*	\details The file is memory mapped and split in line aligned chunks which are parsed in parallel with std::from_chars.
+		*
+		*	\param		[in]	infilename		- input file name including the directory path and extension.
+		*	\param		[in]	layout			- column mapping of positions, colors and additional scalars.
+		*	\param		[out]	scalarColumns	- per vertex values of the scalar columns of the layout, one container per column.
+		*	\return				bool			- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool createFromCSV(string infilename, zUtilsCSVLayout &layout, vector<zDoubleArray> &scalarColumns);
+
+		/*! \brief This method creates the point cloud from the points of an out of core store inside the input box, up to the input level of detail.
+		*	\details Only the tiles of the nodes intersecting the box are mapped, so the whole store is never loaded.
+		*
+		*	\param		[in]	store			- readable point cloud store.
+		*	\param		[in]	minBB			- minimum corner of the crop box.
+		*	\param		[in]	maxBB			- maximum corner of the crop box.
+		*	\param		[in]	lod				- maximum octree depth of the streamed nodes, -1 for all points.
+		*	\return				bool			- true if the store is readable, else false.
+		*	\since version 0.0.4
+		*/
+		bool createFromStore(zPointCloudStore &store, zPoint &minBB, zPoint &maxBB, int lod = -1);
+
+		/*! \brief This method writes the point cloud to a new out of core store.
+		*
+		*	\param		[in]	store			- point cloud store, finalised and readable on return.
+		*	\param		[in]	directory		- store directory.
+		*	\param		[in]	maxTilePoints	- maximum number of points per tile.
+		*	\param		[in]	maxDepth		- maximum depth of the octree.
+		*	\return				bool			- true if the store was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool toStore(zPointCloudStore &store, string directory, int maxTilePoints = 65536, int maxDepth = 16);
+
 		//--------------------------
 		//---- APPEND METHODS
 		//--------------------------
@@ -143,6 +178,77 @@ namespace zSpace
 		*/
 		int numVertices();
 
+		/*! \brief This method builds the KD-tree of the point cloud from the current vertex positions. It has to be called again after the positions change.
+		*
+		*	\param		[in]	leafSize		- maximum number of points per leaf.
+		*	\since version 0.0.4
+		*/
+		void computeKDTree(int leafSize = 16);
+
+		/*! \brief This method gets the vertex closest to the input position. The KD-tree is built if the number of vertices changed since it was last built.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[out]	distanceSquared	- squared distance to the closest vertex.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				int				- index of the closest vertex, -1 if no vertex is found.
+		*	\since version 0.0.4
+		*/
+		int getClosestVertex(const zPoint &pos, double &distanceSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the vertices closest to each of the input positions, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[out]	closest			- index of the closest vertex per query, -1 if no vertex is found.
+		*	\param		[out]	distancesSquared- squared distance to the closest vertex per query.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getClosestVertices(const zPointArray &positions, zIntArray &closest, zDoubleArray &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the k vertices nearest to the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- number of vertices.
+		*	\param		[out]	neighbours		- indicies of the nearest vertices.
+		*	\param		[out]	distancesSquared- squared distances of the nearest vertices.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				int				- number of vertices found.
+		*	\since version 0.0.4
+		*/
+		int getKNearestVertices(const zPoint &pos, int k, zIntArray &neighbours, zDoubleArray &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the k vertices nearest to each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	k				- number of vertices.
+		*	\param		[out]	neighbours		- indicies of the nearest vertices per query.
+		*	\param		[out]	distancesSquared- squared distances of the nearest vertices per query.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getKNearestVertices(const zPointArray &positions, int k, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared, double maxDistance = -1);
+
+		/*! \brief This method gets the vertices within the input radius of the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- indicies of the vertices within the radius.
+		*	\param		[out]	distancesSquared- squared distances of the vertices within the radius.
+		*	\return				int				- number of vertices found.
+		*	\since version 0.0.4
+		*/
+		int getVerticesInRadius(const zPoint &pos, double radius, zIntArray &neighbours, zDoubleArray &distancesSquared);
+
+		/*! \brief This method gets the vertices within the input radius of each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- indicies of the vertices within the radius per query.
+		*	\param		[out]	distancesSquared- squared distances of the vertices within the radius per query.
+		*	\since version 0.0.4
+		*/
+		void getVerticesInRadius(const zPointArray &positions, double radius, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared);
+
 		//--------------------------
 		//--- SET METHODS 
 		//--------------------------
@@ -219,16 +325,27 @@ namespace zSpace
 
 		void transformObject(zTransform &transform) override;
 
+		//--------------------------
+		//---- PROTECTED METHODS
+		//--------------------------
+
+		/*! \brief This method builds the KD-tree if it was cleared by a create, load or transform, or the number of vertices changed since it was last built.
+		*
+		*	\since version 0.0.4
+		*/
+		void updateKDTree();
+
 		//--------------------------
 		//---- FACTORY METHODS
 		//--------------------------
 
-		/*! \brief This method imports a point cloud from an TXT file.
+		/*! \brief This method imports a point cloud from an TXT file, with x, y, z in the first three columns.
 		*
 		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
 		*	\since version 0.0.1
 		*/
-		void fromCSV(string infilename);
+		bool fromCSV(string infilename);
 
 		/*! \brief This method exports the input point cloud to a TXT file format.
 		*
@@ -238,6 +355,46 @@ namespace zSpace
 		*/
 		void toCSV(string outfilename);
 
+		/*! \brief This method imports a point cloud from an ascii or binary PLY file. Vertex colors are read if present.
+		*	\details The file is memory mapped and fixed size binary vertex records are converted in parallel straight in to the point cloud containers.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromPLY(string infilename);
+
+		/*! \brief This method exports the point cloud to the PLY file format, with vertex colors.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\param [in]		format				- body format - zPlyFormat. Floating point values of ascii bodies are written at the function set file precision.
+		*	\since version 0.0.4
+		*/
+		void toPLY(string outfilename, int format);
+
+		/*! \brief This method imports a point cloud from the binary zXYZ file format.
+		*	\details The file is memory mapped and the positions are copied in a single read in to the vertex positions container.
+		*
+		*	\param [in]		infilename			- input file name including the directory path and extension.
+		*	\return 		bool				- true if the file was read succesfully.
+		*	\since version 0.0.4
+		*/
+		bool fromXYZ(string infilename);
+
+		/*! \brief This method exports the point cloud to the binary zXYZ file format, with packed float positions and 8 bit RGB colors.
+		*
+		*	\param [in]		outfilename			- output file name including the directory path and extension.
+		*	\since version 0.0.4
+		*/
+		void toXYZ(string outfilename);
+
+		/*! \brief This method sets the vertices, default attributes and position map of the point cloud from its vertex positions.
+		*	\details Vertex colors are kept if the container matches the number of positions.
+		*
+		*	\since version 0.0.4
+		*/
+		void setVertexContainers();
+
 	};
 }
 
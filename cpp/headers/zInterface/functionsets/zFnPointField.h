@@ -26,6 +26,8 @@
 
 #include<headers/zInterface/iterators/zItPointField.h>
 
+#include<headers/zCore/field/zFieldExpression.h>
+
 namespace zSpace
 {
 	/** \addtogroup zInterface
@@ -171,6 +173,13 @@ namespace zSpace
 		*	\since version 0.0.2
 		*/
 		void createVectorFromScalarField(zFnPointField<zScalar> &inFnScalarField);
+
+		/*! \brief This method builds the KD-tree of the field value positions, used by the closest index constructors of the field iterators.
+		*
+		*	\details The create methods build it. It has to be called again after the field points are transformed.
+		*	\since version 0.0.4
+		*/
+		void computeKDTree();
 				
 
 		//--------------------------
@@ -241,6 +250,27 @@ namespace zSpace
 		*/
 		bool getFieldValue(zPoint &samplePos, zFieldValueType type, T& fieldValue);
 
+		/*! \brief This method gets the trilinear interpolated values of the field at the input sample positions, in parallel over batches of samples.
+		*
+		*	\details The samples are interpolated between the eight closest field values on the field grid. Samples outside the field are clamped to it.
+		*	\param		[in]	samplePositions	- input sample positions.
+		*	\param		[out]	fieldValues		- output field value per sample.
+		*	\param		[out]	inBounds		- true per sample if the sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		void getFieldValues_Trilinear(zPointArray &samplePositions, vector<T> &fieldValues, zBoolArray &inBounds);
+
+		/*! \brief This method gets the trilinear interpolated values and gradients of the scalar field at the input sample positions, in parallel over batches of samples.
+		*
+		*	\details The gradients are the derivatives of the trilinear interpolation.
+		*	\param		[in]	samplePositions	- input sample positions.
+		*	\param		[out]	fieldValues		- output field value per sample.
+		*	\param		[out]	gradients		- output gradient per sample.
+		*	\param		[out]	inBounds		- true per sample if the sample position is within bounds.
+		*	\since version 0.0.4
+		*/
+		void getFieldValues_Trilinear(zPointArray &samplePositions, zScalarArray &fieldValues, zVectorArray &gradients, zBoolArray &inBounds);
+
 		/*! \brief This method gets all the values of the field.
 		*
 		*	\param		[out]	fieldValues			- container of field values.
@@ -294,6 +324,78 @@ namespace zSpace
 		*/
 		void setFieldValues(vector<T> &fValues);				
 
+		//--------------------------
+		//---- FIELD FRAME METHODS
+		//--------------------------
+
+		/*! \brief This method opens the input writer for a zFIELD time series of the field, with its resolution, units and bounds.
+		*
+		*	\param		[out]	writer				- field file writer.
+		*	\param		[in]	path				- output file name including the directory path and extension.
+		*	\param		[in]	precision			- value precision - zFieldFloat32 or zFieldFloat16.
+		*	\param		[in]	compress			- true if the frames are delta encoded and compressed.
+		*	\param		[in]	keyFrameInterval	- number of frames between frames which do not depend on the previous frame, the cost of random access.
+		*	\return				bool				- true if the file was created, else false.
+		*	\since version 0.0.4
+		*/
+		bool openFieldWriter(zUtilsFieldWriter &writer, string path, zFieldPrecision precision = zFieldFloat32, bool compress = true, int keyFrameInterval = 16);
+
+		/*! \brief This method appends the current field values as a frame to the input writer.
+		*
+		*	\param		[in]	writer				- field file writer, opened with openFieldWriter.
+		*	\param		[in]	time				- time of the frame.
+		*	\return				bool				- true if the frame was written, else false.
+		*	\since version 0.0.4
+		*/
+		bool writeFieldFrame(zUtilsFieldWriter &writer, double time = 0.0);
+
+		/*! \brief This method reads the values of a frame of the input reader straight in to the field values. The field is recreated if its resolution does not match the file.
+		*
+		*	\param		[in]	reader				- field file reader.
+		*	\param		[in]	frame				- frame index.
+		*	\return				bool				- true if the frame was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldFrame(zUtilsFieldReader &reader, int frame);
+
+		//--------------------------
+		//---- DATABASE METHODS
+		//--------------------------
+
+		/*! \brief This method stores the field in a geometry table of the input database, with its bounds. The table is created if it does not exist.
+		*	\details The blob is a zFIELD header followed by the uncompressed 32 bit field values, so ranges of values can be read without loading the blob.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id, an existing geometry with the same id is replaced.
+		*	\return				bool				- true if the field was stored, else false.
+		*	\since version 0.0.4
+		*/
+		bool to(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method loads the field values from a geometry table of the input database. The field is recreated if its resolution does not match the stored field.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\return				bool				- true if the field was loaded, else false.
+		*	\since version 0.0.4
+		*/
+		bool from(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method reads a range of the values of a field stored in a geometry table of the input database, without loading the rest of the field.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\param		[in]	startIndex			- index of the first value.
+		*	\param		[in]	numValues			- number of values.
+		*	\param		[out]	values				- container of values.
+		*	\return				bool				- true if the values were read, else false.
+		*	\since version 0.0.4
+		*/
+		bool getFieldValues(zDatabase &database, string tableName, int64_t id, int startIndex, int numValues, vector<T> &values);
+
 		//--------------------------
 		//----  3D IDW FIELD METHODS
 		//--------------------------
@@ -307,9 +409,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values as inverse weighted distance from the input graph vertex positions.
 		*
@@ -319,9 +422,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of the graph.		
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -331,9 +435,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 		
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -343,9 +448,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
 		*
@@ -355,9 +461,10 @@ namespace zSpace
 		*	\param	[in]	influence			- influence value of each input position.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 
 		/*! \brief This method computes the field values based on inverse weighted distance from the input positions.
@@ -368,9 +475,10 @@ namespace zSpace
 		*	\param	[in]	influences			- influence value of each input position. Size of container should be equal to inPositions.
 		*	\param	[in]	power				- input power value used for weight calculation. Default value is 2.
 		*	\param	[in]	normalise			- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, only input positions within it contribute. Negative for the exact IDW over all input positions.
 		*	\since version 0.0.2
 		*/
-		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true);
+		void getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, vector<double>& influences, double power = 2.0, bool normalise = true, double cutoff = -1.0);
 
 		//--------------------------
 		//----  3D SCALAR FIELD METHODS
@@ -425,6 +533,16 @@ namespace zSpace
 		*/
 		void getScalarsAsEdgeDistance(zScalarArray &scalars, zObjGraph &inGraphObj, double offset, bool normalise = true);
 
+		/*! \brief This method gets the scalars of a field expression, evaluated in one parallel pass over the field without intermediate scalars.
+		*
+		*	\param	[out]	scalars			- container for storing scalar values.
+		*	\param	[in]	expression		- input field expression.
+		*	\param	[in]	nodeId			- index of the expression node to evaluate, -1 for the last node added.
+		*	\param	[in]	normalise		- true if the scalars need to mapped between -1 and 1. generally used for contouring.
+		*	\since version 0.0.4
+		*/
+		void getScalars_Expression(zScalarArray &scalars, zFieldExpression &expression, int nodeId = -1, bool normalise = true);
+
 		//--------------------------
 		//--- COMPUTE METHODS 
 		//--------------------------
@@ -479,12 +597,14 @@ namespace zSpace
 		
 		/*! \brief This method avarages / smoothens the field values.
 		*
+		*	\details The adjacent neighbour stencil is applied slice by slice in parallel, alternating between two buffers.
 		*	\param		[in]	numSmooth			- number of times to smooth.
 		*	\param		[in]	diffuseDamp			- damping value of the averaging.
 		*	\param		[in]	type				- smooth type - zlaplacian / zAverage.
+		*	\param		[in]	blockSteps			- number of smoothing steps per pass over the field. Each tile of slices is smoothed blockSteps times in cache, recomputing blockSteps slices on either side.
 		*	\since version 0.0.2
 		*/
-		void smoothField(int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage);
+		void smoothField(int numSmooth, double diffuseDamp = 1.0, zDiffusionType type = zAverage, int blockSteps = 1);
 	
 
 		/*! \brief This method computes the field index of each input position and stores them in a container per field index.
@@ -565,6 +685,137 @@ namespace zSpace
 		*/
 		void boolean_clipwithPlane(zScalarArray& scalars, zMatrix4& clipPlane);	
 
+		/*! \brief This method creates a union of the input sparse fields, visiting only their active blocks.
+		*
+		*	\param	[in]	field_A					- sparse field A.
+		*	\param	[in]	field_B					- sparse field B, with the same resolution and bounds as field A.
+		*	\param	[out]	field_Result			- resultant sparse field, can be one of the inputs.
+		*	\since version 0.0.4
+		*/
+		void boolean_union(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result);
+
+		/*! \brief This method creates a subtraction of the input sparse fields, visiting only their active blocks.
+		*
+		*	\param	[in]	field_A					- sparse field A.
+		*	\param	[in]	field_B					- sparse field B, with the same resolution and bounds as field A.
+		*	\param	[out]	field_Result			- resultant sparse field, can be one of the inputs.
+		*	\since version 0.0.4
+		*/
+		void boolean_subtract(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result);
+
+		/*! \brief This method creates a intersect of the input sparse fields, visiting only their active blocks.
+		*
+		*	\param	[in]	field_A					- sparse field A.
+		*	\param	[in]	field_B					- sparse field B, with the same resolution and bounds as field A.
+		*	\param	[out]	field_Result			- resultant sparse field, can be one of the inputs.
+		*	\since version 0.0.4
+		*/
+		void boolean_intersect(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result);
+
+		/*! \brief This method creates a difference of the input sparse fields, visiting only their active blocks.
+		*
+		*	\param	[in]	field_A					- sparse field A.
+		*	\param	[in]	field_B					- sparse field B, with the same resolution and bounds as field A.
+		*	\param	[out]	field_Result			- resultant sparse field, can be one of the inputs.
+		*	\since version 0.0.4
+		*/
+		void boolean_difference(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result);
+
+		//--------------------------
+		//----  SPARSE FIELD METHODS
+		//--------------------------
+
+		/*! \brief This method creates a sparse field from the input parameters. No field points are created, and only the blocks the values are set in store values.
+		*
+		*	\param		[in]	_minBB			- minimum bounds of the field.
+		*	\param		[in]	_maxBB			- maximum bounds of the field.
+		*	\param		[in]	_n_X			- number of voxels in x direction.
+		*	\param		[in]	_n_Y			- number of voxels in y direction.
+		*	\param		[in]	_n_Z			- number of voxels in z direction.
+		*	\param		[in]	_background		- value of the voxels outside the active blocks.
+		*	\since version 0.0.4
+		*/
+		void createSparse(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, T _background = T());
+
+		/*! \brief This method returns if the field is sparse.
+		*
+		*	\return			bool				- true if the field is sparse, else false.
+		*	\since version 0.0.4
+		*/
+		bool isSparse();
+
+		/*! \brief This method returns the number of active blocks of the sparse field.
+		*
+		*	\return			int					- number of active blocks.
+		*	\since version 0.0.4
+		*/
+		int numActiveBlocks();
+
+		/*! \brief This method gets the trilinear interpolated value of the sparse field at the input position.
+		*
+		*	\param		[in]	samplePos		- input sample position.
+		*	\param		[out]	fieldValue		- output field value.
+		*	\return			bool				- true if the sample position is within the field bounds, else false.
+		*	\since version 0.0.4
+		*/
+		bool getSparseFieldValue(zPoint &samplePos, T &fieldValue);
+
+		/*! \brief This method sets the sparse field as the narrow band signed distance to the input mesh.
+		*
+		*	\details The faces are triangulated, and the sign is taken from the angle weighted pseudo normal at the closest point, so the mesh needs to be closed with outward facing normals.
+		*	Only the blocks within the band of the surface are active, the other blocks read as the band width outside and minus the band width inside.
+		*	\param		[in]	inMeshObj		- input mesh object.
+		*	\param		[in]	bandWidth		- width of the band on either side of the surface, at least one voxel diagonal, the values are clamped to it.
+		*	\since version 0.0.4
+		*/
+		void setSparseScalarsAsSignedDistance(zObjMesh &inMeshObj, double bandWidth);
+
+		/*! \brief This method sets the sparse field as the narrow band distance to the input graph edges minus the offset.
+		*
+		*	\param		[in]	inGraphObj		- input graph object.
+		*	\param		[in]	offset			- input distance variable.
+		*	\param		[in]	bandWidth		- width of the band on either side of the offset distance, at least one voxel diagonal, the values are clamped to it.
+		*	\since version 0.0.4
+		*/
+		void setSparseScalarsAsEdgeDistance(zObjGraph &inGraphObj, float offset, double bandWidth);
+
+		/*! \brief This method sets the sparse field as the narrow band distance to the input point cloud vertices minus the offset.
+		*
+		*	\param		[in]	inPointsObj		- input point cloud object.
+		*	\param		[in]	offset			- input distance variable.
+		*	\param		[in]	bandWidth		- width of the band on either side of the offset distance, at least one voxel diagonal, the values are clamped to it.
+		*	\since version 0.0.4
+		*/
+		void setSparseScalarsAsVertexDistance(zObjPointCloud &inPointsObj, float offset, double bandWidth);
+
+		//--------------------------
+		//----  ISOSURFACE METHODS
+		//--------------------------
+
+		/*! \brief This method creates a isosurface mesh from the field at the given field threshold.
+		*
+		*	\details based on https://en.wikipedia.org/wiki/Marching_cubes. Slabs of the field are processed in parallel and the crossing vertices are shared through a cache indexed by field edge, holding two planes of the slab at a time. The face normals point to the higher field values.
+		*	\param	[out]	coutourMeshObj	- isosurface mesh.
+		*	\param	[in]	inThreshold		- field threshold.
+		*	\param	[in]	invertMesh		- true if the face normals should point to the lower field values.
+		*	\since version 0.0.4
+		*	\warning	works only with scalar fields
+		*/
+		void getIsosurface(zObjMesh &coutourMeshObj, float inThreshold = 0.0, bool invertMesh = false);
+
+		/*! \brief This method creates a isosurface mesh from the field cells within the input region at the given field threshold.
+		*
+		*	\details The region is snapped outwards to the field cells, the mesh is open where the isosurface leaves the region.
+		*	\param	[out]	coutourMeshObj	- isosurface mesh.
+		*	\param	[in]	regionMin		- minimum bounds of the region.
+		*	\param	[in]	regionMax		- maximum bounds of the region.
+		*	\param	[in]	inThreshold		- field threshold.
+		*	\param	[in]	invertMesh		- true if the face normals should point to the lower field values.
+		*	\since version 0.0.4
+		*	\warning	works only with scalar fields
+		*/
+		void getIsosurface(zObjMesh &coutourMeshObj, zPoint regionMin, zPoint regionMax, float inThreshold = 0.0, bool invertMesh = false);
+
 		//--------------------------
 		//----  UPDATE METHODS
 		//--------------------------
@@ -588,6 +839,141 @@ namespace zSpace
 		*	\since version 0.0.2
 		*/
 		void createPointCloud();
+
+		/*! \brief This method reads the values of a frame of the input reader straight in to the field values, recreating the field if its resolution does not match the file.
+		*
+		*	\param		[in]	reader				- field file reader.
+		*	\param		[in]	frame				- frame index.
+		*	\return				bool				- true if the frame was read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldValues(zUtilsFieldReader &reader, int frame);
+
+		/*! \brief This method reads the values of a field stored in a geometry table of the input database straight in to the field values, recreating the field if its resolution does not match.
+		*
+		*	\param		[in]	database			- open database.
+		*	\param		[in]	tableName			- name of the geometry table.
+		*	\param		[in]	id					- geometry id.
+		*	\return				bool				- true if the values were read, else false.
+		*	\since version 0.0.4
+		*/
+		bool readFieldValues(zDatabase &database, string tableName, int64_t id);
+
+		/*! \brief This method sets the resolution, units, bounds and number of values of the input zFIELD header from the field.
+		*
+		*	\param		[out]	header				- field header.
+		*	\since version 0.0.4
+		*/
+		void getFieldHeader(zUtilsFieldHeader &header);
+
+		/*! \brief This method checks the input zFIELD header against the field, recreating the field if its resolution does not match.
+		*
+		*	\param		[in]	header				- field header.
+		*	\return				bool				- true if the field matches the header, else false.
+		*	\since version 0.0.4
+		*/
+		bool setFieldHeader(const zUtilsFieldHeader &header);
+
+		/*! \brief This method computes the inverse distance weighted field values of all field points in parallel over tiles of field points.
+		*
+		*	\param	[out]	fieldValues			- container for storing field values, resized to the number of field points.
+		*	\param	[in]	inPositions			- input positions.
+		*	\param	[in]	numInPositions		- number of input positions.
+		*	\param	[in]	values				- value of each input position, nullptr to use value for all.
+		*	\param	[in]	value				- value of all input positions.
+		*	\param	[in]	influences			- influence of each input position, nullptr to use influence for all.
+		*	\param	[in]	influence			- influence of all input positions.
+		*	\param	[in]	power				- input power value used for weight calculation.
+		*	\param	[in]	closestOnly			- true if only the input positions closer than all previous ones set the value, as for mesh and graph inputs.
+		*	\param	[in]	cutoff				- cutoff radius of the truncated IDW, negative for the exact IDW.
+		*	\since version 0.0.4
+		*/
+		void computeFieldValues_IDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T *values, T value, double *influences, double influence, double power, bool closestOnly, double cutoff);
+
+		/*! \brief This method computes the narrow band distances of the input sparse field to the input primitives, activating only the blocks within the band of a primitive.
+		*
+		*	\details The sign of the voxels beyond the band is taken from the global closest triangle, not only the ones within the band of the block.
+		*	\param	[in]	sparseField			- input sparse scalar field.
+		*	\param	[in]	inPositions			- input positions.
+		*	\param	[in]	inPrimitives		- input primitives as indicies in to inPositions, primitiveSize per primitive.
+		*	\param	[in]	primitiveSize		- 1 for points, 2 for segments and 3 for triangles. Distances to triangles are signed.
+		*	\param	[in]	offset				- distance subtracted from the distances.
+		*	\param	[in]	bandWidth			- width of the band on either side of the offset distance, raised to one voxel diagonal if smaller.
+		*	\since version 0.0.4
+		*/
+		void computeSparseDistances(zSparseField3D<zScalar> &sparseField, zPointArray &inPositions, zIntArray &inPrimitives, int primitiveSize, float offset, double bandWidth);
+
+		/*! \brief This method gets the closest point on the input triangle.
+		*
+		*	\details based on Ericson, Real-Time Collision Detection, 5.1.5.
+		*	\param	[in]	p					- input point.
+		*	\param	[in]	t0					- first triangle vertex.
+		*	\param	[in]	t1					- second triangle vertex.
+		*	\param	[in]	t2					- third triangle vertex.
+		*	\param	[out]	feature				- closest feature, 0 to 2 for the vertices, 3 to 5 for the edges starting at them, 6 for the face.
+		*	\return			zPoint				- closest point.
+		*	\since version 0.0.4
+		*/
+		zPoint getClosestPoint_Triangle(zPoint &p, zPoint &t0, zPoint &t1, zPoint &t2, int &feature);
+
+		/*! \brief This method replaces the active blocks of the sparse field which are entirely outside the band by tiles.
+		*
+		*	\param	[in]	sparseField			- input sparse scalar field, the background is the band width.
+		*	\since version 0.0.4
+		*/
+		void pruneSparseBlocks(zSparseField3D<zScalar> &sparseField);
+
+		/*! \brief This method sets the inactive blocks behind a negative active block or tile along x to minus the band width.
+		*
+		*	\param	[in]	sparseField			- input sparse scalar field, the background is the band width.
+		*	\since version 0.0.4
+		*/
+		void floodFillSparseSigns(zSparseField3D<zScalar> &sparseField);
+
+		/*! \brief This method combines the active blocks and tiles of the input sparse fields with the input operator.
+		*
+		*	\param	[in]	field_A				- sparse field A.
+		*	\param	[in]	field_B				- sparse field B.
+		*	\param	[out]	field_Result		- resultant sparse field.
+		*	\param	[in]	op					- operator applied per voxel.
+		*	\since version 0.0.4
+		*/
+		void computeSparseBoolean(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result, float(*op)(float, float));
+
+		/*! \brief This method smooths the input slices of constant x of the field once.
+		*
+		*	\param	[in]	inValues			- input values, starting at slice offsetX.
+		*	\param	[out]	outValues			- output values, starting at slice offsetX.
+		*	\param	[in]	offsetX				- slice of the first value of the containers.
+		*	\param	[in]	startX				- first slice to smooth.
+		*	\param	[in]	endX				- end of the slices to smooth (exclusive).
+		*	\param	[in]	diffuseDamp			- damping value of the averaging.
+		*	\param	[in]	type				- smooth type - zlaplacian / zAverage.
+		*	\since version 0.0.4
+		*/
+		void computeSmoothSlices(const zScalar *inValues, zScalar *outValues, int offsetX, int startX, int endX, double diffuseDamp, zDiffusionType type);
+
+		/*! \brief This method gets the field grid cells and interpolation parameters of a batch of sample positions.
+		*
+		*	\param	[in]	samplePositions		- input sample positions.
+		*	\param	[in]	numSamples			- number of sample positions.
+		*	\param	[out]	ids					- index of the lower corner of the cell per sample.
+		*	\param	[out]	tX					- interpolation parameter in X per sample.
+		*	\param	[out]	tY					- interpolation parameter in Y per sample.
+		*	\param	[out]	tZ					- interpolation parameter in Z per sample.
+		*	\param	[out]	inBounds			- 1 per sample if the sample position is within bounds, else 0.
+		*	\since version 0.0.4
+		*/
+		void getSampleCells_Trilinear(zPoint *samplePositions, int numSamples, int *ids, float *tX, float *tY, float *tZ, char *inBounds);
+
+		/*! \brief This method gets the marching cubes triangles of a cube case.
+		*
+		*	\details based on http://paulbourke.net/geometry/polygonise/.
+		*	\param	[in]	cubeIndex			- case of the cube, with a bit set per corner below the threshold.
+		*	\return			const int*			- cube edges of the triangles in threes, ending with -1.
+		*	\since version 0.0.4
+		*/
+		const int* getCubeTriangles(int cubeIndex);
 		
 
 	};	
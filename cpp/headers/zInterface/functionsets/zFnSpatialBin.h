@@ -37,8 +37,53 @@ namespace  zSpace
 	*  @{
 	*/	
 
+	/*! \struct zBinNeighbour
+	*	\brief A struct to store a point found by a spatial bin query.
+	*	\since version 0.0.4
+	*/
+
+	/** @}*/
+	/** @}*/
+
+	struct ZSPACE_API zBinNeighbour
+	{
+		/*!	\brief index of the object in the spatial bin. */
+		int objectId = -1;
+
+		/*!	\brief index of the vertex in the object. */
+		int vertexId = -1;
+
+		/*!	\brief squared distance to the query position. */
+		double distanceSquared = 0;
+
+		/*! \brief This operator orders the neighbours by distance, and by object and vertex index for equal distances.
+		*
+		*	\param		[in]	other		- neighbour to compare to.
+		*	\return				bool		- true if this neighbour is closer.
+		*	\since version 0.0.4
+		*/
+		bool operator <(const zBinNeighbour &other) const
+		{
+			if (distanceSquared != other.distanceSquared) return distanceSquared < other.distanceSquared;
+			if (objectId != other.objectId) return objectId < other.objectId;
+			return vertexId < other.vertexId;
+		}
+	};
+
+	/** \addtogroup zInterface
+	*	\brief The Application Program Interface of the library.
+	*  @{
+	*/
+
+	/** \addtogroup zFuntionSets
+	*	\brief The function set classes of the library.
+	*  @{
+	*/
+
 	/*! \class zFnSpatialBin
 	*	\brief A spatial binning function-set.
+	*	\details The bin contents are stored in compressed sparse row form, as bin offsets in to a list of points sorted by bin, built with a parallel counting sort.
+	*	The bins are either a dense grid over fixed bounds, or sparse hashed cells of an unbounded grid which only exist where there are points.
 	*	\since version 0.0.3
 	*/
 	
@@ -57,6 +102,15 @@ namespace  zSpace
 		/*!	\brief pointer to a field 3D object  */
 		zObjSpatialBin *binObj;		
 
+		/*!	\brief stores pointers to the vertex positions of the objects */
+		vector<zPointArray*> objectPositions;
+
+		/*!	\brief offsets of the objects in to the point bins, size is number of objects + 1 */
+		zIntArray objectOffsets;
+
+		/*!	\brief bin index per point of all objects, -1 if the point is outside the bins */
+		zIntArray pointBins;
+
 	public:
 
 
@@ -118,6 +172,14 @@ namespace  zSpace
 		*/
 		void create(const zPoint &_minBB = zPoint(0, 0, 0), const zPoint &_maxBB = zPoint(10, 10, 10), int _res = 30);
 
+		/*! \brief This method creates sparse spatial bins, as hashed cells of an unbounded grid with the origin at zero.
+		*	\details Cells are created only where there are points, so adding objects outside the current bounds never rebuilds the bins. The containers ringNeighbours and adjacentNeighbours are not computed for sparse bins, use getNeighbourhoodRing and getNeighbourAdjacents instead.
+		*
+		*	\param  	[in]	_cellSize		- size of the cells.
+		*	\since version 0.0.4
+		*/
+		void createSparse(double _cellSize = 1.0);
+
 		//--------------------------
 		//---- GET METHODS
 		//--------------------------
@@ -184,6 +246,32 @@ namespace  zSpace
 		*/
 		bool getIndices(zPoint &pos, int &index_X, int &index_Y, int &index_Z);
 
+		/*! \brief This method gets the number of points in the bin at the input index.
+		*
+		*	\param		[in]	index		- input bin index.
+		*	\return				int			- number of points in the bin.
+		*	\since version 0.0.4
+		*/
+		int getBinSize(int index);
+
+		/*! \brief This method gets the points in the bin at the input index.
+		*
+		*	\param		[in]	index		- input bin index.
+		*	\param		[out]	numEntries	- number of points in the bin.
+		*	\return				zIntPair*	- pointer to the object index and vertex index pairs of the points, valid until the bins are updated.
+		*	\since version 0.0.4
+		*/
+		const zIntPair* getBinEntries(int index, int &numEntries);
+
+		/*! \brief This method gets the positions of the points in the bin at the input index, in the order of the bin entries.
+		*
+		*	\param		[in]	index		- input bin index.
+		*	\param		[out]	numEntries	- number of points in the bin.
+		*	\return				zPoint*		- pointer to the positions, valid until the bins are updated.
+		*	\since version 0.0.4
+		*/
+		const zPoint* getBinPositions(int index, int &numEntries);
+
 		//--------------------------
 		//---- METHODS
 		//--------------------------
@@ -202,6 +290,83 @@ namespace  zSpace
 		*/
 		void clearBins();
 
+		/*! \brief This method rebuilds the bins from the current vertex positions of all the objects, with a parallel counting sort.
+		*
+		*	\since version 0.0.4
+		*/
+		void rebuildBins();
+
+		/*! \brief This method updates the bins to the current vertex positions of all the objects, for moving points such as particles.
+		*	\details The bin of each point is recomputed in parallel. If no point changed bin only the bin positions are refreshed, else the bins are sorted again.
+		*
+		*	\return				int				- number of points which changed bin.
+		*	\since version 0.0.4
+		*/
+		int updateBins();
+
+		//--------------------------
+		//---- QUERY METHODS
+		//--------------------------
+
+		/*! \brief This method gets the binned point closest to the input position.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[out]	closest			- closest point.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				bool			- true if a point is found.
+		*	\since version 0.0.4
+		*/
+		bool getClosest(const zPoint &pos, zBinNeighbour &closest, double maxDistance = -1);
+
+		/*! \brief This method gets the binned points closest to each of the input positions, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[out]	closest			- closest point per query, with object index -1 if no point is found.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getClosest(zPointArray &positions, vector<zBinNeighbour> &closest, double maxDistance = -1);
+
+		/*! \brief This method gets the k binned points nearest to the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- number of points.
+		*	\param		[out]	neighbours		- nearest points.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int getKNearest(const zPoint &pos, int k, vector<zBinNeighbour> &neighbours, double maxDistance = -1);
+
+		/*! \brief This method gets the k binned points nearest to each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	k				- number of points.
+		*	\param		[out]	neighbours		- nearest points per query.
+		*	\param		[in]	maxDistance		- maximum search distance, negative for unlimited.
+		*	\since version 0.0.4
+		*/
+		void getKNearest(zPointArray &positions, int k, vector<vector<zBinNeighbour>> &neighbours, double maxDistance = -1);
+
+		/*! \brief This method gets the binned points within the input radius of the input position, sorted by distance.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- points within the radius.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int getInRadius(const zPoint &pos, double radius, vector<zBinNeighbour> &neighbours);
+
+		/*! \brief This method gets the binned points within the input radius of each of the input positions, sorted by distance, in parallel.
+		*
+		*	\param		[in]	positions		- input query positions.
+		*	\param		[in]	radius			- search radius.
+		*	\param		[out]	neighbours		- points within the radius per query.
+		*	\since version 0.0.4
+		*/
+		void getInRadius(zPointArray &positions, double radius, vector<vector<zBinNeighbour>> &neighbours);
+
 
 		//--------------------------
 		//---- PROTECTED METHODS
@@ -218,24 +383,126 @@ namespace  zSpace
 		template<typename T>
 		bool boundsCheck(T &inObj);
 
-		/*! \brief This method partitions the  new object to the bin
+		/*! \brief This method gets the packed index of the sparse cell for the input X,Y and Z indicies.
 		*
-		*	\param		[in]	inObj			- input object. Works for objects with position informations - pointcloud, graphes and meshes.
-		*	\since version 0.0.3
+		*	\param		[in]	index_X		- input index in X.
+		*	\param		[in]	index_Y		- input index in Y.
+		*	\param		[in]	index_Z		- input index in Z.
+		*	\return				int64_t		- packed cell index.
+		*	\since version 0.0.4
 		*/
-		template<typename T>
-		void partitionToBins(T &inObj, int objectId);
+		int64_t getCellKey(int index_X, int index_Y, int index_Z);
 
-		/*! \brief This method partitions the input position.
+		/*! \brief This method gets the X,Y and Z indicies of the sparse cell for the input packed index.
 		*
-		*	\param		[in]	inPos		- input position to be added to bin.
-		*	\param		[in]	pointId		- input index of the position in the container.
-		*	\param		[in]	objectId	- input index of the object the position belongs to.
-		*	\since version 0.0.3
+		*	\param		[in]	key			- input packed cell index.
+		*	\param		[out]	index_X		- output index in X.
+		*	\param		[out]	index_Y		- output index in Y.
+		*	\param		[out]	index_Z		- output index in Z.
+		*	\since version 0.0.4
+		*/
+		void getCellIndices(int64_t key, int &index_X, int &index_Y, int &index_Z);
+
+		/*! \brief This method gets the X,Y and Z indicies of the sparse cell at the input position.
+		*
+		*	\param		[in]	pos			- input position.
+		*	\param		[out]	index_X		- output index in X.
+		*	\param		[out]	index_Y		- output index in Y.
+		*	\param		[out]	index_Z		- output index in Z.
+		*	\return				bool		- true if the indicies are in the range of the packed cell indicies.
+		*	\since version 0.0.4
+		*/
+		bool getCellIndices(const zPoint &pos, int &index_X, int &index_Y, int &index_Z);
+
+		/*! \brief This method gets the index of the bin at the input position, with positions on the maximum bounds in the last bin.
+		*
+		*	\param		[in]	pos			- input position.
+		*	\return				int			- bin index, -1 if the position is outside the bins.
+		*	\since version 0.0.4
 		*/
-		void partitionToBin(zPoint &inPos, int pointId, int objectId);
+		int getBinIndex(const zPoint &pos);
 
-		/*! \brief This method creates the point cloud from the field parameters.
+		/*! \brief This method gets the cell the queries start from. Positions outside dense bins start from the closest boundary cell.
+		*
+		*	\param		[in]	pos			- input position.
+		*	\param		[out]	index_X		- output index in X.
+		*	\param		[out]	index_Y		- output index in Y.
+		*	\param		[out]	index_Z		- output index in Z.
+		*	\return				bool		- true if there is a cell to start from.
+		*	\since version 0.0.4
+		*/
+		bool getQueryCell(const zPoint &pos, int &index_X, int &index_Y, int &index_Z);
+
+		/*! \brief This method gets the number of rings around the input cell after which there are no more bins.
+		*
+		*	\param		[in]	index_X		- input index in X.
+		*	\param		[in]	index_Y		- input index in Y.
+		*	\param		[in]	index_Z		- input index in Z.
+		*	\return				int			- maximum ring.
+		*	\since version 0.0.4
+		*/
+		int getMaxRing(int index_X, int index_Y, int index_Z);
+
+		/*! \brief This method gets the bins on the shell of the input ring around the input cell.
+		*
+		*	\param		[in]	index_X		- input index in X.
+		*	\param		[in]	index_Y		- input index in Y.
+		*	\param		[in]	index_Z		- input index in Z.
+		*	\param		[in]	ring		- input ring, 0 for the cell itself.
+		*	\param		[out]	shellBins	- bin indicies on the shell.
+		*	\since version 0.0.4
+		*/
+		void getShellBins(int index_X, int index_Y, int index_Z, int ring, zIntArray &shellBins);
+
+		/*! \brief This method adds the points of the input bin to a max heap of the nearest points.
+		*
+		*	\param		[in]	index			- input bin index.
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- maximum number of points in the heap.
+		*	\param		[in]	maxDistanceSq	- maximum squared distance.
+		*	\param		[in,out]	heap		- max heap of the nearest points.
+		*	\since version 0.0.4
+		*/
+		void addNearest(int index, const zPoint &pos, int k, double maxDistanceSq, vector<zBinNeighbour> &heap);
+
+		/*! \brief This method searches the bins in rings of increasing size around the input position for the nearest points.
+		*
+		*	\param		[in]	pos				- input query position.
+		*	\param		[in]	k				- maximum number of points.
+		*	\param		[in]	maxDistanceSq	- maximum squared distance.
+		*	\param		[out]	neighbours		- nearest points sorted by distance.
+		*	\return				int				- number of points found.
+		*	\since version 0.0.4
+		*/
+		int searchNearest(const zPoint &pos, int k, double maxDistanceSq, vector<zBinNeighbour> &neighbours);
+
+		/*! \brief This method computes the bin index of every point of the objects from the input object index. For sparse bins the missing cells are created.
+		*
+		*	\param		[in]	startObject	- index of the first object.
+		*	\return				int			- number of points which changed bin.
+		*	\since version 0.0.4
+		*/
+		int computePointBins(int startObject = 0);
+
+		/*! \brief This method bins the points of the objects added since the last update, and sorts the bins.
+		*
+		*	\since version 0.0.4
+		*/
+		void binNewObjects();
+
+		/*! \brief This method sorts the points in to the bins by their bin index with a parallel counting sort.
+		*
+		*	\since version 0.0.4
+		*/
+		void sortBins();
+
+		/*! \brief This method copies the current vertex positions of the binned points in to the bin positions.
+		*
+		*	\since version 0.0.4
+		*/
+		void copyBinPositions();
+
+		/*! \brief This method creates the point cloud from the field parameters. For sparse bins the points are the minimum corners of the cells.
 		*
 		*	\since version 0.0.3
 		*/
@@ -256,6 +523,9 @@ namespace  zSpace
 	template<>
 	inline bool zFnSpatialBin::boundsCheck(zObjPointCloud &inObj)
 	{
+		// sparse bins are unbounded
+		if (binObj->sparse) return false;
+
 		zVector minBB, maxBB;
 		binObj->getBounds(minBB, maxBB);
 
@@ -281,17 +551,10 @@ namespace  zSpace
 			int res = (resX > resY) ? resX : resY;
 			res = (res > resZ) ? res : resZ;
 
+			// the existing objects are binned again by addObject
 			clear();
 			create(minBB, maxBB, res);
 
-			// partition to bin existing objects
-			int i = 0;
-			for (auto &obj : objects)
-			{
-				partitionToBins(obj, i);
-				i++;
-			}
-
 		}
 
 		return resized;
@@ -302,6 +565,9 @@ namespace  zSpace
 	template<>
 	inline bool zFnSpatialBin::boundsCheck(zObjGraph &inObj)
 	{
+		// sparse bins are unbounded
+		if (binObj->sparse) return false;
+
 		zVector minBB, maxBB;
 		binObj->getBounds(minBB, maxBB);
 
@@ -327,17 +593,10 @@ namespace  zSpace
 			int res = (resX > resY) ? resX : resY;
 			res = (res > resZ) ? res : resZ;
 
+			// the existing objects are binned again by addObject
 			clear();
 			create(minBB, maxBB, res);
 
-			// partition to bin existing objects
-			int i = 0;
-			for (auto &obj : objects)
-			{
-				partitionToBins(obj, i);
-				i++;
-			}
-
 		}
 
 		return resized;
@@ -348,6 +607,9 @@ namespace  zSpace
 	template<>
 	inline bool zFnSpatialBin::boundsCheck(zObjMesh &inObj)
 	{
+		// sparse bins are unbounded
+		if (binObj->sparse) return false;
+
 		zVector minBB, maxBB;
 		binObj->getBounds(minBB, maxBB);
 
@@ -373,17 +635,10 @@ namespace  zSpace
 			int res = (resX > resY) ? resX : resY;
 			res = (res > resZ) ? res : resZ;
 
+			// the existing objects are binned again by addObject
 			clear();
 			create(minBB, maxBB, res);
 
-			// partition to bin existing objects
-			int i = 0;
-			for (auto &obj : objects)
-			{
-				partitionToBins(obj, i);
-				i++;
-			}
-
 		}
 
 		return resized;
@@ -391,52 +646,18 @@ namespace  zSpace
 
 	//---------------//
 
-	//---- pointcloud specilization for addObject
-	template<>
-	inline void zFnSpatialBin::partitionToBins(zObjPointCloud & inObj, int objectId)
-	{
-		zVector *positions = &inObj.pCloud.vertexPositions[0];
-
-		for (int i = 0; i < inObj.pCloud.n_v; i++)
-			partitionToBin(positions[i], i, objectId);
-
-	}
-
-	//---- graph specilization for addObject
-	template<>
-	inline void zFnSpatialBin::partitionToBins(zObjGraph & inObj, int objectId)
-	{
-		zVector *positions = &inObj.graph.vertexPositions[0];
-
-		for (int i = 0; i < inObj.graph.n_v; i++)
-			partitionToBin(positions[i], i, objectId);
-
-	}
-
-	//---- mesh specilization for addObject
-	template<>
-	inline void zFnSpatialBin::partitionToBins(zObjMesh & inObj, int objectId)
-	{
-		zVector *positions = &inObj.mesh.vertexPositions[0];
-
-		for (int i = 0; i < inObj.mesh.n_v; i++)
-			partitionToBin(positions[i], i, objectId);
-
-	}	
-
-	//---------------//
-
 	//---- pointcloud specilization for addObject
 	template<>
 	inline void zFnSpatialBin::addObject(zObjPointCloud & inObj)
 	{
-
 		bool chk = boundsCheck(inObj);
 
 		objects.push_back(&inObj);
-	
-		partitionToBins(inObj, objects.size() - 1);
+		objectPositions.push_back(&inObj.pCloud.vertexPositions);
 
+		// only the new points are binned, unless the bins were resized
+		if (chk) rebuildBins();
+		else binNewObjects();
 	}
 
 	//---- graph specilization for addObject
@@ -446,8 +667,11 @@ namespace  zSpace
 		bool chk = boundsCheck(inObj);
 
 		objects.push_back(&inObj);
+		objectPositions.push_back(&inObj.graph.vertexPositions);
 
-		partitionToBins(inObj, objects.size() - 1);
+		// only the new points are binned, unless the bins were resized
+		if (chk) rebuildBins();
+		else binNewObjects();
 	}
 
 	//---- mesh specilization for addObject
@@ -457,8 +681,11 @@ namespace  zSpace
 		bool chk = boundsCheck(inObj);
 
 		objects.push_back(&inObj);
+		objectPositions.push_back(&inObj.mesh.vertexPositions);
 
-		partitionToBins(inObj, objects.size() - 1);
+		// only the new points are binned, unless the bins were resized
+		if (chk) rebuildBins();
+		else binNewObjects();
 	}
 
 	//---------------//
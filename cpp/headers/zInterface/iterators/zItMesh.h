@@ -718,6 +718,15 @@ namespace zSpace
 		/*!	\brief pointer to a mesh object  */
 		zObjMesh *meshObj;
 
+		/*!	\brief This method appends the indicies of the vertices of the face to the input container.
+		*
+		*	\tparam	T					- int container type, zIntArray or zScratchIntArray.
+		*	\param		[out]	vertexIndicies	- container of vertex indicies.
+		*	\since version 0.0.4
+		*/
+		template<typename T>
+		void appendVertices(T &vertexIndicies);
+
 
 	public:
 
@@ -796,6 +805,13 @@ namespace zSpace
 		*/
 		void getVertices(zIntArray &vertexIndicies);
 
+		/*!	\brief This method gets the indicies of the vertices of the face into a scratch container. The container is cleared first.
+		*
+		*	\param		[out]	vertexIndicies	- scratch vector of vertex indicies.
+		*	\since version 0.0.4
+		*/
+		void getVertices(zScratchIntArray &vertexIndicies);
+
 		/*!	\brief TThis method gets the vertex positions of the face.
 		*
 		*	\param		[out]	vertPositions	- vector of vertex positions.
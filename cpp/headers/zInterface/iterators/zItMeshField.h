@@ -98,6 +98,16 @@ namespace zSpace
 		/*!	\brief pointer to a mesh fieldobject  */
 		zObjMeshScalarField  *fieldObj;
 
+		/*! \brief This method gets the ring neighbour indicies of the field at the current element into the input container. The container is cleared first.
+		*
+		*	\tparam	T					- int container type, zIntArray or zScratchIntArray.
+		*	\param		[in]	numRings		- number of rings.
+		*	\param		[out]	ringNeighbours	- contatiner of neighbours.
+		*	\since version 0.0.4
+		*/
+		template<typename T>
+		void getNeighbourIds_Ring(int numRings, T &ringNeighbours);
+
 	public:
 
 		//--------------------------
@@ -129,7 +139,7 @@ namespace zSpace
 		*
 		*	\param		[in]	_fieldObj			- input mesh field object.
 		*	\param		[in]	_pos				- input positionn.
-		*	\param		[in]	closestIndex		- true if closest index is required.
+		*	\param		[in]	closestIndex		- true if closest index is required, looked up in the KD-tree built by the field function set.
 		*	\since version 0.0.3
 		*/
 		zItMeshScalarField(zObjMeshScalarField &_fieldObj, zVector &_pos, bool closestIndex = false);
@@ -180,6 +190,14 @@ namespace zSpace
 		*/
 		void getNeighbour_Ring(int numRings, zIntArray &ringNeighbours);
 
+		/*! \brief This method gets the ring neighbour indicies of the field at the current element into a scratch container.
+		*
+		*	\param		[in]	numRings		- number of rings.
+		*	\param		[out]	ringNeighbours	- scratch contatiner of neighbours.
+		*	\since version 0.0.4
+		*/
+		void getNeighbour_Ring(int numRings, zScratchIntArray &ringNeighbours);
+
 		/*! \brief This method gets the ring Points of the field at the current element.
 		*
 		*	\param		[in]	numRings		- number of rings.
@@ -344,7 +362,7 @@ namespace zSpace
 		*
 		*	\param		[in]	_fieldObj			- input mesh field object.
 		*	\param		[in]	_pos				- input positionn.
-		*	\param		[in]	closestIndex		- true if closest index is required.
+		*	\param		[in]	closestIndex		- true if closest index is required, looked up in the KD-tree built by the field function set.
 		*	\since version 0.0.3
 		*/
 		zItMeshVectorField(zObjMeshVectorField &_fieldObj, zVector &_pos, bool closestIndex = false);
@@ -128,7 +128,7 @@ namespace zSpace
 		*
 		*	\param		[in]	_fieldObj			- input mesh field object.
 		*	\param		[in]	_pos				- input positionn.
-		*	\param		[in]	closestIndex		- true if closest index is required.
+		*	\param		[in]	closestIndex		- true if closest index is required, looked up in the KD-tree built by the field function set.
 		*	\since version 0.0.3
 		*/
 		zItPointScalarField(zObjPointScalarField &_fieldObj, zVector &_pos, bool closestIndex = false);
@@ -344,7 +344,7 @@ namespace zSpace
 		*
 		*	\param		[in]	_fieldObj			- input mesh field object.
 		*	\param		[in]	_pos				- input positionn.
-		*	\param		[in]	closestIndex		- true if closest index is required.
+		*	\param		[in]	closestIndex		- true if closest index is required, looked up in the KD-tree built by the field function set.
 		*	\since version 0.0.3
 		*/
 		zItPointVectorField(zObjPointVectorField &_fieldObj, zVector &_pos, bool closestIndex = false);
@@ -17,6 +17,7 @@
 
 #include <headers/zInterface/objects/zObjMesh.h>
 #include <headers/zCore/field/zField2D.h>
+#include <headers/zCore/geometry/zKDTree.h>
 
 #include <vector>
 using namespace std;
@@ -56,6 +57,9 @@ namespace zSpace
 		/*! \brief field 2D */
 		zField2D<T> field;
 
+		/*! \brief KD-tree of the field value positions, built by the field function set for the closest index lookups of the field iterators */
+		zKDTree kdTree;
+
 		//--------------------------
 		//---- CONSTRUCTOR
 		//--------------------------
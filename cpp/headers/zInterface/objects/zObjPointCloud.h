@@ -17,6 +17,7 @@
 
 #include <headers/zInterface/objects/zObj.h>
 #include <headers/zCore/geometry/zPointCloud.h>
+#include <headers/zCore/geometry/zKDTree.h>
 
 namespace zSpace
 {
@@ -55,6 +56,9 @@ namespace zSpace
 		/*! \brief point cloud */
 		zPointCloud pCloud;
 
+		/*! \brief KD-tree of the vertex positions, built by zFnPointCloud::computeKDTree or on demand by the closest vertex queries */
+		zKDTree kdTree;
+
 		//--------------------------
 		//---- CONSTRUCTOR
 		//--------------------------
@@ -17,6 +17,7 @@
 
 #include <headers/zInterface/objects/zObjPointCloud.h>
 #include <headers/zCore/field/zField3D.h>
+#include <headers/zCore/field/zSparseField3D.h>
 
 #include <vector>
 using namespace std;
@@ -57,6 +58,12 @@ namespace zSpace
 		/*! \brief field 2D */
 		zField3D<T> field;
 
+		/*! \brief sparse field, used in place of the field and its points when sparse is true */
+		zSparseField3D<T> sparseField;
+
+		/*! \brief true if the field is stored as sparse blocks */
+		bool sparse;
+
 
 		//--------------------------
 		//---- CONSTRUCTOR
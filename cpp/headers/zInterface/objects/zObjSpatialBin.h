@@ -20,6 +20,7 @@
 #include <headers/zCore/field/zBin.h>
 
 #include <vector>
+#include <unordered_map>
 using namespace std;
 
 namespace zSpace
@@ -59,8 +60,23 @@ namespace zSpace
 		/*! \brief field 2D */
 		zField3D<float> field;	
 
-		/*!	\brief bins			*/
-		vector<zBin> bins;
+		/*!	\brief offsets of the bins in to the bin entries, bin i holds the entries binOffsets[i] to binOffsets[i + 1] - 1. Size is number of bins + 1.		*/
+		zIntArray binOffsets;
+
+		/*!	\brief object index and vertex index of the binned points, sorted by bin and then by object and vertex.		*/
+		vector<zIntPair> binEntries;
+
+		/*!	\brief positions of the binned points, in the order of the bin entries.		*/
+		zPointArray binPositions;
+
+		/*!	\brief true if the bins are the hashed cells of an unbounded grid, which only exist where there are points.		*/
+		bool sparse;
+
+		/*!	\brief packed cell indicies of each bin, only used by sparse bins.		*/
+		vector<int64_t> binCells;
+
+		/*!	\brief bin index of each packed cell index, only used by sparse bins.		*/
+		unordered_map<int64_t, int> cellBins;
 
 		//--------------------------
 		//---- CONSTRUCTOR
@@ -92,6 +108,18 @@ namespace zSpace
 		*	\since version 0.0.3
 		*/
 		void setDisplayBounds(bool _displayBounds);
+
+		//--------------------------
+		//---- GET METHODS
+		//--------------------------
+
+		/*! \brief This method gets the bins as zBin containers, rebuilt from the bin offsets and entries.
+		*	\details Compatibility accessor for the bins container this class used to hold. It copies every entry, so use binOffsets and binEntries directly where performance matters.
+		*
+		*	\param		[out]	bins			- container of bins, one per bin index.
+		*	\since version 0.0.4
+		*/
+		void getBins(vector<zBin> &bins);
 	
 		//--------------------------
 		//---- OVERRIDE METHODS
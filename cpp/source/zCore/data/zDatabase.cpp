@@ -14,17 +14,180 @@
 
 namespace zSpace
 {
+	//---- zDatabaseCursor
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor()
+	{
+		stmt = nullptr;
+		RC = SQLITE_OK;
+		owner = nullptr;
+	}
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor(sqlite3_stmt* _stmt)
+	{
+		stmt = _stmt;
+		RC = SQLITE_OK;
+		owner = nullptr;
+	}
+
+	ZSPACE_INLINE zDatabaseCursor::zDatabaseCursor(zDatabaseCursor &&other)
+	{
+		stmt = nullptr;
+		RC = SQLITE_OK;
+		owner = nullptr;
+
+		*this = std::move(other);
+	}
+
+	ZSPACE_INLINE zDatabaseCursor& zDatabaseCursor::operator=(zDatabaseCursor &&other)
+	{
+		if (this == &other) return *this;
+
+		setStatement(nullptr);
+
+		stmt = other.stmt;
+		RC = other.RC;
+		owner = other.owner;
+
+		// the database tracks the cursor by address
+		if (owner) std::replace(owner->cursors.begin(), owner->cursors.end(), &other, this);
+
+		other.stmt = nullptr;
+		other.RC = SQLITE_OK;
+		other.owner = nullptr;
+
+		return *this;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zDatabaseCursor::~zDatabaseCursor()
+	{
+		setStatement(nullptr);
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zDatabaseCursor::setStatement(sqlite3_stmt* _stmt)
+	{
+		if (stmt && stmt != _stmt) sqlite3_reset(stmt);
+
+		detach();
+
+		stmt = _stmt;
+		RC = SQLITE_OK;
+	}
+
+	ZSPACE_INLINE sqlite3_stmt* zDatabaseCursor::getStatement()
+	{
+		return stmt;
+	}
+
+	ZSPACE_INLINE bool zDatabaseCursor::next()
+	{
+		if (!stmt) return false;
+
+		RC = sqlite3_step(stmt);
+		return RC == SQLITE_ROW;
+	}
+
+	ZSPACE_INLINE void zDatabaseCursor::reset()
+	{
+		if (stmt) sqlite3_reset(stmt);
+		RC = SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabaseCursor::hasError()
+	{
+		return RC != SQLITE_OK && RC != SQLITE_ROW && RC != SQLITE_DONE;
+	}
+
+	ZSPACE_INLINE int zDatabaseCursor::numColumns()
+	{
+		return sqlite3_column_count(stmt);
+	}
+
+	ZSPACE_INLINE const char* zDatabaseCursor::getColumnName(int col)
+	{
+		return sqlite3_column_name(stmt, col);
+	}
+
+	ZSPACE_INLINE int zDatabaseCursor::getColumnType(int col)
+	{
+		return sqlite3_column_type(stmt, col);
+	}
+
+	ZSPACE_INLINE bool zDatabaseCursor::isNull(int col)
+	{
+		return sqlite3_column_type(stmt, col) == SQLITE_NULL;
+	}
+
+	ZSPACE_INLINE int64_t zDatabaseCursor::getInteger(int col)
+	{
+		return sqlite3_column_int64(stmt, col);
+	}
+
+	ZSPACE_INLINE double zDatabaseCursor::getDouble(int col)
+	{
+		return sqlite3_column_double(stmt, col);
+	}
+
+	ZSPACE_INLINE string_view zDatabaseCursor::getText(int col)
+	{
+		// text before bytes, so the size is of the converted value
+		const char* text = (const char*)sqlite3_column_text(stmt, col);
+		int size = sqlite3_column_bytes(stmt, col);
+
+		return (text) ? string_view(text, size) : string_view();
+	}
+
+	ZSPACE_INLINE string zDatabaseCursor::getString(int col)
+	{
+		return string(getText(col));
+	}
+
+	//---- PRIVATE METHODS
+
+	ZSPACE_INLINE void zDatabaseCursor::detach()
+	{
+		if (!owner) return;
+
+		owner->cursors.erase(std::remove(owner->cursors.begin(), owner->cursors.end(), this), owner->cursors.end());
+		owner = nullptr;
+	}
+
+	ZSPACE_INLINE zBlobView zDatabaseCursor::getBlob(int col)
+	{
+		zBlobView blob;
+		blob.data = (const unsigned char*)sqlite3_column_blob(stmt, col);
+		blob.size = sqlite3_column_bytes(stmt, col);
+
+		return blob;
+	}
+
+	//---- zDatabase
 
 	//---- CONSTRUCTOR
 
 	ZSPACE_INLINE zDatabase::zDatabase()
 	{
 		database = NULL;
+
+		transaction = false;
+		batchSize = 0;
+		batchCount = 0;
 	}
 
 	ZSPACE_INLINE zDatabase::zDatabase(char* filename)
 	{
 		database = NULL;
+
+		transaction = false;
+		batchSize = 0;
+		batchCount = 0;
+
 		bool stat = open(filename);
 
 		if (stat) printf("\n Opened database successfully\n");
@@ -34,7 +197,11 @@ namespace zSpace
 
 	//---- DESTRUCTOR
 
-	ZSPACE_INLINE zDatabase::~zDatabase() {}
+	ZSPACE_INLINE zDatabase::~zDatabase()
+	{
+		// live cursors keep their statement but no longer refer to the database
+		for (auto &cursor : cursors) cursor->owner = nullptr;
+	}
 
 	//---- DATABASE METHODS
 
@@ -48,7 +215,12 @@ namespace zSpace
 
 	ZSPACE_INLINE void zDatabase::close()
 	{
+		if (transaction) commitTransaction();
+
+		clearStatements();
+
 		sqlite3_close(database);
+		database = NULL;
 	}
 
 	ZSPACE_INLINE bool zDatabase::sqlCommand(zStringArray &sqlStatment, zSQLCommand sqlCommandType, bool displayError, zStringArray &outStatment, bool colType)
@@ -73,7 +245,7 @@ namespace zSpace
 
 
 		// intialise dyanmic array
-		sql = new char[arraySize];
+		sql = new char[arraySize + 1];
 		int counter = 0;
 
 		//printf("\n ");
@@ -93,6 +265,7 @@ namespace zSpace
 			//printf("\n ");
 		}
 
+		sql[counter] = '\0';
 
 
 
@@ -277,6 +450,8 @@ namespace zSpace
 			}
 		}
 
+		delete[] sql;
+
 		return out;
 	}
 
@@ -331,4 +506,395 @@ namespace zSpace
 
 		sqlStatment.push_back(");");
 	}
-}
\ No newline at end of file
+
+	ZSPACE_INLINE bool zDatabase::tableInsertBatch(string &tableName, zStringArray &columnNames, zStringArray &values, int _batchSize)
+	{
+		int numColumns = columnNames.size();
+
+		if (numColumns == 0 || values.size() % numColumns != 0)
+		{
+			throw std::invalid_argument(" error: number of values is not a multiple of the number of columns.");
+		}
+
+		return tableInsertBatch(tableName, columnNames, values.size() / numColumns, [&](sqlite3_stmt* stmt, int row)
+		{
+			for (int i = 0; i < numColumns; i++)
+			{
+				if (!bindText(stmt, i + 1, values[row * numColumns + i])) return false;
+			}
+
+			return true;
+		}, _batchSize);
+	}
+
+	ZSPACE_INLINE bool zDatabase::tableInsertBatch(string &tableName, zStringArray &columnNames, int numRows, const function<bool(sqlite3_stmt*, int)> &bindRow, int _batchSize)
+	{
+		string sql = "INSERT INTO " + tableName + " (";
+
+		for (int i = 0; i < (int)columnNames.size(); i++)
+		{
+			sql += " " + columnNames[i] + " ";
+			if (i != (int)columnNames.size() - 1) sql += ", ";
+		}
+
+		sql += ") VALUES (";
+
+		for (int i = 0; i < (int)columnNames.size(); i++)
+		{
+			sql += "?";
+			if (i != (int)columnNames.size() - 1) sql += ", ";
+		}
+
+		sql += ");";
+
+		sqlite3_stmt* stmt = getStatement(sql);
+		if (!stmt) return false;
+
+		// nested in an open transaction the rows are committed with it
+		bool ownTransaction = !transaction;
+		if (ownTransaction && !beginTransaction(_batchSize)) return false;
+
+		for (int i = 0; i < numRows; i++)
+		{
+			sqlite3_clear_bindings(stmt);
+
+			if (!bindRow(stmt, i) || !executeStatement(stmt))
+			{
+				printf("\n Table Insert Failed, row: %i \n", i);
+
+				if (ownTransaction) rollbackTransaction();
+				return false;
+			}
+		}
+
+		if (ownTransaction) return commitTransaction();
+
+		return true;
+	}
+
+	//---- STATEMENT METHODS
+
+	ZSPACE_INLINE sqlite3_stmt* zDatabase::getStatement(const string &sql, bool displayError)
+	{
+		vector<sqlite3_stmt*> &sqlStatements = statements[sql];
+
+		for (auto &cached : sqlStatements)
+		{
+			if (isStatementInUse(cached)) continue;
+
+			sqlite3_reset(cached);
+			sqlite3_clear_bindings(cached);
+
+			return cached;
+		}
+
+		sqlite3_stmt* stmt = nullptr;
+		int RC = sqlite3_prepare_v2(database, sql.c_str(), (int)sql.size() + 1, &stmt, NULL);
+
+		if (RC != SQLITE_OK || !stmt)
+		{
+			if (displayError) printf("\n Statement Preparation Failed, RC: %i, %s \n", RC, sqlite3_errmsg(database));
+
+			sqlite3_finalize(stmt);
+			if (sqlStatements.empty()) statements.erase(sql);
+
+			return nullptr;
+		}
+
+		sqlStatements.push_back(stmt);
+		return stmt;
+	}
+
+	ZSPACE_INLINE bool zDatabase::bindInteger(sqlite3_stmt* stmt, int index, int64_t value)
+	{
+		return sqlite3_bind_int64(stmt, index, value) == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::bindDouble(sqlite3_stmt* stmt, int index, double value)
+	{
+		return sqlite3_bind_double(stmt, index, value) == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::bindText(sqlite3_stmt* stmt, int index, const string &value)
+	{
+		return sqlite3_bind_text(stmt, index, value.c_str(), (int)value.size(), SQLITE_TRANSIENT) == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::bindBlob(sqlite3_stmt* stmt, int index, const void* data, int size)
+	{
+		if (size == 0) return sqlite3_bind_zeroblob(stmt, index, 0) == SQLITE_OK;
+
+		return sqlite3_bind_blob(stmt, index, data, size, SQLITE_TRANSIENT) == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::bindNull(sqlite3_stmt* stmt, int index)
+	{
+		return sqlite3_bind_null(stmt, index) == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::executeStatement(sqlite3_stmt* stmt, bool displayError)
+	{
+		int RC = sqlite3_step(stmt);
+		sqlite3_reset(stmt);
+
+		if (RC != SQLITE_DONE && RC != SQLITE_ROW)
+		{
+			if (displayError) printf("\n Statement Execution Failed, RC: %i, ext_RC: %i, %s \n", RC, sqlite3_extended_errcode(database), sqlite3_errmsg(database));
+			return false;
+		}
+
+		if (transaction && batchSize > 0 && ++batchCount >= batchSize)
+		{
+			if (sqlite3_exec(database, "COMMIT; BEGIN TRANSACTION;", NULL, NULL, NULL) != SQLITE_OK)
+			{
+				if (displayError) printf("\n Batch Commit Failed, %s \n", sqlite3_errmsg(database));
+
+				transaction = (sqlite3_get_autocommit(database) == 0);
+				return false;
+			}
+
+			batchCount = 0;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zDatabase::clearStatements()
+	{
+		// live cursors lose their statement instead of resetting a finalized one
+		for (auto &cursor : cursors)
+		{
+			cursor->stmt = nullptr;
+			cursor->RC = SQLITE_OK;
+			cursor->owner = nullptr;
+		}
+
+		cursors.clear();
+
+		for (auto &it : statements)
+		{
+			for (auto &stmt : it.second) sqlite3_finalize(stmt);
+		}
+
+		statements.clear();
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE bool zDatabase::query(const string &sql, zDatabaseCursor &cursor, bool displayError)
+	{
+		// release the previous statement first, so it can be reused
+		cursor.setStatement(nullptr);
+
+		sqlite3_stmt* stmt = getStatement(sql, displayError);
+		if (!stmt) return false;
+
+		cursor.setStatement(stmt);
+
+		cursor.owner = this;
+		cursors.push_back(&cursor);
+
+		return true;
+	}
+
+	ZSPACE_INLINE int zDatabase::queryRows(const string &sql, const function<bool(zDatabaseCursor&)> &rowMethod, bool displayError)
+	{
+		zDatabaseCursor cursor;
+		if (!query(sql, cursor, displayError)) return -1;
+
+		int numRows = 0;
+
+		while (cursor.next())
+		{
+			numRows++;
+			if (!rowMethod(cursor)) break;
+		}
+
+		if (cursor.hasError())
+		{
+			if (displayError) printf("\n Query Failed, ext_RC: %i, %s \n", sqlite3_extended_errcode(database), sqlite3_errmsg(database));
+			return -1;
+		}
+
+		return numRows;
+	}
+
+	//---- GEOMETRY METHODS
+
+	ZSPACE_INLINE bool zDatabase::geometryTableCreate(const string &tableName)
+	{
+		string sql = "CREATE TABLE IF NOT EXISTS " + tableName + " (id INTEGER PRIMARY KEY, type INTEGER, minX REAL, minY REAL, minZ REAL, maxX REAL, maxY REAL, maxZ REAL, geometry BLOB);";
+		sql += "CREATE INDEX IF NOT EXISTS " + tableName + "_bounds ON " + tableName + " (minX, maxX);";
+
+		if (sqlite3_exec(database, sql.c_str(), NULL, NULL, NULL) != SQLITE_OK)
+		{
+			printf("\n Table Creation Failed, %s \n", sqlite3_errmsg(database));
+			return false;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zDatabase::geometryInsert(const string &tableName, int64_t id, int type, const zPoint &minBB, const zPoint &maxBB, const void* data, size_t size)
+	{
+		if (size > INT_MAX)
+		{
+			printf("\n Geometry Insert Failed, blob larger than 2GB \n");
+			return false;
+		}
+
+		sqlite3_stmt* stmt = getStatement("INSERT OR REPLACE INTO " + tableName + " (id, type, minX, minY, minZ, maxX, maxY, maxZ, geometry) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);");
+		if (!stmt) return false;
+
+		bool out = bindInteger(stmt, 1, id) && bindInteger(stmt, 2, type);
+		out = out && bindDouble(stmt, 3, minBB.x) && bindDouble(stmt, 4, minBB.y) && bindDouble(stmt, 5, minBB.z);
+		out = out && bindDouble(stmt, 6, maxBB.x) && bindDouble(stmt, 7, maxBB.y) && bindDouble(stmt, 8, maxBB.z);
+
+		// bound without a copy, the statement is executed before returning
+		out = out && sqlite3_bind_blob(stmt, 9, (size > 0) ? data : "", (int)size, SQLITE_STATIC) == SQLITE_OK;
+
+		out = out && executeStatement(stmt);
+
+		sqlite3_clear_bindings(stmt);
+		return out;
+	}
+
+	ZSPACE_INLINE bool zDatabase::geometrySelect(const string &tableName, int64_t id, int &type, vector<unsigned char> &data)
+	{
+		zDatabaseCursor cursor;
+		if (!query("SELECT type, geometry FROM " + tableName + " WHERE id = ?;", cursor)) return false;
+
+		bindInteger(cursor.getStatement(), 1, id);
+
+		if (!cursor.next()) return false;
+
+		zBlobView blob = cursor.getBlob(1);
+
+		type = (int)cursor.getInteger(0);
+		data.assign(blob.data, blob.data + blob.size);
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zDatabase::geometryRead(const string &tableName, int64_t id, int64_t offset, void* data, int64_t size)
+	{
+		if (offset < 0 || size < 0 || offset + size > INT_MAX) return false;
+
+		// the handle is closed straight away, an open handle would hold a read lock on the database
+		sqlite3_blob* blob = NULL;
+
+		if (sqlite3_blob_open(database, "main", tableName.c_str(), "geometry", id, 0, &blob) != SQLITE_OK)
+		{
+			sqlite3_blob_close(blob);
+			return false;
+		}
+
+		bool out = offset + size <= sqlite3_blob_bytes(blob);
+		out = out && sqlite3_blob_read(blob, data, (int)size, (int)offset) == SQLITE_OK;
+
+		sqlite3_blob_close(blob);
+		return out;
+	}
+
+	ZSPACE_INLINE int64_t zDatabase::geometrySize(const string &tableName, int64_t id)
+	{
+		zDatabaseCursor cursor;
+		if (!query("SELECT length(geometry) FROM " + tableName + " WHERE id = ?;", cursor)) return -1;
+
+		bindInteger(cursor.getStatement(), 1, id);
+
+		if (!cursor.next() || cursor.isNull(0)) return -1;
+		return cursor.getInteger(0);
+	}
+
+	ZSPACE_INLINE bool zDatabase::geometryQuery(const string &tableName, const zPoint &minBB, const zPoint &maxBB, vector<int64_t> &ids, int type)
+	{
+		ids.clear();
+
+		zDatabaseCursor cursor;
+		if (!query("SELECT id FROM " + tableName + " WHERE minX <= ?1 AND maxX >= ?2 AND minY <= ?3 AND maxY >= ?4 AND minZ <= ?5 AND maxZ >= ?6 AND (?7 < 0 OR type = ?7);", cursor)) return false;
+
+		sqlite3_stmt* stmt = cursor.getStatement();
+
+		bindDouble(stmt, 1, maxBB.x); bindDouble(stmt, 2, minBB.x);
+		bindDouble(stmt, 3, maxBB.y); bindDouble(stmt, 4, minBB.y);
+		bindDouble(stmt, 5, maxBB.z); bindDouble(stmt, 6, minBB.z);
+		bindInteger(stmt, 7, type);
+
+		while (cursor.next()) ids.push_back(cursor.getInteger(0));
+
+		return !cursor.hasError();
+	}
+
+	//---- TRANSACTION METHODS
+
+	ZSPACE_INLINE bool zDatabase::beginTransaction(int _batchSize)
+	{
+		if (transaction)
+		{
+			printf("\n Transaction Begin Failed, a transaction is already open \n");
+			return false;
+		}
+
+		if (sqlite3_exec(database, "BEGIN TRANSACTION;", NULL, NULL, NULL) != SQLITE_OK)
+		{
+			printf("\n Transaction Begin Failed, %s \n", sqlite3_errmsg(database));
+			return false;
+		}
+
+		transaction = true;
+		batchSize = (_batchSize > 0) ? _batchSize : 0;
+		batchCount = 0;
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zDatabase::commitTransaction()
+	{
+		if (!transaction) return false;
+
+		if (sqlite3_exec(database, "COMMIT;", NULL, NULL, NULL) != SQLITE_OK)
+		{
+			printf("\n Transaction Commit Failed, %s \n", sqlite3_errmsg(database));
+			return false;
+		}
+
+		transaction = false;
+		batchSize = 0;
+		batchCount = 0;
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zDatabase::rollbackTransaction()
+	{
+		if (!transaction) return false;
+
+		int RC = sqlite3_exec(database, "ROLLBACK;", NULL, NULL, NULL);
+
+		transaction = false;
+		batchSize = 0;
+		batchCount = 0;
+
+		return RC == SQLITE_OK;
+	}
+
+	ZSPACE_INLINE bool zDatabase::inTransaction()
+	{
+		return transaction;
+	}
+
+	//---- PRIVATE METHODS
+
+	ZSPACE_INLINE bool zDatabase::isStatementInUse(sqlite3_stmt* stmt)
+	{
+		if (sqlite3_stmt_busy(stmt)) return true;
+
+		for (auto &cursor : cursors)
+		{
+			if (cursor->stmt == stmt) return true;
+		}
+
+		return false;
+	}
+}
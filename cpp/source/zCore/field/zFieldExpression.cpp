@@ -0,0 +1,498 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/field/zFieldExpression.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zFieldExpression::zFieldExpression() {}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zFieldExpression::~zFieldExpression() {}
+
+	//---- PRIMITIVE METHODS
+
+	ZSPACE_INLINE int zFieldExpression::addCircle(zPoint cen, float r, double annularVal)
+	{
+		zFieldExpressionNode node;
+		node.type = zExprCircle;
+		node.p0 = cen;
+		node.radius = r;
+		node.annularVal = annularVal;
+
+		// the value is at least the distance to the circle
+		setBounds(node, &cen, 1, (std::max)(r, 0.0f) + (std::max)(node.annularVal, 0.0f));
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addLine(zPoint v0, zPoint v1, double annularVal)
+	{
+		zFieldExpressionNode node;
+		node.type = zExprLine;
+		node.p0 = v0;
+		node.p1 = v1;
+		node.annularVal = annularVal;
+
+		zPoint ends[2] = { v0, v1 };
+		setBounds(node, ends, 2, (std::max)(node.annularVal, 0.0f));
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addPolygon(zPointArray &vertices)
+	{
+		if (vertices.size() < 3) throw std::invalid_argument(" error: polygon needs at least 3 vertices.");
+
+		zFieldExpressionNode node;
+		node.type = zExprPolygon;
+		node.start = positions.size();
+
+		positions.insert(positions.end(), vertices.begin(), vertices.end());
+		node.end = positions.size();
+
+		setBounds(node, &positions[node.start], node.end - node.start, 0);
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addGraphDistance(zPointArray &vertices, zIntArray &edges, float offset)
+	{
+		if (edges.size() < 2 || edges.size() % 2 != 0) throw std::invalid_argument(" error: edges need to be pairs of vertex indicies.");
+
+		zFieldExpressionNode node;
+		node.type = zExprGraphDistance;
+		node.radius = offset;
+		node.start = positions.size();
+
+		for (auto &vId : edges)
+		{
+			if (vId < 0 || vId >= (int)vertices.size()) throw std::invalid_argument(" error: edge vertex index out of bounds.");
+			positions.push_back(vertices[vId]);
+		}
+
+		node.end = positions.size();
+
+		setBounds(node, &positions[node.start], node.end - node.start, (std::max)(offset, 0.0f));
+
+		return addNode(node);
+	}
+
+	//---- OPERATOR METHODS
+
+	ZSPACE_INLINE int zFieldExpression::addUnion(int nodeA, int nodeB)
+	{
+		zFieldExpressionNode node;
+		node.type = zExprUnion;
+		node.child0 = nodeA;
+		node.child1 = nodeB;
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addSubtract(int nodeA, int nodeB)
+	{
+		zFieldExpressionNode node;
+		node.type = zExprSubtract;
+		node.child0 = nodeA;
+		node.child1 = nodeB;
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addIntersect(int nodeA, int nodeB)
+	{
+		zFieldExpressionNode node;
+		node.type = zExprIntersect;
+		node.child0 = nodeA;
+		node.child1 = nodeB;
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addSmoothUnion(int nodeA, int nodeB, float k)
+	{
+		if (k <= 0) throw std::invalid_argument(" error: smoothing distance needs to be positive.");
+
+		zFieldExpressionNode node;
+		node.type = zExprSmoothUnion;
+		node.child0 = nodeA;
+		node.child1 = nodeB;
+		node.radius = k;
+
+		return addNode(node);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addClipPlane(int node, zPoint O, zVector Z)
+	{
+		if (Z.length() < EPS) throw std::invalid_argument(" error: clip plane normal can't be zero.");
+
+		zFieldExpressionNode clipNode;
+		clipNode.type = zExprClipPlane;
+		clipNode.child0 = node;
+		clipNode.p0 = O;
+
+		Z.normalize();
+		clipNode.p1 = Z;
+
+		return addNode(clipNode);
+	}
+
+	ZSPACE_INLINE int zFieldExpression::addTransform(int node, zTransform &transform)
+	{
+		// the distances and the bounds pruning hold only if the transform preserves distances
+		zRotationMatrix rotation = transform.block<3, 3>(0, 0);
+		if (!(rotation.transpose() * rotation).isIdentity(1e-4)) throw std::invalid_argument(" error: transform is not rigid, scaling or shearing is not supported.");
+
+		zFieldExpressionNode transformNode;
+		transformNode.type = zExprTransform;
+		transformNode.child0 = node;
+
+		zTransform inv = transform.inverse();
+
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 4; j++) transformNode.inverse[i * 4 + j] = inv(i, j);
+		}
+
+		return addNode(transformNode);
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zFieldExpression::numNodes()
+	{
+		return nodes.size();
+	}
+
+	ZSPACE_INLINE float zFieldExpression::getValue(zPoint &pos, int nodeId)
+	{
+		if (nodeId == -1) nodeId = nodes.size() - 1;
+		if (nodeId < 0 || nodeId >= (int)nodes.size()) throw std::invalid_argument(" error: node index out of bounds.");
+
+		return evaluate(nodeId, pos);
+	}
+
+	ZSPACE_INLINE void zFieldExpression::getValues(zPoint *inPositions, int numInPositions, zScalarArray &values, int nodeId)
+	{
+		if (nodeId == -1) nodeId = nodes.size() - 1;
+		if (nodeId < 0 || nodeId >= (int)nodes.size()) throw std::invalid_argument(" error: node index out of bounds.");
+
+		values.assign(numInPositions, 0);
+
+		zUtilsParallel::forEach(0, numInPositions, [&](int i)
+		{
+			values[i] = evaluate(nodeId, inPositions[i]);
+		}, 256);
+	}
+
+	ZSPACE_INLINE void zFieldExpression::clear()
+	{
+		nodes.clear();
+		positions.clear();
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE int zFieldExpression::addNode(zFieldExpressionNode &node)
+	{
+		int numChildren = 0;
+
+		if (node.type == zExprClipPlane || node.type == zExprTransform) numChildren = 1;
+		else if (node.type == zExprUnion || node.type == zExprSubtract || node.type == zExprIntersect || node.type == zExprSmoothUnion) numChildren = 2;
+
+		int children[2] = { node.child0, node.child1 };
+
+		for (int j = 0; j < 2; j++)
+		{
+			if (j >= numChildren)
+			{
+				if (j == 0) node.child0 = -1;
+				else node.child1 = -1;
+
+				continue;
+			}
+
+			if (children[j] < 0 || children[j] >= (int)nodes.size()) throw std::invalid_argument(" error: child node index out of bounds.");
+		}
+
+		// bounds of the operators from the bounds of their children
+		if (numChildren > 0)
+		{
+			zFieldExpressionNode &nodeA = nodes[node.child0];
+
+			for (int j = 0; j < 3; j++)
+			{
+				node.minBB[j] = nodeA.minBB[j];
+				node.maxBB[j] = nodeA.maxBB[j];
+			}
+		}
+
+		if (node.type == zExprUnion || node.type == zExprSmoothUnion)
+		{
+			zFieldExpressionNode &nodeB = nodes[node.child1];
+
+			// the smooth minimum is at most a quarter of the smoothing distance below the minimum
+			float grow = (node.type == zExprSmoothUnion) ? 0.25 * node.radius : 0;
+
+			for (int j = 0; j < 3; j++)
+			{
+				node.minBB[j] = (std::min)(node.minBB[j], nodeB.minBB[j]) - grow;
+				node.maxBB[j] = (std::max)(node.maxBB[j], nodeB.maxBB[j]) + grow;
+			}
+		}
+		else if (node.type == zExprIntersect)
+		{
+			// the value is at least the values of both children, so either bounds hold. The smaller ones are kept
+			zFieldExpressionNode &nodeA = nodes[node.child0];
+			zFieldExpressionNode &nodeB = nodes[node.child1];
+
+			double sizeA = 0, sizeB = 0;
+			for (int j = 0; j < 3; j++)
+			{
+				sizeA += (nodeA.maxBB[j] - nodeA.minBB[j]);
+				sizeB += (nodeB.maxBB[j] - nodeB.minBB[j]);
+			}
+
+			if (sizeB < sizeA)
+			{
+				for (int j = 0; j < 3; j++)
+				{
+					node.minBB[j] = nodeB.minBB[j];
+					node.maxBB[j] = nodeB.maxBB[j];
+				}
+			}
+		}
+		else if (node.type == zExprTransform)
+		{
+			// bounds of the transformed corners of the child bounds
+			zFieldExpressionNode &nodeA = nodes[node.child0];
+
+			zTransform inv;
+			inv.setIdentity();
+
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 4; j++) inv(i, j) = node.inverse[i * 4 + j];
+			}
+
+			zTransform transform = inv.inverse();
+
+			zPoint corners[8];
+			for (int c = 0; c < 8; c++)
+			{
+				zPoint corner((c & 1) ? nodeA.maxBB[0] : nodeA.minBB[0], (c & 2) ? nodeA.maxBB[1] : nodeA.minBB[1], (c & 4) ? nodeA.maxBB[2] : nodeA.minBB[2]);
+				corners[c] = corner * transform;
+			}
+
+			setBounds(node, corners, 8, 0);
+		}
+
+		nodes.push_back(node);
+		return nodes.size() - 1;
+	}
+
+	ZSPACE_INLINE void zFieldExpression::setBounds(zFieldExpressionNode &node, zPoint *inPositions, int numInPositions, float grow)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			node.minBB[j] = std::numeric_limits<float>::max();
+			node.maxBB[j] = std::numeric_limits<float>::lowest();
+		}
+
+		for (int i = 0; i < numInPositions; i++)
+		{
+			zPoint &p = inPositions[i];
+
+			node.minBB[0] = (std::min)(node.minBB[0], p.x);
+			node.minBB[1] = (std::min)(node.minBB[1], p.y);
+			node.minBB[2] = (std::min)(node.minBB[2], p.z);
+
+			node.maxBB[0] = (std::max)(node.maxBB[0], p.x);
+			node.maxBB[1] = (std::max)(node.maxBB[1], p.y);
+			node.maxBB[2] = (std::max)(node.maxBB[2], p.z);
+		}
+
+		for (int j = 0; j < 3; j++)
+		{
+			node.minBB[j] -= grow;
+			node.maxBB[j] += grow;
+		}
+	}
+
+	ZSPACE_INLINE float zFieldExpression::getBoundsDistance(int nodeId, zPoint &pos)
+	{
+		zFieldExpressionNode &node = nodes[nodeId];
+		float p[3] = { pos.x, pos.y, pos.z };
+
+		float out = 0;
+		bool inside = true;
+
+		for (int j = 0; j < 3; j++)
+		{
+			float d = 0;
+			if (p[j] < node.minBB[j]) d = node.minBB[j] - p[j];
+			else if (p[j] > node.maxBB[j]) d = p[j] - node.maxBB[j];
+
+			if (d > 0) inside = false;
+			out += d * d;
+		}
+
+		// inside the bounds the value can be negative, so there is no lower bound
+		if (inside) return std::numeric_limits<float>::lowest();
+
+		return sqrt(out);
+	}
+
+	ZSPACE_INLINE float zFieldExpression::evaluate(int nodeId, zPoint &pos)
+	{
+		zFieldExpressionNode &node = nodes[nodeId];
+
+		float out = 0;
+
+		switch (node.type)
+		{
+		case zExprCircle:
+		{
+			out = (pos - node.p0).length() - node.radius;
+			if (node.annularVal != 0) out = abs(out - node.annularVal);
+
+			return out;
+		}
+
+		case zExprLine:
+		{
+			zVector pa = pos - node.p0;
+			zVector ba = node.p1 - node.p0;
+
+			float h = (ba * ba > 0) ? coreUtils.ofClamp((pa * ba) / (ba * ba), 0.0f, 1.0f) : 0.0f;
+
+			out = (pa - (ba * h)).length();
+			if (node.annularVal != 0) out = abs(out - node.annularVal);
+
+			return out;
+		}
+
+		case zExprPolygon:
+		{
+			// even odd crossings of the edges for the sign
+			float d = (pos - positions[node.start]) * (pos - positions[node.start]);
+			float s = 1.0;
+
+			for (int i = node.start, j = node.end - 1; i < node.end; j = i, i++)
+			{
+				zPoint &vi = positions[i];
+				zPoint &vj = positions[j];
+
+				zVector e = vj - vi;
+				zVector w = pos - vi;
+
+				float t = (e * e > 0) ? coreUtils.ofClamp<float>((w * e) / (e * e), 0.0, 1.0) : 0.0f;
+				zVector b = w - e * t;
+
+				d = (std::min)(d, b * b);
+
+				bool c1 = (pos.y >= vi.y);
+				bool c2 = (pos.y < vj.y);
+				bool c3 = (e.x * w.y > e.y * w.x);
+
+				if (c1 && c2 && c3) s *= -1.0;
+				if (!c1 && !c2 && !c3) s *= -1.0;
+			}
+
+			return s * sqrt(d);
+		}
+
+		case zExprGraphDistance:
+		{
+			float d = std::numeric_limits<float>::max();
+
+			for (int i = node.start; i < node.end; i += 2)
+			{
+				zVector pa = pos - positions[i];
+				zVector ba = positions[i + 1] - positions[i];
+
+				float h = (ba * ba > 0) ? coreUtils.ofClamp((pa * ba) / (ba * ba), 0.0f, 1.0f) : 0.0f;
+				zVector b = pa - (ba * h);
+
+				d = (std::min)(d, b * b);
+			}
+
+			return sqrt(d) - node.radius;
+		}
+
+		case zExprUnion:
+		{
+			float a = evaluate(node.child0, pos);
+
+			// B is at least the distance to its bounds
+			if (getBoundsDistance(node.child1, pos) >= a) return a;
+
+			return (std::min)(a, evaluate(node.child1, pos));
+		}
+
+		case zExprSubtract:
+		{
+			float a = evaluate(node.child0, pos);
+
+			// -B is at most minus the distance to its bounds
+			if (-getBoundsDistance(node.child1, pos) <= a) return a;
+
+			return (std::max)(a, -1 * evaluate(node.child1, pos));
+		}
+
+		case zExprIntersect:
+		{
+			return (std::max)(evaluate(node.child0, pos), evaluate(node.child1, pos));
+		}
+
+		case zExprSmoothUnion:
+		{
+			float a = evaluate(node.child0, pos);
+			float k = node.radius;
+
+			// the smooth minimum is A where B is at least k above it
+			if (getBoundsDistance(node.child1, pos) >= a + k) return a;
+
+			float b = evaluate(node.child1, pos);
+
+			float h = coreUtils.ofClamp(0.5f + 0.5f * (b - a) / k, 0.0f, 1.0f);
+			return (b * (1 - h) + a * h) - k * h * (1 - h);
+		}
+
+		case zExprClipPlane:
+		{
+			float a = evaluate(node.child0, pos);
+			float d = (pos - node.p0) * node.p1;
+
+			return (std::max)(a, -d);
+		}
+
+		case zExprTransform:
+		{
+			const float *m = node.inverse;
+
+			zPoint local(m[0] * pos.x + m[1] * pos.y + m[2] * pos.z + m[3], m[4] * pos.x + m[5] * pos.y + m[6] * pos.z + m[7], m[8] * pos.x + m[9] * pos.y + m[10] * pos.z + m[11]);
+			return evaluate(node.child0, local);
+		}
+
+		default:
+			throw std::invalid_argument(" error: invalid zFieldExpressionType.");
+		}
+
+		return out;
+	}
+
+}
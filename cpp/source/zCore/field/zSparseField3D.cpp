@@ -0,0 +1,152 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/field/zSparseField3D.h>
+
+namespace zSpace
+{
+
+	//---- CONSTRUCTOR
+
+	template <typename T>
+	ZSPACE_INLINE zSparseField3D<T>::zSparseField3D()
+	{
+		n_X = n_Y = n_Z = 0;
+		unit_X = unit_Y = unit_Z = 0;
+
+		background = T();
+	}
+
+	template <typename T>
+	ZSPACE_INLINE zSparseField3D<T>::zSparseField3D(zVector _minBB, zVector _maxBB, int _n_X, int _n_Y, int _n_Z, T _background)
+	{
+		minBB = _minBB;
+		maxBB = _maxBB;
+
+		n_X = _n_X;
+		n_Y = _n_Y;
+		n_Z = _n_Z;
+
+		unit_X = (maxBB.x - minBB.x) / n_X;
+		unit_Y = (maxBB.y - minBB.y) / n_Y;
+		unit_Z = (maxBB.z - minBB.z) / n_Z;
+
+		background = _background;
+	}
+
+	//---- DESTRUCTOR
+
+	template <typename T>
+	ZSPACE_INLINE zSparseField3D<T>::~zSparseField3D() {}
+
+	//---- BLOCK METHODS
+
+	template <typename T>
+	ZSPACE_INLINE int zSparseField3D<T>::numBlocks()
+	{
+		return blockKeys.size();
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zSparseField3D<T>::getBlockResolution(int &nb_X, int &nb_Y, int &nb_Z)
+	{
+		nb_X = (n_X + blockSize - 1) / blockSize;
+		nb_Y = (n_Y + blockSize - 1) / blockSize;
+		nb_Z = (n_Z + blockSize - 1) / blockSize;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE int64_t zSparseField3D<T>::getBlockKey(int b_X, int b_Y, int b_Z)
+	{
+		// 21 bits per block coordinate
+		return ((int64_t)b_X << 42) | ((int64_t)b_Y << 21) | (int64_t)b_Z;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zSparseField3D<T>::getBlockCoordinates(int64_t key, int &b_X, int &b_Y, int &b_Z)
+	{
+		const int64_t mask = (1 << 21) - 1;
+
+		b_X = (int)((key >> 42) & mask);
+		b_Y = (int)((key >> 21) & mask);
+		b_Z = (int)(key & mask);
+	}
+
+	template <typename T>
+	ZSPACE_INLINE int zSparseField3D<T>::getBlockIndex(int64_t key)
+	{
+		auto it = blockIndices.find(key);
+		return (it == blockIndices.end()) ? -1 : it->second;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE int zSparseField3D<T>::activateBlock(int64_t key)
+	{
+		int id = getBlockIndex(key);
+		if (id != -1) return id;
+
+		id = blockKeys.size();
+
+		blockKeys.push_back(key);
+		blockIndices[key] = id;
+		blockValues.resize(blockValues.size() + blockVolume, getTileValue(key));
+
+		tileValues.erase(key);
+
+		return id;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE T zSparseField3D<T>::getTileValue(int64_t key)
+	{
+		auto it = tileValues.find(key);
+		return (it == tileValues.end()) ? background : it->second;
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zSparseField3D<T>::clear()
+	{
+		blockKeys.clear();
+		blockIndices.clear();
+		blockValues.clear();
+		tileValues.clear();
+	}
+
+	//---- VALUE METHODS
+
+	template <typename T>
+	ZSPACE_INLINE T zSparseField3D<T>::getValue(int i, int j, int k)
+	{
+		int64_t key = getBlockKey(i / blockSize, j / blockSize, k / blockSize);
+
+		int id = getBlockIndex(key);
+		if (id == -1) return getTileValue(key);
+
+		return blockValues[id * blockVolume + ((i % blockSize) * blockSize + (j % blockSize)) * blockSize + (k % blockSize)];
+	}
+
+	template <typename T>
+	ZSPACE_INLINE void zSparseField3D<T>::setValue(int i, int j, int k, T value)
+	{
+		int id = activateBlock(getBlockKey(i / blockSize, j / blockSize, k / blockSize));
+
+		blockValues[id * blockVolume + ((i % blockSize) * blockSize + (j % blockSize)) * blockSize + (k % blockSize)] = value;
+	}
+
+#if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
+	// explicit instantiation
+	template class zSparseField3D<zVector>;
+
+	template class zSparseField3D<float>;
+
+#endif
+}
@@ -0,0 +1,364 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/geometry/zKDTree.h>
+
+#include <numeric>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zKDTree::zKDTree()
+	{
+		leafSize = 16;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zKDTree::~zKDTree() {}
+
+	//---- CREATE METHODS
+
+	ZSPACE_INLINE void zKDTree::create(const zPointArray &positions, int _leafSize)
+	{
+		clear();
+
+		leafSize = (_leafSize > 0) ? _leafSize : 1;
+
+		int n = positions.size();
+		if (n == 0) return;
+
+		// the points stay in input order while building, the indicies are partitioned
+		points = positions;
+
+		indices.resize(n);
+		std::iota(indices.begin(), indices.end(), 0);
+
+		nodes.resize(getNumNodes(n));
+		nodes[0].start = 0;
+		nodes[0].end = n;
+
+		// split the top levels serially until there are enough sub trees to build in parallel
+		int numTasks = 4 * zUtilsParallel::getNumThreads();
+		int minTaskSize = (std::max)(leafSize, 4096);
+
+		zIntArray tasks = { 0 };
+
+		while ((int)tasks.size() < numTasks)
+		{
+			zIntArray nextTasks;
+			bool split = false;
+
+			for (auto &nodeId : tasks)
+			{
+				if (nodes[nodeId].end - nodes[nodeId].start > minTaskSize)
+				{
+					splitNode(nodeId);
+
+					nextTasks.push_back(nodeId + 1);
+					nextTasks.push_back(nodes[nodeId].right);
+					split = true;
+				}
+				else nextTasks.push_back(nodeId);
+			}
+
+			tasks.swap(nextTasks);
+			if (!split) break;
+		}
+
+		zUtilsParallel::forEach(0, tasks.size(), [&](int i)
+		{
+			buildNode(tasks[i]);
+		}, 1);
+
+		// reorder the points in to one block per node
+		zPointArray sorted(n);
+
+		zUtilsParallel::forEach(0, n, [&](int i)
+		{
+			sorted[i] = points[indices[i]];
+		}, 4096);
+
+		points.swap(sorted);
+	}
+
+	ZSPACE_INLINE void zKDTree::clear()
+	{
+		nodes.clear();
+		points.clear();
+		indices.clear();
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zKDTree::numPoints()
+	{
+		return points.size();
+	}
+
+	ZSPACE_INLINE int zKDTree::numNodes()
+	{
+		return nodes.size();
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE int zKDTree::getClosest(const zPoint &pos, double &distanceSquared, double maxDistance)
+	{
+		zIntArray neighbours;
+		zDoubleArray distances;
+
+		double maxDistanceSq = (maxDistance < 0) ? std::numeric_limits<double>::max() : maxDistance * maxDistance;
+
+		distanceSquared = 0;
+		if (searchNearest(pos, 1, maxDistanceSq, neighbours, distances) == 0) return -1;
+
+		distanceSquared = distances[0];
+		return neighbours[0];
+	}
+
+	ZSPACE_INLINE void zKDTree::getClosest(const zPointArray &positions, zIntArray &closest, zDoubleArray &distancesSquared, double maxDistance)
+	{
+		closest.assign(positions.size(), -1);
+		distancesSquared.assign(positions.size(), 0);
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			closest[i] = getClosest(positions[i], distancesSquared[i], maxDistance);
+		}, 64);
+	}
+
+	ZSPACE_INLINE int zKDTree::getKNearest(const zPoint &pos, int k, zIntArray &neighbours, zDoubleArray &distancesSquared, double maxDistance)
+	{
+		double maxDistanceSq = (maxDistance < 0) ? std::numeric_limits<double>::max() : maxDistance * maxDistance;
+		return searchNearest(pos, k, maxDistanceSq, neighbours, distancesSquared);
+	}
+
+	ZSPACE_INLINE void zKDTree::getKNearest(const zPointArray &positions, int k, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared, double maxDistance)
+	{
+		neighbours.resize(positions.size());
+		distancesSquared.resize(positions.size());
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			getKNearest(positions[i], k, neighbours[i], distancesSquared[i], maxDistance);
+		}, 64);
+	}
+
+	ZSPACE_INLINE int zKDTree::getInRadius(const zPoint &pos, double radius, zIntArray &neighbours, zDoubleArray &distancesSquared)
+	{
+		neighbours.clear();
+		distancesSquared.clear();
+
+		if (radius < 0) return 0;
+
+		return searchNearest(pos, std::numeric_limits<int>::max(), radius * radius, neighbours, distancesSquared);
+	}
+
+	ZSPACE_INLINE void zKDTree::getInRadius(const zPointArray &positions, double radius, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared)
+	{
+		neighbours.resize(positions.size());
+		distancesSquared.resize(positions.size());
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			getInRadius(positions[i], radius, neighbours[i], distancesSquared[i]);
+		}, 64);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE int zKDTree::getNumNodes(int count)
+	{
+		if (count <= leafSize) return 1;
+		return 1 + getNumNodes(count / 2) + getNumNodes(count - count / 2);
+	}
+
+	ZSPACE_INLINE void zKDTree::computeBounds(int nodeId)
+	{
+		zKDTreeNode &node = nodes[nodeId];
+
+		for (int j = 0; j < 3; j++)
+		{
+			node.minBB[j] = std::numeric_limits<float>::max();
+			node.maxBB[j] = std::numeric_limits<float>::lowest();
+		}
+
+		for (int i = node.start; i < node.end; i++)
+		{
+			zPoint &p = points[indices[i]];
+
+			node.minBB[0] = (std::min)(node.minBB[0], p.x);
+			node.minBB[1] = (std::min)(node.minBB[1], p.y);
+			node.minBB[2] = (std::min)(node.minBB[2], p.z);
+
+			node.maxBB[0] = (std::max)(node.maxBB[0], p.x);
+			node.maxBB[1] = (std::max)(node.maxBB[1], p.y);
+			node.maxBB[2] = (std::max)(node.maxBB[2], p.z);
+		}
+	}
+
+	ZSPACE_INLINE void zKDTree::splitNode(int nodeId)
+	{
+		computeBounds(nodeId);
+
+		zKDTreeNode &node = nodes[nodeId];
+		int count = node.end - node.start;
+
+		if (count <= leafSize)
+		{
+			node.right = -1;
+			return;
+		}
+
+		// widest axis
+		int axis = 0;
+		float extent = node.maxBB[0] - node.minBB[0];
+
+		for (int j = 1; j < 3; j++)
+		{
+			if (node.maxBB[j] - node.minBB[j] > extent)
+			{
+				extent = node.maxBB[j] - node.minBB[j];
+				axis = j;
+			}
+		}
+
+		int mid = node.start + count / 2;
+
+		std::nth_element(indices.begin() + node.start, indices.begin() + mid, indices.begin() + node.end, [&](int a, int b)
+		{
+			float valA = (axis == 0) ? points[a].x : ((axis == 1) ? points[a].y : points[a].z);
+			float valB = (axis == 0) ? points[b].x : ((axis == 1) ? points[b].y : points[b].z);
+
+			return (valA != valB) ? valA < valB : a < b;
+		});
+
+		node.right = nodeId + 1 + getNumNodes(mid - node.start);
+
+		nodes[nodeId + 1].start = node.start;
+		nodes[nodeId + 1].end = mid;
+
+		nodes[node.right].start = mid;
+		nodes[node.right].end = node.end;
+	}
+
+	ZSPACE_INLINE void zKDTree::buildNode(int nodeId)
+	{
+		splitNode(nodeId);
+
+		if (nodes[nodeId].right == -1) return;
+
+		buildNode(nodeId + 1);
+		buildNode(nodes[nodeId].right);
+	}
+
+	ZSPACE_INLINE double zKDTree::getDistanceSquared(int nodeId, const zPoint &pos)
+	{
+		zKDTreeNode &node = nodes[nodeId];
+		double p[3] = { pos.x, pos.y, pos.z };
+
+		double out = 0;
+		for (int j = 0; j < 3; j++)
+		{
+			double d = 0;
+			if (p[j] < node.minBB[j]) d = node.minBB[j] - p[j];
+			else if (p[j] > node.maxBB[j]) d = p[j] - node.maxBB[j];
+
+			out += d * d;
+		}
+
+		return out;
+	}
+
+	ZSPACE_INLINE int zKDTree::searchNearest(const zPoint &pos, int k, double maxDistanceSq, zIntArray &neighbours, zDoubleArray &distancesSquared)
+	{
+		neighbours.clear();
+		distancesSquared.clear();
+
+		if (k <= 0 || nodes.size() == 0) return 0;
+
+		// max heap of squared distance and input index
+		vector<pair<double, int>> heap;
+		vector<pair<double, int>> stack;
+
+		stack.push_back(pair<double, int>(getDistanceSquared(0, pos), 0));
+
+		while (stack.size() > 0)
+		{
+			pair<double, int> current = stack.back();
+			stack.pop_back();
+
+			if (current.first > maxDistanceSq) continue;
+			if ((int)heap.size() == k && current.first > heap.front().first) continue;
+
+			zKDTreeNode &node = nodes[current.second];
+
+			if (node.right == -1)
+			{
+				for (int i = node.start; i < node.end; i++)
+				{
+					double dx = points[i].x - pos.x;
+					double dy = points[i].y - pos.y;
+					double dz = points[i].z - pos.z;
+
+					pair<double, int> candidate(dx * dx + dy * dy + dz * dz, indices[i]);
+					if (candidate.first > maxDistanceSq) continue;
+
+					if ((int)heap.size() < k)
+					{
+						heap.push_back(candidate);
+						std::push_heap(heap.begin(), heap.end());
+					}
+					else if (candidate < heap.front())
+					{
+						std::pop_heap(heap.begin(), heap.end());
+						heap.back() = candidate;
+						std::push_heap(heap.begin(), heap.end());
+					}
+				}
+
+				continue;
+			}
+
+			// closer child on top of the stack
+			pair<double, int> left(getDistanceSquared(current.second + 1, pos), current.second + 1);
+			pair<double, int> right(getDistanceSquared(node.right, pos), node.right);
+
+			if (left.first <= right.first)
+			{
+				stack.push_back(right);
+				stack.push_back(left);
+			}
+			else
+			{
+				stack.push_back(left);
+				stack.push_back(right);
+			}
+		}
+
+		std::sort_heap(heap.begin(), heap.end());
+
+		neighbours.resize(heap.size());
+		distancesSquared.resize(heap.size());
+
+		for (int i = 0; i < (int)heap.size(); i++)
+		{
+			distancesSquared[i] = heap[i].first;
+			neighbours[i] = heap[i].second;
+		}
+
+		return neighbours.size();
+	}
+
+}
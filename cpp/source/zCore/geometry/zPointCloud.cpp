@@ -128,4 +128,26 @@ namespace zSpace
 		positionVertex.erase(removeHashKey);
 	}
 
+	ZSPACE_INLINE void zPointCloud::setPositionMap(int precisionfactor)
+	{
+		double factor = pow(10, precisionfactor);
+		int numPositions = vertexPositions.size();
+
+		vector<string> hashKeys(numPositions);
+
+		zUtilsParallel::forEach(0, numPositions, [&](int i)
+		{
+			double x = std::round(vertexPositions[i].x *factor) / factor;
+			double y = std::round(vertexPositions[i].y *factor) / factor;
+			double z = std::round(vertexPositions[i].z *factor) / factor;
+
+			hashKeys[i] = (to_string(x) + "," + to_string(y) + "," + to_string(z));
+		}, 1 << 14);
+
+		positionVertex.clear();
+		positionVertex.reserve(numPositions);
+
+		for (int i = 0; i < numPositions; i++) positionVertex[std::move(hashKeys[i])] = i;
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,643 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/geometry/zPointCloudStore.h>
+
+#include <queue>
+#include <filesystem>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zPointCloudStore::zPointCloudStore()
+	{
+		maxTilePoints = 65536;
+		maxDepth = 16;
+		lodStride = 8;
+
+		memoryBudget = (size_t)1 << 28;
+
+		writable = false;
+		readable = false;
+
+		numPending = 0;
+		residentBytes = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zPointCloudStore::~zPointCloudStore()
+	{
+		close();
+	}
+
+	//---- CREATE METHODS
+
+	ZSPACE_INLINE bool zPointCloudStore::create(string _directory, zPoint &minBB, zPoint &maxBB, int _maxTilePoints, int _maxDepth)
+	{
+		close();
+
+		std::error_code ec;
+		std::filesystem::create_directories(_directory, ec);
+
+		if (!std::filesystem::is_directory(_directory, ec))
+		{
+			cout << " error in creating directory  " << _directory.c_str() << endl;
+			return false;
+		}
+
+		// a stale index would describe tiles which are about to be overwritten
+		std::filesystem::remove(_directory + "/index.zpcs", ec);
+
+		directory = _directory;
+		maxTilePoints = (_maxTilePoints > 0) ? _maxTilePoints : 1;
+		maxDepth = (_maxDepth > 0) ? _maxDepth : 0;
+
+		// cubic root cell, so the cells keep their aspect ratio
+		zVector size = maxBB - minBB;
+		float extent = (std::max)((std::max)(size.x, size.y), size.z);
+		if (extent <= 0) extent = 1;
+
+		float cellMin[3] = { minBB.x, minBB.y, minBB.z };
+		float cellMax[3] = { minBB.x + extent, minBB.y + extent, minBB.z + extent };
+
+		addNode(cellMin, cellMax, 0);
+
+		writable = true;
+		return true;
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::addPoints(const zPoint* positions, const zColor* colors, size_t count)
+	{
+		if (!writable) return;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			zPointStoreRecord record;
+			record.x = positions[i].x;
+			record.y = positions[i].y;
+			record.z = positions[i].z;
+
+			if (colors != nullptr)
+			{
+				record.r = (uint8_t)std::round(coreUtils.ofClamp(colors[i].r, 0.0f, 1.0f) * 255.0f);
+				record.g = (uint8_t)std::round(coreUtils.ofClamp(colors[i].g, 0.0f, 1.0f) * 255.0f);
+				record.b = (uint8_t)std::round(coreUtils.ofClamp(colors[i].b, 0.0f, 1.0f) * 255.0f);
+				record.a = (uint8_t)std::round(coreUtils.ofClamp(colors[i].a, 0.0f, 1.0f) * 255.0f);
+			}
+			else record.r = record.g = record.b = record.a = 255;
+
+			insert(record, 0);
+
+			if (numPending * sizeof(zPointStoreRecord) > memoryBudget) flushAll();
+		}
+	}
+
+	ZSPACE_INLINE bool zPointCloudStore::finalise()
+	{
+		if (!writable) return readable;
+
+		bool chk = flushAll();
+
+		vector<vector<zPointStoreRecord>>().swap(pending);
+		numPending = 0;
+
+		int32_t info[4] = { maxTilePoints, maxDepth, lodStride, 0 };
+
+		zUtilsBinaryWriter writer;
+		writer.addBlock(zBinStoreNodes, nodes.data(), sizeof(zPointStoreNode), nodes.size());
+		writer.addBlock(zBinStoreInfo, info, sizeof(info), 1);
+
+		chk = chk && writer.write(directory + "/index.zpcs", "ZPCS", 1);
+
+		if (!chk)
+		{
+			cout << " error in writing point cloud store  " << directory.c_str() << endl;
+			return false;
+		}
+
+		writable = false;
+		readable = true;
+
+		tiles.clear();
+		tiles.resize(nodes.size());
+		tileOrderIters.assign(nodes.size(), tileOrder.end());
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zPointCloudStore::open(string _directory)
+	{
+		close();
+
+		zUtilsBinaryReader reader;
+
+		if (!reader.open(_directory + "/index.zpcs", "ZPCS", 1))
+		{
+			cout << " error in opening file  " << (_directory + "/index.zpcs").c_str() << endl;
+			return false;
+		}
+
+		size_t nN = 0, nI = 0;
+		const zPointStoreNode* nodeData = (const zPointStoreNode*)reader.getBlock(zBinStoreNodes, sizeof(zPointStoreNode), nN);
+		const int32_t* info = (const int32_t*)reader.getBlock(zBinStoreInfo, 4 * sizeof(int32_t), nI);
+
+		bool valid = nodeData != nullptr && info != nullptr && nN > 0 && nI == 1;
+
+		for (size_t i = 0; i < nN && valid; i++)
+		{
+			for (int k = 0; k < 8; k++) valid = valid && nodeData[i].children[k] >= -1 && nodeData[i].children[k] < (int)nN;
+		}
+
+		if (!valid)
+		{
+			cout << " error in reading file  " << (_directory + "/index.zpcs").c_str() << " : invalid or incomplete store index." << endl;
+			return false;
+		}
+
+		directory = _directory;
+		nodes.assign(nodeData, nodeData + nN);
+
+		maxTilePoints = info[0];
+		maxDepth = info[1];
+		lodStride = info[2];
+
+		readable = true;
+
+		tiles.resize(nodes.size());
+		tileOrderIters.assign(nodes.size(), tileOrder.end());
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::close()
+	{
+		if (writable) finalise();
+
+		evictAll();
+
+		nodes.clear();
+		pending.clear();
+		tiles.clear();
+		tileOrderIters.clear();
+
+		numPending = 0;
+		writable = false;
+		readable = false;
+	}
+
+	//---- MEMORY METHODS
+
+	ZSPACE_INLINE void zPointCloudStore::setMemoryBudget(size_t numBytes)
+	{
+		memoryBudget = numBytes;
+
+		// trim the mapped tiles to the new budget
+		while (residentBytes > memoryBudget && !tileOrder.empty()) evict(tileOrder.back());
+	}
+
+	ZSPACE_INLINE size_t zPointCloudStore::getMemoryBudget()
+	{
+		return memoryBudget;
+	}
+
+	ZSPACE_INLINE size_t zPointCloudStore::getResidentBytes()
+	{
+		return residentBytes;
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::evictAll()
+	{
+		while (!tileOrder.empty()) evict(tileOrder.back());
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE bool zPointCloudStore::isReadable()
+	{
+		return readable;
+	}
+
+	ZSPACE_INLINE size_t zPointCloudStore::numPoints()
+	{
+		return (nodes.size() > 0) ? (size_t)nodes[0].totalPoints : 0;
+	}
+
+	ZSPACE_INLINE int zPointCloudStore::numNodes()
+	{
+		return (int)nodes.size();
+	}
+
+	ZSPACE_INLINE int zPointCloudStore::getDepth()
+	{
+		int out = 0;
+		for (auto &node : nodes) out = (std::max)(out, (int)node.depth);
+
+		return out;
+	}
+
+	ZSPACE_INLINE zPointStoreNode& zPointCloudStore::getNode(int nodeId)
+	{
+		if (nodeId < 0 || nodeId >= (int)nodes.size()) throw std::invalid_argument(" error: index out of bounds.");
+
+		return nodes[nodeId];
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::getBounds(zPoint &minBB, zPoint &maxBB)
+	{
+		if (numPoints() == 0)
+		{
+			minBB = maxBB = zPoint();
+			return;
+		}
+
+		minBB = zPoint(nodes[0].pointsMin[0], nodes[0].pointsMin[1], nodes[0].pointsMin[2]);
+		maxBB = zPoint(nodes[0].pointsMax[0], nodes[0].pointsMax[1], nodes[0].pointsMax[2]);
+	}
+
+	ZSPACE_INLINE const zPointStoreRecord* zPointCloudStore::getTile(int nodeId, size_t &count)
+	{
+		count = 0;
+		if (!readable || nodeId < 0 || nodeId >= (int)nodes.size() || nodes[nodeId].numPoints == 0) return nullptr;
+
+		if (tiles[nodeId])
+		{
+			// most recently used first
+			tileOrder.splice(tileOrder.begin(), tileOrder, tileOrderIters[nodeId]);
+		}
+		else
+		{
+			unique_ptr<zUtilsMappedFile> tile(new zUtilsMappedFile());
+
+			if (!tile->open(getTilePath(nodeId)) || tile->getSize() < nodes[nodeId].numPoints * sizeof(zPointStoreRecord))
+			{
+				cout << " error in opening file  " << getTilePath(nodeId).c_str() << endl;
+				return nullptr;
+			}
+
+			residentBytes += tile->getSize();
+			tiles[nodeId] = std::move(tile);
+
+			tileOrder.push_front(nodeId);
+			tileOrderIters[nodeId] = tileOrder.begin();
+
+			// the requested tile stays mapped even if it exceeds the budget on its own
+			while (residentBytes > memoryBudget && tileOrder.size() > 1) evict(tileOrder.back());
+		}
+
+		count = (size_t)nodes[nodeId].numPoints;
+		return (const zPointStoreRecord*)tiles[nodeId]->getData();
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::getNodes(zPoint &minBB, zPoint &maxBB, int lod, zIntArray &nodeIds)
+	{
+		nodeIds.clear();
+		if (nodes.size() == 0) return;
+
+		zIntArray stack;
+		stack.push_back(0);
+
+		while (stack.size() > 0)
+		{
+			int id = stack.back();
+			stack.pop_back();
+
+			zPointStoreNode &node = nodes[id];
+
+			if (node.totalPoints == 0) continue;
+			if (lod >= 0 && node.depth > lod) continue;
+
+			if (node.pointsMax[0] < minBB.x || node.pointsMin[0] > maxBB.x) continue;
+			if (node.pointsMax[1] < minBB.y || node.pointsMin[1] > maxBB.y) continue;
+			if (node.pointsMax[2] < minBB.z || node.pointsMin[2] > maxBB.z) continue;
+
+			if (node.numPoints > 0) nodeIds.push_back(id);
+
+			for (int k = 7; k >= 0; k--) if (node.children[k] >= 0) stack.push_back(node.children[k]);
+		}
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::getPoints(zPoint &minBB, zPoint &maxBB, int lod, zPointArray &positions, zColorArray &colors)
+	{
+		positions.clear();
+		colors.clear();
+
+		zIntArray nodeIds;
+		getNodes(minBB, maxBB, lod, nodeIds);
+
+		for (int id : nodeIds)
+		{
+			size_t count;
+			const zPointStoreRecord* records = getTile(id, count);
+
+			// the tile may be unmapped by the next getTile call, so its points are copied out now
+			for (size_t i = 0; i < count; i++)
+			{
+				const zPointStoreRecord &rec = records[i];
+
+				if (rec.x < minBB.x || rec.x > maxBB.x || rec.y < minBB.y || rec.y > maxBB.y || rec.z < minBB.z || rec.z > maxBB.z) continue;
+
+				positions.push_back(zPoint(rec.x, rec.y, rec.z));
+				colors.push_back(zColor(rec.r / 255.0f, rec.g / 255.0f, rec.b / 255.0f, rec.a / 255.0f));
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::getKNearest(zPoint &pos, int k, zPointArray &positions, zFloatArray &distances)
+	{
+		positions.clear();
+		distances.clear();
+
+		if (k <= 0 || numPoints() == 0) return;
+
+		// closest nodes first, and the current k nearest with the farthest on top
+		priority_queue<pair<float, int>, vector<pair<float, int>>, greater<pair<float, int>>> nodeQueue;
+		priority_queue<pair<float, zPoint>, vector<pair<float, zPoint>>, function<bool(const pair<float, zPoint>&, const pair<float, zPoint>&)>> nearest([](const pair<float, zPoint> &a, const pair<float, zPoint> &b) { return a.first < b.first; });
+
+		nodeQueue.push(pair<float, int>(getSquaredDistance(0, pos), 0));
+
+		while (!nodeQueue.empty())
+		{
+			pair<float, int> current = nodeQueue.top();
+			nodeQueue.pop();
+
+			if ((int)nearest.size() == k && current.first > nearest.top().first) break;
+
+			size_t count;
+			const zPointStoreRecord* records = getTile(current.second, count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				float dx = records[i].x - pos.x;
+				float dy = records[i].y - pos.y;
+				float dz = records[i].z - pos.z;
+				float d = dx * dx + dy * dy + dz * dz;
+
+				if ((int)nearest.size() < k) nearest.push(pair<float, zPoint>(d, zPoint(records[i].x, records[i].y, records[i].z)));
+				else if (d < nearest.top().first)
+				{
+					nearest.pop();
+					nearest.push(pair<float, zPoint>(d, zPoint(records[i].x, records[i].y, records[i].z)));
+				}
+			}
+
+			zPointStoreNode &node = nodes[current.second];
+
+			for (int c = 0; c < 8; c++)
+			{
+				int child = node.children[c];
+				if (child < 0 || nodes[child].totalPoints == 0) continue;
+
+				float d = getSquaredDistance(child, pos);
+				if ((int)nearest.size() == k && d > nearest.top().first) continue;
+
+				nodeQueue.push(pair<float, int>(d, child));
+			}
+		}
+
+		positions.resize(nearest.size());
+		distances.resize(nearest.size());
+
+		for (int i = (int)nearest.size() - 1; i >= 0; i--)
+		{
+			positions[i] = nearest.top().second;
+			distances[i] = sqrt(nearest.top().first);
+			nearest.pop();
+		}
+	}
+
+	ZSPACE_INLINE bool zPointCloudStore::getClosestPoint(zPoint &pos, zPoint &closest)
+	{
+		zPointArray positions;
+		zFloatArray distances;
+		getKNearest(pos, 1, positions, distances);
+
+		if (positions.size() == 0) return false;
+
+		closest = positions[0];
+		return true;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE string zPointCloudStore::getTilePath(int nodeId)
+	{
+		return directory + "/tile_" + to_string(nodeId) + ".bin";
+	}
+
+	ZSPACE_INLINE int zPointCloudStore::addNode(const float* cellMin, const float* cellMax, int depth)
+	{
+		zPointStoreNode node;
+
+		for (int k = 0; k < 3; k++)
+		{
+			node.cellMin[k] = cellMin[k];
+			node.cellMax[k] = cellMax[k];
+
+			node.pointsMin[k] = std::numeric_limits<float>::max();
+			node.pointsMax[k] = std::numeric_limits<float>::lowest();
+		}
+
+		for (int k = 0; k < 8; k++) node.children[k] = -1;
+
+		node.depth = depth;
+		node.leaf = 1;
+		node.numPoints = 0;
+		node.totalPoints = 0;
+		node.numVisits = 0;
+
+		nodes.push_back(node);
+		pending.push_back(vector<zPointStoreRecord>());
+
+		return (int)nodes.size() - 1;
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::insert(const zPointStoreRecord &record, int nodeId)
+	{
+		int id = nodeId;
+		const float pos[3] = { record.x, record.y, record.z };
+
+		while (true)
+		{
+			// nodes may be reallocated when a child is added, so they are always accessed by index
+			for (int k = 0; k < 3; k++)
+			{
+				nodes[id].pointsMin[k] = (std::min)(nodes[id].pointsMin[k], pos[k]);
+				nodes[id].pointsMax[k] = (std::max)(nodes[id].pointsMax[k], pos[k]);
+			}
+
+			nodes[id].totalPoints++;
+
+			if (nodes[id].leaf)
+			{
+				pending[id].push_back(record);
+				nodes[id].numPoints++;
+				numPending++;
+
+				if (nodes[id].numPoints > (uint64_t)maxTilePoints && nodes[id].depth < maxDepth) split(id);
+				return;
+			}
+
+			// level of detail sample
+			nodes[id].numVisits++;
+
+			if (nodes[id].numVisits % lodStride == 0 && nodes[id].numPoints < (uint64_t)maxTilePoints)
+			{
+				pending[id].push_back(record);
+				nodes[id].numPoints++;
+				numPending++;
+				return;
+			}
+
+			// child octant, points outside the root cell fall in to the border cells
+			float center[3];
+			int octant = 0;
+
+			for (int k = 0; k < 3; k++)
+			{
+				center[k] = (nodes[id].cellMin[k] + nodes[id].cellMax[k]) * 0.5f;
+				if (pos[k] >= center[k]) octant |= (1 << k);
+			}
+
+			if (nodes[id].children[octant] < 0)
+			{
+				float cellMin[3], cellMax[3];
+
+				for (int k = 0; k < 3; k++)
+				{
+					cellMin[k] = (octant & (1 << k)) ? center[k] : nodes[id].cellMin[k];
+					cellMax[k] = (octant & (1 << k)) ? nodes[id].cellMax[k] : center[k];
+				}
+
+				int child = addNode(cellMin, cellMax, nodes[id].depth + 1);
+				nodes[id].children[octant] = child;
+			}
+
+			id = nodes[id].children[octant];
+		}
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::split(int nodeId)
+	{
+		vector<zPointStoreRecord> records;
+		readNode(nodeId, records);
+
+		numPending -= pending[nodeId].size();
+		vector<zPointStoreRecord>().swap(pending[nodeId]);
+
+		std::error_code ec;
+		std::filesystem::remove(getTilePath(nodeId), ec);
+
+		zPointStoreNode &node = nodes[nodeId];
+		node.leaf = 0;
+		node.numPoints = 0;
+
+		// the points are already part of the sub tree of the node, so only their counts below it change
+		node.totalPoints -= records.size();
+		node.numVisits = 0;
+
+		for (auto &record : records) insert(record, nodeId);
+	}
+
+	ZSPACE_INLINE bool zPointCloudStore::flushNode(int nodeId)
+	{
+		vector<zPointStoreRecord> &records = pending[nodeId];
+		if (records.size() == 0) return true;
+
+		// points already on disk, a new tile is truncated in case of stale files
+		size_t numStored = nodes[nodeId].numPoints - records.size();
+
+		ofstream myfile;
+		myfile.open(getTilePath(nodeId).c_str(), ios::binary | ((numStored > 0) ? ios::app : ios::trunc));
+
+		if (myfile.fail())
+		{
+			cout << " error in opening file  " << getTilePath(nodeId).c_str() << endl;
+			return false;
+		}
+
+		myfile.write((const char*)records.data(), records.size() * sizeof(zPointStoreRecord));
+		bool chk = myfile.good();
+
+		myfile.close();
+
+		numPending -= records.size();
+		vector<zPointStoreRecord>().swap(records);
+
+		return chk;
+	}
+
+	ZSPACE_INLINE bool zPointCloudStore::flushAll()
+	{
+		bool chk = true;
+		for (int i = 0; i < (int)pending.size(); i++) chk = flushNode(i) && chk;
+
+		return chk;
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::readNode(int nodeId, vector<zPointStoreRecord> &records)
+	{
+		size_t numStored = nodes[nodeId].numPoints - pending[nodeId].size();
+
+		records.clear();
+		records.reserve(nodes[nodeId].numPoints);
+
+		if (numStored > 0)
+		{
+			ifstream myfile;
+			myfile.open(getTilePath(nodeId).c_str(), ios::binary);
+
+			records.resize(numStored);
+			myfile.read((char*)records.data(), numStored * sizeof(zPointStoreRecord));
+
+			if (myfile.fail())
+			{
+				cout << " error in reading file  " << getTilePath(nodeId).c_str() << endl;
+				records.clear();
+			}
+
+			myfile.close();
+		}
+
+		records.insert(records.end(), pending[nodeId].begin(), pending[nodeId].end());
+	}
+
+	ZSPACE_INLINE void zPointCloudStore::evict(int nodeId)
+	{
+		if (nodeId < 0 || nodeId >= (int)tiles.size() || !tiles[nodeId]) return;
+
+		residentBytes -= tiles[nodeId]->getSize();
+		tiles[nodeId].reset();
+
+		tileOrder.erase(tileOrderIters[nodeId]);
+		tileOrderIters[nodeId] = tileOrder.end();
+	}
+
+	ZSPACE_INLINE float zPointCloudStore::getSquaredDistance(int nodeId, zPoint &pos)
+	{
+		const float p[3] = { pos.x, pos.y, pos.z };
+		float out = 0;
+
+		for (int k = 0; k < 3; k++)
+		{
+			float d = 0;
+			if (p[k] < nodes[nodeId].pointsMin[k]) d = nodes[nodeId].pointsMin[k] - p[k];
+			else if (p[k] > nodes[nodeId].pointsMax[k]) d = p[k] - nodes[nodeId].pointsMax[k];
+
+			out += d * d;
+		}
+
+		return out;
+	}
+
+}
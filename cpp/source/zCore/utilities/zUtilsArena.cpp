@@ -0,0 +1,144 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsArena.h>
+
+namespace zSpace
+{
+	//---- zScratchArena
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zScratchArena::zScratchArena(size_t _blockSize)
+	{
+		blockSize = _blockSize;
+		currentBlock = 0;
+		currentOffset = 0;
+		lastAllocation = nullptr;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zScratchArena::~zScratchArena() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE zScratchArena& zScratchArena::threadLocal()
+	{
+		static thread_local zScratchArena arena;
+		return arena;
+	}
+
+	ZSPACE_INLINE void* zScratchArena::allocate(size_t numBytes, size_t alignment)
+	{
+		if (numBytes == 0) numBytes = 1;
+
+		while (currentBlock < (int)blocks.size())
+		{
+			zScratchBlock &block = blocks[currentBlock];
+
+			uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+			uintptr_t start = (base + currentOffset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+			if (start + numBytes <= base + block.size)
+			{
+				currentOffset = (start - base) + numBytes;
+				lastAllocation = reinterpret_cast<void*>(start);
+				return lastAllocation;
+			}
+
+			// move on to the next retained block
+			currentBlock++;
+			currentOffset = 0;
+		}
+
+		// no retained block is large enough, request a new one from the system
+		zScratchBlock block;
+		block.size = (numBytes + alignment > blockSize) ? numBytes + alignment : blockSize;
+		block.data.reset(new char[block.size]);
+
+		blocks.push_back(std::move(block));
+		currentBlock = (int)blocks.size() - 1;
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(blocks[currentBlock].data.get());
+		uintptr_t start = (base + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+		currentOffset = (start - base) + numBytes;
+		lastAllocation = reinterpret_cast<void*>(start);
+		return lastAllocation;
+	}
+
+	ZSPACE_INLINE void zScratchArena::deallocate(void* ptr)
+	{
+		// only the top of the stack can be popped, so growing containers reuse their old storage
+		if (ptr == nullptr || ptr != lastAllocation || currentBlock >= (int)blocks.size()) return;
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(blocks[currentBlock].data.get());
+		currentOffset = reinterpret_cast<uintptr_t>(ptr) - base;
+		lastAllocation = nullptr;
+	}
+
+	ZSPACE_INLINE zScratchArena::zScratchMarker zScratchArena::getMarker()
+	{
+		zScratchMarker marker;
+		marker.block = currentBlock;
+		marker.offset = currentOffset;
+
+		return marker;
+	}
+
+	ZSPACE_INLINE void zScratchArena::rewind(zScratchMarker &marker)
+	{
+		currentBlock = marker.block;
+		currentOffset = marker.offset;
+		lastAllocation = nullptr;
+	}
+
+	ZSPACE_INLINE void zScratchArena::reset()
+	{
+		currentBlock = 0;
+		currentOffset = 0;
+		lastAllocation = nullptr;
+	}
+
+	ZSPACE_INLINE void zScratchArena::release()
+	{
+		blocks.clear();
+		reset();
+	}
+
+	ZSPACE_INLINE size_t zScratchArena::getReservedBytes()
+	{
+		size_t out = 0;
+		for (auto &block : blocks) out += block.size;
+
+		return out;
+	}
+
+	//---- zScratchScope
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zScratchScope::zScratchScope()
+	{
+		arena = &zScratchArena::threadLocal();
+		marker = arena->getMarker();
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zScratchScope::~zScratchScope()
+	{
+		arena->rewind(marker);
+	}
+
+}
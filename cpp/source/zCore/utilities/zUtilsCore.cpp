@@ -67,6 +67,9 @@ namespace zSpace
 		if (type == zBMP) extension = ".bmp";
 		if (type == zPNG) extension = ".png";
 		if (type == zJPEG) extension = ".jpeg";
+		if (type == zPLY || type == zPLYASCII) extension = ".ply";
+		if (type == zXYZ) extension = ".zxyz";
+		if (type == zFIELD) extension = ".zfld";
 
 
 		for (const auto & entry : fs::directory_iterator(dirPath))
@@ -91,6 +94,9 @@ namespace zSpace
 		if (type == zTXT) extension = ".txt";
 		if (type == zCSV) extension = ".csv";
 		if (type == zBMP) extension = ".bmp";
+		if (type == zPLY || type == zPLYASCII) extension = ".ply";
+		if (type == zXYZ) extension = ".zxyz";
+		if (type == zFIELD) extension = ".zfld";
 
 		for (const auto & entry : fs::directory_iterator(dirPath))
 		{
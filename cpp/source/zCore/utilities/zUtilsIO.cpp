@@ -0,0 +1,2436 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsIO.h>
+#include<headers/zCore/utilities/zUtilsParallel.h>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace zSpace
+{
+	//---- zUtilsMappedFile
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsMappedFile::zUtilsMappedFile()
+	{
+		data = nullptr;
+		size = 0;
+		fileHandle = nullptr;
+		mapHandle = nullptr;
+	}
+
+	ZSPACE_INLINE zUtilsMappedFile::zUtilsMappedFile(string path)
+	{
+		data = nullptr;
+		size = 0;
+		fileHandle = nullptr;
+		mapHandle = nullptr;
+
+		open(path);
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsMappedFile::~zUtilsMappedFile()
+	{
+		close();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsMappedFile::open(string path)
+	{
+		close();
+
+#if defined(_WIN32)
+		HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (hFile == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(hFile, &fileSize))
+		{
+			CloseHandle(hFile);
+			return false;
+		}
+
+		fileHandle = hFile;
+		size = (size_t)fileSize.QuadPart;
+
+		// empty files can not be mapped, but are still valid
+		if (size == 0) return true;
+
+		HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (hMap == NULL)
+		{
+			close();
+			return false;
+		}
+
+		mapHandle = hMap;
+
+		data = (const char*)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			close();
+			return false;
+		}
+#else
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) return false;
+
+		struct stat st;
+		if (fstat(fd, &st) != 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		fileHandle = reinterpret_cast<void*>((intptr_t)fd + 1);
+		size = (size_t)st.st_size;
+
+		// empty files can not be mapped, but are still valid
+		if (size == 0) return true;
+
+		void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr == MAP_FAILED)
+		{
+			close();
+			return false;
+		}
+
+		madvise(addr, size, MADV_SEQUENTIAL);
+		data = (const char*)addr;
+#endif
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsMappedFile::close()
+	{
+#if defined(_WIN32)
+		if (data != nullptr) UnmapViewOfFile(data);
+		if (mapHandle != nullptr) CloseHandle((HANDLE)mapHandle);
+		if (fileHandle != nullptr) CloseHandle((HANDLE)fileHandle);
+#else
+		if (data != nullptr) munmap((void*)data, size);
+		if (fileHandle != nullptr) ::close((int)(reinterpret_cast<intptr_t>(fileHandle) - 1));
+#endif
+
+		data = nullptr;
+		size = 0;
+		fileHandle = nullptr;
+		mapHandle = nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsMappedFile::isOpen()
+	{
+		return (fileHandle != nullptr);
+	}
+
+	ZSPACE_INLINE const char* zUtilsMappedFile::getData()
+	{
+		return data;
+	}
+
+	ZSPACE_INLINE size_t zUtilsMappedFile::getSize()
+	{
+		return size;
+	}
+
+	ZSPACE_INLINE void zUtilsMappedFile::getLineChunks(int numChunks, vector<pair<size_t, size_t>> &chunks, size_t start)
+	{
+		chunks.clear();
+
+		if (start >= size) return;
+		if (numChunks < 1) numChunks = 1;
+
+		size_t range = size - start;
+		size_t chunkStart = start;
+
+		for (int i = 1; i <= numChunks && chunkStart < size; i++)
+		{
+			size_t chunkEnd = (i == numChunks) ? size : start + (size_t)(((double)range * i) / numChunks);
+			if (chunkEnd < chunkStart) chunkEnd = chunkStart;
+
+			// move the split to the start of the next line
+			const char* nl = (chunkEnd < size) ? (const char*)memchr(data + chunkEnd, '\n', size - chunkEnd) : nullptr;
+			chunkEnd = (nl == nullptr) ? size : (size_t)(nl - data) + 1;
+
+			chunks.push_back(pair<size_t, size_t>(chunkStart, chunkEnd));
+			chunkStart = chunkEnd;
+		}
+	}
+
+	//---- zUtilsTextCursor
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsTextCursor::zUtilsTextCursor(const char* _begin, const char* _end)
+	{
+		ptr = _begin;
+		end = _end;
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsTextCursor::atEnd()
+	{
+		return ptr >= end;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::atLineEnd()
+	{
+		skipSpaces();
+		return (ptr >= end || *ptr == '\n');
+	}
+
+	ZSPACE_INLINE void zUtilsTextCursor::skipSpaces()
+	{
+		while (ptr < end && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r')) ptr++;
+	}
+
+	ZSPACE_INLINE void zUtilsTextCursor::skipLine()
+	{
+		const char* nl = (ptr < end) ? (const char*)memchr(ptr, '\n', end - ptr) : nullptr;
+		ptr = (nl == nullptr) ? end : nl + 1;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::skipChar(char c)
+	{
+		if (ptr < end && *ptr == c)
+		{
+			ptr++;
+			return true;
+		}
+
+		return false;
+	}
+
+	ZSPACE_INLINE void zUtilsTextCursor::skipToken()
+	{
+		while (ptr < end && *ptr != ' ' && *ptr != '\t' && *ptr != '\r' && *ptr != '\n') ptr++;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::readToken(const char* &token, size_t &length, const char* delimiters)
+	{
+		skipSpaces();
+
+		token = ptr;
+		while (ptr < end && *ptr != ' ' && *ptr != '\t' && *ptr != '\r' && *ptr != '\n' && strchr(delimiters, *ptr) == nullptr) ptr++;
+
+		length = ptr - token;
+		return (length > 0);
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::matchToken(const char* keyword)
+	{
+		const char* start = ptr;
+
+		const char* token;
+		size_t length;
+		if (readToken(token, length) && length == strlen(keyword) && strncmp(token, keyword, length) == 0) return true;
+
+		ptr = start;
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::readDouble(double &value)
+	{
+		skipSpaces();
+		if (ptr < end && *ptr == '+') ptr++;
+
+		from_chars_result res = from_chars(ptr, end, value);
+		if (res.ec != errc()) return false;
+
+		ptr = res.ptr;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::readFloat(float &value)
+	{
+		double val;
+		if (!readDouble(val)) return false;
+
+		value = (float)val;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::readInt(int &value)
+	{
+		skipSpaces();
+		if (ptr < end && *ptr == '+') ptr++;
+
+		from_chars_result res = from_chars(ptr, end, value);
+		if (res.ec != errc()) return false;
+
+		ptr = res.ptr;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextCursor::readInt64(int64_t &value)
+	{
+		skipSpaces();
+		if (ptr < end && *ptr == '+') ptr++;
+
+		from_chars_result res = from_chars(ptr, end, value);
+		if (res.ec != errc()) return false;
+
+		ptr = res.ptr;
+		return true;
+	}
+
+	//---- zUtilsTextWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsTextWriter::zUtilsTextWriter(int _precision)
+	{
+		size = 0;
+		precision = _precision;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsTextWriter::~zUtilsTextWriter() {}
+
+	//---- SET METHODS
+
+	ZSPACE_INLINE void zUtilsTextWriter::setPrecision(int _precision)
+	{
+		precision = _precision;
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zUtilsTextWriter::getPrecision()
+	{
+		return precision;
+	}
+
+	ZSPACE_INLINE const char* zUtilsTextWriter::getData()
+	{
+		return buffer.data();
+	}
+
+	ZSPACE_INLINE size_t zUtilsTextWriter::getSize()
+	{
+		return size;
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zUtilsTextWriter::reserve(size_t numChars)
+	{
+		if (size + numChars <= buffer.size()) return;
+
+		size_t newSize = buffer.size() * 2;
+		if (newSize < size + numChars) newSize = size + numChars;
+		if (newSize < 4096) newSize = 4096;
+
+		buffer.resize(newSize);
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::write(char c)
+	{
+		reserve(1);
+		buffer[size++] = c;
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::write(const char* str)
+	{
+		size_t length = strlen(str);
+
+		reserve(length);
+		memcpy(buffer.data() + size, str, length);
+		size += length;
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::write(int value)
+	{
+		reserve(16);
+
+		to_chars_result res = to_chars(buffer.data() + size, buffer.data() + buffer.size(), value);
+		size = res.ptr - buffer.data();
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::write(float value)
+	{
+		write((double)value);
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::write(double value)
+	{
+		// enough for the sign, all significant digits, the decimal point and the exponent
+		reserve(precision + 16);
+
+		to_chars_result res = to_chars(buffer.data() + size, buffer.data() + buffer.size(), value, chars_format::general, precision);
+		size = res.ptr - buffer.data();
+	}
+
+	ZSPACE_INLINE void zUtilsTextWriter::clear()
+	{
+		size = 0;
+	}
+
+	ZSPACE_INLINE bool zUtilsTextWriter::flush(ostream &out)
+	{
+		if (size > 0) out.write(buffer.data(), size);
+		size = 0;
+
+		return out.good();
+	}
+
+
+	//---- zUtilsCSVLayout
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsCSVLayout::zUtilsCSVLayout()
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			positionColumns[k] = k;
+			colorColumns[k] = -1;
+		}
+
+		colorScale = 1.0f / 255.0f;
+		skipVertexToken = true;
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsCSVLayout::hasColors()
+	{
+		return colorColumns[0] >= 0 && colorColumns[1] >= 0 && colorColumns[2] >= 0;
+	}
+
+	ZSPACE_INLINE int zUtilsCSVLayout::getNumColumns()
+	{
+		int out = 0;
+
+		for (int k = 0; k < 3; k++)
+		{
+			out = (std::max)(out, positionColumns[k] + 1);
+			if (hasColors()) out = (std::max)(out, colorColumns[k] + 1);
+		}
+
+		for (int col : scalarColumns) out = (std::max)(out, col + 1);
+
+		return out;
+	}
+
+	//---- zUtilsBinaryWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryWriter::zUtilsBinaryWriter() {}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryWriter::~zUtilsBinaryWriter() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::addBlock(int type, const void* data, size_t stride, size_t count)
+	{
+		zUtilsBinaryBlock block;
+		block.type = (uint32_t)type;
+		block.stride = (uint32_t)stride;
+		block.count = (uint64_t)count;
+		block.offset = 0;
+
+		blocks.push_back(block);
+		blockData.push_back(data);
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryWriter::write(string path, const char* magic, int version)
+	{
+		zUtilsBinaryHeader header;
+		if (!layout(header, magic, version)) return false;
+
+		ofstream myfile;
+		myfile.open(path.c_str(), ios::out | ios::binary);
+
+		if (myfile.fail())
+		{
+			cout << " error in opening file  " << path.c_str() << endl;
+			return false;
+		}
+
+		myfile.write((const char*)&header, sizeof(header));
+		if (blocks.size() > 0) myfile.write((const char*)blocks.data(), blocks.size() * sizeof(zUtilsBinaryBlock));
+
+		char padding[64] = { 0 };
+		uint64_t position = sizeof(zUtilsBinaryHeader) + blocks.size() * sizeof(zUtilsBinaryBlock);
+
+		for (int i = 0; i < (int)blocks.size(); i++)
+		{
+			myfile.write(padding, blocks[i].offset - position);
+
+			uint64_t numBytes = blocks[i].count * blocks[i].stride;
+			if (numBytes > 0) myfile.write((const char*)blockData[i], numBytes);
+
+			position = blocks[i].offset + numBytes;
+		}
+
+		bool out = myfile.good();
+		myfile.close();
+
+		return out;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryWriter::write(vector<unsigned char> &buffer, const char* magic, int version)
+	{
+		zUtilsBinaryHeader header;
+		if (!layout(header, magic, version)) return false;
+
+		buffer.assign(header.fileSize, 0);
+
+		memcpy(buffer.data(), &header, sizeof(header));
+		if (blocks.size() > 0) memcpy(buffer.data() + sizeof(header), blocks.data(), blocks.size() * sizeof(zUtilsBinaryBlock));
+
+		for (int i = 0; i < (int)blocks.size(); i++)
+		{
+			uint64_t numBytes = blocks[i].count * blocks[i].stride;
+			if (numBytes > 0) memcpy(buffer.data() + blocks[i].offset, blockData[i], numBytes);
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryWriter::clear()
+	{
+		blocks.clear();
+		blockData.clear();
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsBinaryWriter::layout(zUtilsBinaryHeader &header, const char* magic, int version)
+	{
+		const uint64_t alignment = 64;
+		const uint32_t byteOrder = 0x01020304;
+
+		// the format is little endian, the blocks are written from memory as is
+		if (*(const char*)&byteOrder != 0x04)
+		{
+			cout << " error: binary files can only be written on little endian platforms." << endl;
+			return false;
+		}
+
+		// block offsets
+		uint64_t offset = sizeof(zUtilsBinaryHeader) + blocks.size() * sizeof(zUtilsBinaryBlock);
+
+		for (auto &block : blocks)
+		{
+			offset = (offset + alignment - 1) & ~(alignment - 1);
+			block.offset = offset;
+			offset += block.count * block.stride;
+		}
+
+		memcpy(header.magic, magic, 4);
+		header.version = (uint32_t)version;
+		header.byteOrder = byteOrder;
+		header.numBlocks = (uint32_t)blocks.size();
+		header.fileSize = offset;
+		header.reserved = 0;
+
+		return true;
+	}
+
+	//---- zUtilsBinaryReader
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryReader::zUtilsBinaryReader()
+	{
+		data = nullptr;
+		size = 0;
+		version = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsBinaryReader::~zUtilsBinaryReader() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::open(string path, const char* magic, int maxVersion)
+	{
+		close();
+
+		if (!file.open(path)) return false;
+
+		data = file.getData();
+		size = file.getSize();
+
+		return parse(magic, maxVersion);
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::open(const void* _data, size_t _size, const char* magic, int maxVersion)
+	{
+		close();
+
+		if (_data == nullptr) return false;
+
+		data = (const char*)_data;
+		size = _size;
+
+		return parse(magic, maxVersion);
+	}
+
+	ZSPACE_INLINE void zUtilsBinaryReader::close()
+	{
+		file.close();
+		data = nullptr;
+		size = 0;
+		blocks.clear();
+		version = 0;
+	}
+
+	ZSPACE_INLINE int zUtilsBinaryReader::getVersion()
+	{
+		return version;
+	}
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::hasBlock(int type)
+	{
+		for (auto &block : blocks)
+		{
+			if (block.type == (uint32_t)type) return true;
+		}
+
+		return false;
+	}
+
+	ZSPACE_INLINE const void* zUtilsBinaryReader::getBlock(int type, size_t stride, size_t &count)
+	{
+		count = 0;
+
+		for (auto &block : blocks)
+		{
+			if (block.type != (uint32_t)type) continue;
+			if (block.stride != stride) return nullptr;
+
+			count = (size_t)block.count;
+			return data + block.offset;
+		}
+
+		return nullptr;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsBinaryReader::parse(const char* magic, int maxVersion)
+	{
+		bool valid = size >= sizeof(zUtilsBinaryHeader);
+
+		zUtilsBinaryHeader header;
+		if (valid)
+		{
+			memcpy(&header, data, sizeof(header));
+
+			valid = memcmp(header.magic, magic, 4) == 0;
+			valid = valid && header.byteOrder == 0x01020304;
+			valid = valid && header.version >= 1 && header.version <= (uint32_t)maxVersion;
+			valid = valid && header.fileSize == size;
+			valid = valid && sizeof(zUtilsBinaryHeader) + (uint64_t)header.numBlocks * sizeof(zUtilsBinaryBlock) <= size;
+		}
+
+		if (valid)
+		{
+			blocks.resize(header.numBlocks);
+			if (header.numBlocks > 0) memcpy(blocks.data(), data + sizeof(zUtilsBinaryHeader), header.numBlocks * sizeof(zUtilsBinaryBlock));
+
+			// blocks must lie within the data
+			for (auto &block : blocks)
+			{
+				if (block.stride == 0 || block.offset > size || block.count > (size - block.offset) / block.stride) valid = false;
+			}
+		}
+
+		if (!valid)
+		{
+			close();
+			return false;
+		}
+
+		version = (int)header.version;
+		return true;
+	}
+
+
+	//---- zUtilsPlyReader
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsPlyReader::zUtilsPlyReader()
+	{
+		format = zPlyASCII;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsPlyReader::~zUtilsPlyReader()
+	{
+		close();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsPlyReader::open(string path)
+	{
+		close();
+
+		if (!file.open(path)) return false;
+
+		size_t bodyStart = 0;
+		bool valid = readHeader(bodyStart) && locateElements(bodyStart);
+
+		if (!valid) close();
+		return valid;
+	}
+
+	ZSPACE_INLINE void zUtilsPlyReader::close()
+	{
+		file.close();
+		elements.clear();
+		format = zPlyASCII;
+	}
+
+	ZSPACE_INLINE int zUtilsPlyReader::getFormat()
+	{
+		return format;
+	}
+
+	ZSPACE_INLINE zUtilsPlyElement* zUtilsPlyReader::getElement(string name)
+	{
+		for (auto &element : elements)
+		{
+			if (element.name == name) return &element;
+		}
+
+		return nullptr;
+	}
+
+	ZSPACE_INLINE bool zUtilsPlyReader::hasProperty(zUtilsPlyElement &element, string name)
+	{
+		for (auto &prop : element.properties)
+		{
+			if (prop.name == name) return true;
+		}
+
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsPlyReader::readProperty(zUtilsPlyElement &element, string name, float* out, size_t outStride, bool normalize)
+	{
+		int propertyId = -1;
+		for (int k = 0; k < (int)element.properties.size(); k++)
+		{
+			if (element.properties[k].name == name) propertyId = k;
+		}
+
+		if (propertyId == -1 || element.properties[propertyId].countType != -1) return false;
+
+		zUtilsPlyProperty &prop = element.properties[propertyId];
+
+		// integer values are mapped to 0 to 1 by the maximum of their type
+		double scale = 1.0;
+		if (normalize)
+		{
+			if (prop.type == zPlyInt8) scale = 1.0 / 127.0;
+			else if (prop.type == zPlyUInt8) scale = 1.0 / 255.0;
+			else if (prop.type == zPlyInt16) scale = 1.0 / 32767.0;
+			else if (prop.type == zPlyUInt16) scale = 1.0 / 65535.0;
+			else if (prop.type == zPlyInt32) scale = 1.0 / 2147483647.0;
+			else if (prop.type == zPlyUInt32) scale = 1.0 / 4294967295.0;
+		}
+
+		// fixed size binary records are converted in place from the mapping
+		if (format != zPlyASCII && element.stride > 0)
+		{
+			const char* data = file.getData() + element.begin + prop.offset;
+			bool swap = (format == zPlyBinaryBigEndian);
+
+			zUtilsParallel::forEach(0, (int)element.count, [&](int i)
+			{
+				out[i * outStride] = (float)(decodeValue(data + (size_t)i * element.stride, prop.type, swap) * scale);
+			}, 1 << 14);
+
+			return true;
+		}
+
+		size_t i = 0;
+		return walkRecords(element, propertyId, [&](int, const int*, double value)
+		{
+			out[(i++) * outStride] = (float)(value * scale);
+		});
+	}
+
+	ZSPACE_INLINE bool zUtilsPlyReader::readList(zUtilsPlyElement &element, string name, vector<int> &counts, vector<int> &values)
+	{
+		counts.clear();
+		values.clear();
+
+		int propertyId = -1;
+		for (int k = 0; k < (int)element.properties.size(); k++)
+		{
+			if (element.properties[k].name == name) propertyId = k;
+		}
+
+		if (propertyId == -1 || element.properties[propertyId].countType == -1) return false;
+
+		counts.reserve(element.count);
+		values.reserve(element.count * 4);
+
+		return walkRecords(element, propertyId, [&](int n, const int* list, double)
+		{
+			counts.push_back(n);
+			values.insert(values.end(), list, list + n);
+		});
+	}
+
+	//---- TYPE METHODS
+
+	ZSPACE_INLINE size_t zUtilsPlyReader::getTypeSize(int type)
+	{
+		if (type == zPlyInt8 || type == zPlyUInt8) return 1;
+		if (type == zPlyInt16 || type == zPlyUInt16) return 2;
+		if (type == zPlyInt32 || type == zPlyUInt32 || type == zPlyFloat32) return 4;
+		if (type == zPlyFloat64) return 8;
+
+		return 0;
+	}
+
+	ZSPACE_INLINE string zUtilsPlyReader::getTypeName(int type)
+	{
+		if (type == zPlyInt8) return "char";
+		if (type == zPlyUInt8) return "uchar";
+		if (type == zPlyInt16) return "short";
+		if (type == zPlyUInt16) return "ushort";
+		if (type == zPlyInt32) return "int";
+		if (type == zPlyUInt32) return "uint";
+		if (type == zPlyFloat32) return "float";
+		if (type == zPlyFloat64) return "double";
+
+		return "";
+	}
+
+	ZSPACE_INLINE int zUtilsPlyReader::getType(string name)
+	{
+		if (name == "char" || name == "int8") return zPlyInt8;
+		if (name == "uchar" || name == "uint8") return zPlyUInt8;
+		if (name == "short" || name == "int16") return zPlyInt16;
+		if (name == "ushort" || name == "uint16") return zPlyUInt16;
+		if (name == "int" || name == "int32") return zPlyInt32;
+		if (name == "uint" || name == "uint32") return zPlyUInt32;
+		if (name == "float" || name == "float32") return zPlyFloat32;
+		if (name == "double" || name == "float64") return zPlyFloat64;
+
+		return -1;
+	}
+
+	ZSPACE_INLINE double zUtilsPlyReader::decodeValue(const char* ptr, int type, bool swap)
+	{
+		char bytes[8];
+		size_t typeSize = getTypeSize(type);
+
+		if (swap) for (size_t k = 0; k < typeSize; k++) bytes[k] = ptr[typeSize - 1 - k];
+		else memcpy(bytes, ptr, typeSize);
+
+		switch (type)
+		{
+		case zPlyInt8: { int8_t v; memcpy(&v, bytes, 1); return v; }
+		case zPlyUInt8: { uint8_t v; memcpy(&v, bytes, 1); return v; }
+		case zPlyInt16: { int16_t v; memcpy(&v, bytes, 2); return v; }
+		case zPlyUInt16: { uint16_t v; memcpy(&v, bytes, 2); return v; }
+		case zPlyInt32: { int32_t v; memcpy(&v, bytes, 4); return v; }
+		case zPlyUInt32: { uint32_t v; memcpy(&v, bytes, 4); return v; }
+		case zPlyFloat32: { float v; memcpy(&v, bytes, 4); return v; }
+		case zPlyFloat64: { double v; memcpy(&v, bytes, 8); return v; }
+		default: return 0.0;
+		}
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsPlyReader::readHeader(size_t &bodyStart)
+	{
+		const char* data = file.getData();
+		if (data == nullptr) return false;
+
+		zUtilsTextCursor cursor(data, data + file.getSize());
+
+		if (!cursor.matchToken("ply") || !cursor.atLineEnd()) return false;
+		cursor.skipLine();
+
+		bool hasFormat = false;
+
+		while (!cursor.atEnd())
+		{
+			const char* token;
+			size_t length;
+
+			if (cursor.matchToken("end_header"))
+			{
+				cursor.skipLine();
+				bodyStart = cursor.ptr - data;
+
+				return hasFormat;
+			}
+			else if (cursor.matchToken("format"))
+			{
+				if (!cursor.readToken(token, length)) return false;
+				string name(token, length);
+
+				if (name == "ascii") format = zPlyASCII;
+				else if (name == "binary_little_endian") format = zPlyBinaryLittleEndian;
+				else if (name == "binary_big_endian") format = zPlyBinaryBigEndian;
+				else return false;
+
+				hasFormat = true;
+			}
+			else if (cursor.matchToken("element"))
+			{
+				zUtilsPlyElement element;
+				int64_t count;
+
+				if (!cursor.readToken(token, length) || !cursor.readInt64(count) || count < 0) return false;
+
+				element.name = string(token, length);
+				element.count = (size_t)count;
+				element.stride = 0;
+				element.begin = element.end = 0;
+
+				elements.push_back(element);
+			}
+			else if (cursor.matchToken("property"))
+			{
+				if (elements.empty()) return false;
+
+				zUtilsPlyProperty prop;
+				prop.countType = -1;
+				prop.offset = 0;
+				prop.data = nullptr;
+				prop.stride = 0;
+				prop.scale = 1.0f;
+				prop.counts = nullptr;
+				prop.values = nullptr;
+
+				if (cursor.matchToken("list"))
+				{
+					if (!cursor.readToken(token, length)) return false;
+
+					prop.countType = getType(string(token, length));
+					if (prop.countType == -1 || prop.countType == zPlyFloat32 || prop.countType == zPlyFloat64) return false;
+				}
+
+				if (!cursor.readToken(token, length)) return false;
+				prop.type = getType(string(token, length));
+
+				if (!cursor.readToken(token, length) || prop.type == -1) return false;
+				prop.name = string(token, length);
+
+				elements.back().properties.push_back(prop);
+			}
+			else if (!cursor.matchToken("comment") && !cursor.matchToken("obj_info") && !cursor.atLineEnd()) return false;
+
+			cursor.skipLine();
+		}
+
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsPlyReader::locateElements(size_t bodyStart)
+	{
+		const char* data = file.getData();
+		size_t size = file.getSize();
+
+		size_t pos = bodyStart;
+
+		for (auto &element : elements)
+		{
+			element.begin = pos;
+
+			// fixed size records
+			bool fixed = true;
+			size_t stride = 0;
+
+			for (auto &prop : element.properties)
+			{
+				if (prop.countType != -1) fixed = false;
+
+				prop.offset = stride;
+				stride += getTypeSize(prop.type);
+			}
+
+			element.stride = (fixed) ? stride : 0;
+
+			if (format == zPlyASCII)
+			{
+				zUtilsTextCursor cursor(data + pos, data + size);
+
+				for (size_t i = 0; i < element.count; i++)
+				{
+					while (!cursor.atEnd() && cursor.atLineEnd()) cursor.skipLine();
+					if (cursor.atEnd()) return false;
+
+					cursor.skipLine();
+				}
+
+				pos = cursor.ptr - data;
+			}
+			else if (fixed)
+			{
+				if (stride > 0 && element.count > (size - pos) / stride) return false;
+				pos += element.count * stride;
+			}
+			else
+			{
+				// records with lists need to be walked to find the end of the element
+				bool swap = (format == zPlyBinaryBigEndian);
+
+				for (size_t i = 0; i < element.count; i++)
+				{
+					for (auto &prop : element.properties)
+					{
+						size_t typeSize = getTypeSize(prop.type);
+						size_t n = 1;
+
+						if (prop.countType != -1)
+						{
+							size_t countSize = getTypeSize(prop.countType);
+							if (countSize > size - pos) return false;
+
+							double count = decodeValue(data + pos, prop.countType, swap);
+							if (count < 0) return false;
+
+							n = (size_t)count;
+							pos += countSize;
+						}
+
+						if (n * typeSize > size - pos) return false;
+						pos += n * typeSize;
+					}
+				}
+			}
+
+			element.end = pos;
+		}
+
+		return true;
+	}
+
+	//---- zUtilsPlyWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsPlyWriter::zUtilsPlyWriter() {}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsPlyWriter::~zUtilsPlyWriter() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zUtilsPlyWriter::addElement(string name, size_t count)
+	{
+		zUtilsPlyElement element;
+		element.name = name;
+		element.count = count;
+		element.stride = 0;
+		element.begin = element.end = 0;
+
+		elements.push_back(element);
+	}
+
+	ZSPACE_INLINE void zUtilsPlyWriter::addProperty(string name, int type, const float* data, size_t stride, float scale)
+	{
+		if (elements.empty()) throw std::invalid_argument(" error: no element to add the property to.");
+
+		zUtilsPlyProperty prop;
+		prop.name = name;
+		prop.type = type;
+		prop.countType = -1;
+		prop.offset = 0;
+		prop.data = data;
+		prop.stride = stride;
+		prop.scale = scale;
+		prop.counts = nullptr;
+		prop.values = nullptr;
+
+		elements.back().properties.push_back(prop);
+	}
+
+	ZSPACE_INLINE void zUtilsPlyWriter::addListProperty(string name, int countType, int type, const int* counts, const int* values)
+	{
+		if (elements.empty()) throw std::invalid_argument(" error: no element to add the property to.");
+
+		zUtilsPlyProperty prop;
+		prop.name = name;
+		prop.type = type;
+		prop.countType = countType;
+		prop.offset = 0;
+		prop.data = nullptr;
+		prop.stride = 0;
+		prop.scale = 1.0f;
+		prop.counts = counts;
+		prop.values = values;
+
+		elements.back().properties.push_back(prop);
+	}
+
+	ZSPACE_INLINE bool zUtilsPlyWriter::write(string path, int format, int precision)
+	{
+		ofstream myfile;
+		myfile.open(path.c_str(), ios::binary);
+
+		if (myfile.fail()) return false;
+
+		// header
+		zUtilsTextWriter header;
+		header.write("ply\nformat ");
+		header.write((format == zPlyASCII) ? "ascii" : ((format == zPlyBinaryBigEndian) ? "binary_big_endian" : "binary_little_endian"));
+		header.write(" 1.0\ncomment zspace\n");
+
+		for (auto &element : elements)
+		{
+			header.write("element ");
+			header.write(element.name.c_str());
+			header.write(' ');
+			header.write(to_string(element.count).c_str());
+			header.write('\n');
+
+			for (auto &prop : element.properties)
+			{
+				header.write("property ");
+
+				if (prop.countType != -1)
+				{
+					header.write("list ");
+					header.write(zUtilsPlyReader::getTypeName(prop.countType).c_str());
+					header.write(' ');
+				}
+
+				header.write(zUtilsPlyReader::getTypeName(prop.type).c_str());
+				header.write(' ');
+				header.write(prop.name.c_str());
+				header.write('\n');
+			}
+		}
+
+		header.write("end_header\n");
+		header.flush(myfile);
+
+		// body, formatted in parallel blocks of records
+		const int blockSize = 1 << 16;
+		const int grain = 1 << 12;
+		bool swap = (format == zPlyBinaryBigEndian);
+
+		vector<char> buffer;
+		vector<size_t> recordOffsets;
+		vector<size_t> listOffsets;
+
+		for (auto &element : elements)
+		{
+			int numProps = (int)element.properties.size();
+
+			// running start of the list values of every list property
+			vector<size_t> listStart(numProps, 0);
+
+			for (size_t blockStart = 0; blockStart < element.count; blockStart += blockSize)
+			{
+				int n = (int)(std::min)((size_t)blockSize, element.count - blockStart);
+
+				// list value offsets of the records in the block, per list property
+				listOffsets.assign((size_t)n * numProps, 0);
+
+				for (int k = 0; k < numProps; k++)
+				{
+					zUtilsPlyProperty &prop = element.properties[k];
+					if (prop.countType == -1) continue;
+
+					size_t offset = listStart[k];
+					for (int i = 0; i < n; i++)
+					{
+						listOffsets[(size_t)i * numProps + k] = offset;
+						offset += prop.counts[blockStart + i];
+					}
+
+					listStart[k] = offset;
+				}
+
+				if (format == zPlyASCII)
+				{
+					vector<zUtilsTextWriter> writers(zUtilsParallel::getNumRanges(n, grain), zUtilsTextWriter(precision));
+
+					zUtilsParallel::forRange(0, n, [&](int start, int end, int threadId)
+					{
+						zUtilsTextWriter &writer = writers[threadId];
+
+						for (int i = start; i < end; i++)
+						{
+							size_t r = blockStart + i;
+
+							for (int k = 0; k < numProps; k++)
+							{
+								zUtilsPlyProperty &prop = element.properties[k];
+
+								if (k > 0) writer.write(' ');
+
+								if (prop.countType == -1)
+								{
+									double value = prop.data[r * prop.stride] * prop.scale;
+
+									if (prop.type == zPlyFloat32 || prop.type == zPlyFloat64) writer.write(value);
+									else
+									{
+										char bytes[8];
+										encodeValue(bytes, prop.type, value, false);
+										writer.write((int)zUtilsPlyReader::decodeValue(bytes, prop.type, false));
+									}
+								}
+								else
+								{
+									int count = prop.counts[r];
+									const int* values = prop.values + listOffsets[(size_t)i * numProps + k];
+
+									writer.write(count);
+									for (int j = 0; j < count; j++)
+									{
+										writer.write(' ');
+										writer.write(values[j]);
+									}
+								}
+							}
+
+							writer.write('\n');
+						}
+					}, grain);
+
+					for (auto &writer : writers) writer.flush(myfile);
+				}
+				else
+				{
+					// byte offset of every record in the block
+					recordOffsets.assign(n + 1, 0);
+
+					for (int i = 0; i < n; i++)
+					{
+						size_t recordSize = 0;
+
+						for (auto &prop : element.properties)
+						{
+							if (prop.countType == -1) recordSize += zUtilsPlyReader::getTypeSize(prop.type);
+							else recordSize += zUtilsPlyReader::getTypeSize(prop.countType) + prop.counts[blockStart + i] * zUtilsPlyReader::getTypeSize(prop.type);
+						}
+
+						recordOffsets[i + 1] = recordOffsets[i] + recordSize;
+					}
+
+					buffer.resize(recordOffsets[n]);
+
+					zUtilsParallel::forEach(0, n, [&](int i)
+					{
+						size_t r = blockStart + i;
+						char* ptr = buffer.data() + recordOffsets[i];
+
+						for (int k = 0; k < numProps; k++)
+						{
+							zUtilsPlyProperty &prop = element.properties[k];
+							size_t typeSize = zUtilsPlyReader::getTypeSize(prop.type);
+
+							if (prop.countType == -1)
+							{
+								encodeValue(ptr, prop.type, prop.data[r * prop.stride] * prop.scale, swap);
+								ptr += typeSize;
+							}
+							else
+							{
+								int count = prop.counts[r];
+								const int* values = prop.values + listOffsets[(size_t)i * numProps + k];
+
+								encodeValue(ptr, prop.countType, count, swap);
+								ptr += zUtilsPlyReader::getTypeSize(prop.countType);
+
+								for (int j = 0; j < count; j++)
+								{
+									encodeValue(ptr, prop.type, values[j], swap);
+									ptr += typeSize;
+								}
+							}
+						}
+					}, grain);
+
+					myfile.write(buffer.data(), buffer.size());
+				}
+			}
+		}
+
+		bool out = myfile.good();
+		myfile.close();
+
+		return out;
+	}
+
+	ZSPACE_INLINE void zUtilsPlyWriter::clear()
+	{
+		elements.clear();
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zUtilsPlyWriter::encodeValue(char* ptr, int type, double value, bool swap)
+	{
+		char bytes[8];
+
+		// integer types are rounded and clamped to their range
+		auto toInt = [&](double minValue, double maxValue)
+		{
+			if (!(value >= minValue)) return minValue;
+			if (value > maxValue) return maxValue;
+			return std::round(value);
+		};
+
+		switch (type)
+		{
+		case zPlyInt8: { int8_t v = (int8_t)toInt(-128.0, 127.0); memcpy(bytes, &v, 1); break; }
+		case zPlyUInt8: { uint8_t v = (uint8_t)toInt(0.0, 255.0); memcpy(bytes, &v, 1); break; }
+		case zPlyInt16: { int16_t v = (int16_t)toInt(-32768.0, 32767.0); memcpy(bytes, &v, 2); break; }
+		case zPlyUInt16: { uint16_t v = (uint16_t)toInt(0.0, 65535.0); memcpy(bytes, &v, 2); break; }
+		case zPlyInt32: { int32_t v = (int32_t)toInt(-2147483648.0, 2147483647.0); memcpy(bytes, &v, 4); break; }
+		case zPlyUInt32: { uint32_t v = (uint32_t)toInt(0.0, 4294967295.0); memcpy(bytes, &v, 4); break; }
+		case zPlyFloat32: { float v = (float)value; memcpy(bytes, &v, 4); break; }
+		case zPlyFloat64: { memcpy(bytes, &value, 8); break; }
+		default: return;
+		}
+
+		size_t typeSize = zUtilsPlyReader::getTypeSize(type);
+
+		if (swap) for (size_t k = 0; k < typeSize; k++) ptr[k] = bytes[typeSize - 1 - k];
+		else memcpy(ptr, bytes, typeSize);
+	}
+
+	//---- zUtilsCompression
+
+	//---- LZ METHODS
+
+	ZSPACE_INLINE void zUtilsCompression::compressLZ(const unsigned char* src, size_t size, vector<unsigned char> &dst)
+	{
+		const int hashBits = 14;
+		const size_t minMatch = 4;
+		const size_t maxOffset = 65535;
+
+		vector<int64_t> table(1 << hashBits, -1);
+
+		auto read32 = [&](size_t i)
+		{
+			uint32_t v;
+			memcpy(&v, src + i, 4);
+			return v;
+		};
+
+		auto writeLength = [&](size_t length)
+		{
+			while (length >= 255)
+			{
+				dst.push_back(255);
+				length -= 255;
+			}
+			dst.push_back((unsigned char)length);
+		};
+
+		// a sequence is a token, the literals and an optional match of offset and length
+		auto writeSequence = [&](size_t anchor, size_t numLiterals, size_t offset, size_t matchLength)
+		{
+			size_t matchCode = (matchLength > 0) ? matchLength - minMatch : 0;
+
+			unsigned char token = (unsigned char)(((std::min)(numLiterals, (size_t)15) << 4) | (std::min)(matchCode, (size_t)15));
+			dst.push_back(token);
+
+			if (numLiterals >= 15) writeLength(numLiterals - 15);
+			dst.insert(dst.end(), src + anchor, src + anchor + numLiterals);
+
+			if (matchLength == 0) return;
+
+			dst.push_back((unsigned char)(offset & 0xff));
+			dst.push_back((unsigned char)(offset >> 8));
+
+			if (matchCode >= 15) writeLength(matchCode - 15);
+		};
+
+		size_t anchor = 0;
+		size_t i = 0;
+
+		while (i + minMatch <= size)
+		{
+			uint32_t sequence = read32(i);
+			uint32_t hash = (sequence * 2654435761u) >> (32 - hashBits);
+
+			int64_t ref = table[hash];
+			table[hash] = (int64_t)i;
+
+			if (ref < 0 || i - ref > maxOffset || read32(ref) != sequence)
+			{
+				// skip faster through data which does not compress
+				i += 1 + ((i - anchor) >> 6);
+				continue;
+			}
+
+			size_t length = minMatch;
+			while (i + length < size && src[ref + length] == src[i + length]) length++;
+
+			writeSequence(anchor, i - anchor, i - ref, length);
+
+			i += length;
+			anchor = i;
+		}
+
+		// the last sequence holds only literals
+		writeSequence(anchor, size - anchor, 0, 0);
+	}
+
+	ZSPACE_INLINE bool zUtilsCompression::decompressLZ(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize)
+	{
+		const unsigned char* ip = src;
+		const unsigned char* iEnd = src + srcSize;
+
+		size_t op = 0;
+
+		auto readLength = [&](size_t &length)
+		{
+			while (true)
+			{
+				if (ip >= iEnd) return false;
+
+				unsigned char b = *ip++;
+				length += b;
+
+				if (b != 255) return true;
+			}
+		};
+
+		while (ip < iEnd)
+		{
+			unsigned char token = *ip++;
+
+			size_t numLiterals = token >> 4;
+			if (numLiterals == 15 && !readLength(numLiterals)) return false;
+
+			if (numLiterals > (size_t)(iEnd - ip) || numLiterals > dstSize - op) return false;
+
+			memcpy(dst + op, ip, numLiterals);
+			ip += numLiterals;
+			op += numLiterals;
+
+			// the last sequence holds only literals
+			if (ip == iEnd) break;
+
+			if (iEnd - ip < 2) return false;
+
+			size_t offset = ip[0] | ((size_t)ip[1] << 8);
+			ip += 2;
+
+			size_t length = token & 15;
+			if (length == 15 && !readLength(length)) return false;
+			length += 4;
+
+			if (offset == 0 || offset > op || length > dstSize - op) return false;
+
+			// matches may overlap their own output, so bytes are copied in order
+			unsigned char* out = dst + op;
+			const unsigned char* ref = out - offset;
+
+			if (offset >= length) memcpy(out, ref, length);
+			else for (size_t k = 0; k < length; k++) out[k] = ref[k];
+
+			op += length;
+		}
+
+		return op == dstSize;
+	}
+
+	ZSPACE_INLINE void zUtilsCompression::compressChunks(const unsigned char* src, size_t size, vector<unsigned char> &dst, size_t chunkSize)
+	{
+		const uint32_t storedFlag = 0x80000000u;
+
+		if (chunkSize == 0 || chunkSize >= storedFlag) chunkSize = 1 << 20;
+
+		uint32_t numChunks = (uint32_t)((size + chunkSize - 1) / chunkSize);
+
+		vector<vector<unsigned char>> chunks(numChunks);
+
+		zUtilsParallel::forEach(0, (int)numChunks, [&](int i)
+		{
+			size_t begin = (size_t)i * chunkSize;
+			size_t n = (std::min)(chunkSize, size - begin);
+
+			compressLZ(src + begin, n, chunks[i]);
+
+			if (chunks[i].size() >= n) chunks[i].assign(src + begin, src + begin + n);
+		});
+
+		// chunk table : number of chunks, chunk size and the stored size of each chunk, with the high bit set for uncompressed chunks
+		uint32_t table[2] = { numChunks, (uint32_t)chunkSize };
+
+		size_t start = dst.size();
+		dst.resize(start + sizeof(table) + numChunks * sizeof(uint32_t));
+
+		memcpy(&dst[start], table, sizeof(table));
+
+		for (uint32_t i = 0; i < numChunks; i++)
+		{
+			size_t n = (std::min)(chunkSize, size - (size_t)i * chunkSize);
+
+			uint32_t storedSize = (uint32_t)chunks[i].size();
+			if (chunks[i].size() == n) storedSize |= storedFlag;
+
+			memcpy(&dst[start + sizeof(table) + i * sizeof(uint32_t)], &storedSize, sizeof(uint32_t));
+		}
+
+		for (auto &chunk : chunks) dst.insert(dst.end(), chunk.begin(), chunk.end());
+	}
+
+	ZSPACE_INLINE bool zUtilsCompression::decompressChunks(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize)
+	{
+		const uint32_t storedFlag = 0x80000000u;
+
+		uint32_t table[2];
+		if (srcSize < sizeof(table)) return false;
+
+		memcpy(table, src, sizeof(table));
+
+		uint32_t numChunks = table[0];
+		size_t chunkSize = table[1];
+
+		if (chunkSize == 0 || numChunks != (dstSize + chunkSize - 1) / chunkSize) return false;
+		if ((srcSize - sizeof(table)) / sizeof(uint32_t) < numChunks) return false;
+
+		// chunk offsets
+		vector<size_t> offsets(numChunks + 1);
+		offsets[0] = sizeof(table) + numChunks * sizeof(uint32_t);
+
+		for (uint32_t i = 0; i < numChunks; i++)
+		{
+			uint32_t storedSize;
+			memcpy(&storedSize, src + sizeof(table) + i * sizeof(uint32_t), sizeof(uint32_t));
+
+			offsets[i + 1] = offsets[i] + (storedSize & ~storedFlag);
+		}
+
+		if (offsets[numChunks] > srcSize) return false;
+
+		vector<char> valid(numChunks, 0);
+
+		zUtilsParallel::forEach(0, (int)numChunks, [&](int i)
+		{
+			size_t begin = (size_t)i * chunkSize;
+			size_t n = (std::min)(chunkSize, dstSize - begin);
+
+			uint32_t storedSize;
+			memcpy(&storedSize, src + sizeof(table) + i * sizeof(uint32_t), sizeof(uint32_t));
+
+			if (storedSize & storedFlag)
+			{
+				if (offsets[i + 1] - offsets[i] != n) return;
+
+				memcpy(dst + begin, src + offsets[i], n);
+				valid[i] = 1;
+			}
+			else valid[i] = decompressLZ(src + offsets[i], offsets[i + 1] - offsets[i], dst + begin, n) ? 1 : 0;
+		});
+
+		for (char v : valid)
+		{
+			if (!v) return false;
+		}
+
+		return true;
+	}
+
+	//---- PACKING METHODS
+
+	ZSPACE_INLINE void zUtilsCompression::shuffleBytes(const unsigned char* src, size_t numElements, size_t elementSize, unsigned char* dst)
+	{
+		for (size_t k = 0; k < elementSize; k++)
+		{
+			unsigned char* plane = dst + k * numElements;
+			for (size_t i = 0; i < numElements; i++) plane[i] = src[i * elementSize + k];
+		}
+	}
+
+	ZSPACE_INLINE void zUtilsCompression::unshuffleBytes(const unsigned char* src, size_t numElements, size_t elementSize, unsigned char* dst)
+	{
+		for (size_t k = 0; k < elementSize; k++)
+		{
+			const unsigned char* plane = src + k * numElements;
+			for (size_t i = 0; i < numElements; i++) dst[i * elementSize + k] = plane[i];
+		}
+	}
+
+	ZSPACE_INLINE uint16_t zUtilsCompression::floatToHalf(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, 4);
+
+		uint32_t sign = (bits >> 16) & 0x8000;
+		int32_t exponent = (int32_t)((bits >> 23) & 0xff);
+		uint32_t mantissa = bits & 0x7fffff;
+
+		// infinity and nan
+		if (exponent == 255) return (uint16_t)(sign | 0x7c00 | ((mantissa != 0) ? (0x200 | (mantissa >> 13)) : 0));
+
+		exponent = exponent - 127 + 15;
+
+		// overflow to infinity
+		if (exponent >= 31) return (uint16_t)(sign | 0x7c00);
+
+		// subnormal half values
+		if (exponent <= 0)
+		{
+			if (exponent < -10) return (uint16_t)sign;
+
+			mantissa |= 0x800000;
+
+			uint32_t shift = (uint32_t)(14 - exponent);
+			uint32_t half = mantissa >> shift;
+			uint32_t remainder = mantissa & ((1u << shift) - 1);
+			uint32_t halfway = 1u << (shift - 1);
+
+			if (remainder > halfway || (remainder == halfway && (half & 1))) half++;
+
+			return (uint16_t)(sign | half);
+		}
+
+		uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+		uint32_t remainder = mantissa & 0x1fff;
+
+		// a carry in to the exponent rounds up correctly, including to infinity
+		if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) half++;
+
+		return (uint16_t)(sign | half);
+	}
+
+	ZSPACE_INLINE float zUtilsCompression::halfToFloat(uint16_t half)
+	{
+		uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+		uint32_t exponent = (half >> 10) & 0x1f;
+		uint32_t mantissa = half & 0x3ff;
+
+		uint32_t bits;
+
+		if (exponent == 0)
+		{
+			if (mantissa == 0) bits = sign;
+			else
+			{
+				// normalise the subnormal value
+				int32_t e = -1;
+				do
+				{
+					e++;
+					mantissa <<= 1;
+				} while ((mantissa & 0x400) == 0);
+
+				bits = sign | ((uint32_t)(127 - 15 - e) << 23) | ((mantissa & 0x3ff) << 13);
+			}
+		}
+		else if (exponent == 31) bits = sign | 0x7f800000 | (mantissa << 13);
+		else bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+
+		float value;
+		memcpy(&value, &bits, 4);
+		return value;
+	}
+
+	//---- zUtilsFieldWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsFieldWriter::zUtilsFieldWriter()
+	{
+		memset(&header, 0, sizeof(header));
+		position = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsFieldWriter::~zUtilsFieldWriter()
+	{
+		if (isOpen()) close();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsFieldWriter::open(string path, zUtilsFieldHeader &_header)
+	{
+		if (isOpen()) close();
+
+		const uint32_t byteOrder = 0x01020304;
+
+		// the format is little endian, the values are written from memory as is
+		if (*(const char*)&byteOrder != 0x04)
+		{
+			cout << " error: binary files can only be written on little endian platforms." << endl;
+			return false;
+		}
+
+		if (_header.numValues == 0 || (_header.numComponents != 1 && _header.numComponents != 3) || (_header.precision != zFieldFloat32 && _header.precision != zFieldFloat16))
+		{
+			cout << " error: invalid field header for  " << path.c_str() << endl;
+			return false;
+		}
+
+		header = _header;
+		memcpy(header.magic, "ZFLD", 4);
+		header.version = 1;
+		header.byteOrder = byteOrder;
+		header.compression = (header.compression != 0) ? 1 : 0;
+		if (header.keyFrameInterval < 1) header.keyFrameInterval = 1;
+		header.numFrames = 0;
+		header.indexOffset = 0;
+
+		file.open(path.c_str(), ios::out | ios::binary | ios::trunc);
+
+		if (file.fail())
+		{
+			cout << " error in opening file  " << path.c_str() << endl;
+			return false;
+		}
+
+		// the header is rewritten with the frame index on close
+		file.write((const char*)&header, sizeof(header));
+		position = sizeof(header);
+
+		frames.clear();
+		previous.clear();
+
+		return file.good();
+	}
+
+	ZSPACE_INLINE bool zUtilsFieldWriter::addFrame(const float* values, double time)
+	{
+		if (!isOpen()) return false;
+
+		const uint64_t alignment = 64;
+
+		size_t numFloats = (size_t)(header.numValues * header.numComponents);
+		size_t wordSize = (header.precision == zFieldFloat16) ? 2 : 4;
+		size_t numBytes = numFloats * wordSize;
+
+		current.resize(numBytes);
+
+		if (wordSize == 4) memcpy(current.data(), values, numBytes);
+		else
+		{
+			uint16_t* words = (uint16_t*)current.data();
+			zUtilsParallel::forRange(0, (int)numFloats, [&](int start, int end, int)
+			{
+				for (int i = start; i < end; i++) words[i] = zUtilsCompression::floatToHalf(values[i]);
+			}, 4096);
+		}
+
+		zUtilsFieldFrame frame;
+		frame.time = time;
+		frame.flags = 0;
+		frame.reserved = 0;
+
+		const unsigned char* payload = current.data();
+		size_t payloadSize = numBytes;
+
+		if (header.compression)
+		{
+			bool keyFrame = (frames.size() % header.keyFrameInterval) == 0;
+
+			// XOR against the previous frame, the unchanged high bits become zeros
+			if (!keyFrame)
+			{
+				zUtilsParallel::forRange(0, (int)numBytes, [&](int start, int end, int)
+				{
+					for (int i = start; i < end; i++)
+					{
+						unsigned char c = current[i];
+						current[i] ^= previous[i];
+						previous[i] = c;
+					}
+				}, 65536);
+
+				frame.flags |= zUtilsFieldFrame::deltaFlag;
+			}
+			else previous = current;
+
+			shuffled.resize(numBytes);
+			zUtilsCompression::shuffleBytes(current.data(), numFloats, wordSize, shuffled.data());
+
+			compressed.clear();
+			zUtilsCompression::compressChunks(shuffled.data(), numBytes, compressed);
+
+			if (compressed.size() < numBytes)
+			{
+				payload = compressed.data();
+				payloadSize = compressed.size();
+				frame.flags |= zUtilsFieldFrame::compressedFlag;
+			}
+		}
+
+		// frames start on 64 byte boundaries, so uncompressed values can be used from the mapped file directly
+		char padding[64] = { 0 };
+		uint64_t offset = (position + alignment - 1) & ~(alignment - 1);
+
+		file.write(padding, offset - position);
+		file.write((const char*)payload, payloadSize);
+
+		frame.offset = offset;
+		frame.size = payloadSize;
+		frames.push_back(frame);
+
+		position = offset + payloadSize;
+
+		return file.good();
+	}
+
+	ZSPACE_INLINE bool zUtilsFieldWriter::close()
+	{
+		if (!isOpen()) return false;
+
+		header.numFrames = frames.size();
+		header.indexOffset = position;
+
+		if (frames.size() > 0) file.write((const char*)frames.data(), frames.size() * sizeof(zUtilsFieldFrame));
+
+		file.seekp(0);
+		file.write((const char*)&header, sizeof(header));
+
+		bool out = file.good();
+		file.close();
+
+		frames.clear();
+		previous.clear();
+		current.clear();
+		shuffled.clear();
+		compressed.clear();
+
+		return out;
+	}
+
+	ZSPACE_INLINE bool zUtilsFieldWriter::isOpen()
+	{
+		return file.is_open();
+	}
+
+	ZSPACE_INLINE const zUtilsFieldHeader& zUtilsFieldWriter::getHeader()
+	{
+		return header;
+	}
+
+	ZSPACE_INLINE int zUtilsFieldWriter::numFrames()
+	{
+		return (int)frames.size();
+	}
+
+	//---- zUtilsFieldReader
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsFieldReader::zUtilsFieldReader()
+	{
+		memset(&header, 0, sizeof(header));
+		currentFrame = -1;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsFieldReader::~zUtilsFieldReader() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsFieldReader::open(string path)
+	{
+		close();
+
+		if (!file.open(path)) return false;
+
+		bool valid = file.getSize() >= sizeof(zUtilsFieldHeader);
+
+		if (valid)
+		{
+			memcpy(&header, file.getData(), sizeof(header));
+
+			valid = memcmp(header.magic, "ZFLD", 4) == 0;
+			valid = valid && header.byteOrder == 0x01020304;
+			valid = valid && header.version == 1;
+			valid = valid && (header.numComponents == 1 || header.numComponents == 3);
+			valid = valid && (header.precision == zFieldFloat32 || header.precision == zFieldFloat16);
+			valid = valid && header.numValues > 0 && header.keyFrameInterval > 0;
+			valid = valid && header.indexOffset <= file.getSize() && header.numFrames <= (file.getSize() - header.indexOffset) / sizeof(zUtilsFieldFrame);
+		}
+
+		if (valid)
+		{
+			frames.resize((size_t)header.numFrames);
+			if (frames.size() > 0) memcpy(frames.data(), file.getData() + header.indexOffset, frames.size() * sizeof(zUtilsFieldFrame));
+
+			// frames must lie within the file, uncompressed frames hold all values
+			for (auto &frame : frames)
+			{
+				if (frame.offset > file.getSize() || frame.size > file.getSize() - frame.offset) valid = false;
+				else if (!(frame.flags & zUtilsFieldFrame::compressedFlag) && frame.size != getFrameBytes()) valid = false;
+			}
+
+			if (frames.size() > 0 && (frames[0].flags & zUtilsFieldFrame::deltaFlag)) valid = false;
+		}
+
+		if (!valid)
+		{
+			cout << " error in reading file  " << path.c_str() << " : invalid zFIELD file." << endl;
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsFieldReader::close()
+	{
+		file.close();
+		frames.clear();
+		current.clear();
+		packed.clear();
+		shuffled.clear();
+
+		memset(&header, 0, sizeof(header));
+		currentFrame = -1;
+	}
+
+	ZSPACE_INLINE bool zUtilsFieldReader::isOpen()
+	{
+		return file.isOpen();
+	}
+
+	ZSPACE_INLINE const zUtilsFieldHeader& zUtilsFieldReader::getHeader()
+	{
+		return header;
+	}
+
+	ZSPACE_INLINE int zUtilsFieldReader::numFrames()
+	{
+		return (int)frames.size();
+	}
+
+	ZSPACE_INLINE double zUtilsFieldReader::getFrameTime(int frame)
+	{
+		if (frame < 0 || frame >= (int)frames.size()) throw std::invalid_argument(" error: frame index out of bounds.");
+
+		return frames[frame].time;
+	}
+
+	ZSPACE_INLINE const float* zUtilsFieldReader::getFrameData(int frame)
+	{
+		if (frame < 0 || frame >= (int)frames.size()) return nullptr;
+		if (header.precision != zFieldFloat32 || frames[frame].flags != 0) return nullptr;
+
+		return (const float*)(file.getData() + frames[frame].offset);
+	}
+
+	ZSPACE_INLINE bool zUtilsFieldReader::getFrame(int frame, float* values)
+	{
+		if (frame < 0 || frame >= (int)frames.size()) return false;
+
+		size_t numFloats = (size_t)(header.numValues * header.numComponents);
+
+		const float* data = getFrameData(frame);
+		if (data != nullptr)
+		{
+			memcpy(values, data, numFloats * sizeof(float));
+			return true;
+		}
+
+		// decode from the closest key frame, or continue from the last decoded frame
+		int start = frame;
+		while (start > 0 && (frames[start].flags & zUtilsFieldFrame::deltaFlag)) start--;
+
+		if (currentFrame >= start && currentFrame <= frame) start = currentFrame + 1;
+		if (start > frame) start = frame;
+
+		for (int i = start; i <= frame; i++)
+		{
+			if (!decodeFrame(i))
+			{
+				currentFrame = -1;
+				return false;
+			}
+		}
+
+		if (header.precision == zFieldFloat32) memcpy(values, current.data(), numFloats * sizeof(float));
+		else
+		{
+			const uint16_t* words = (const uint16_t*)current.data();
+			zUtilsParallel::forRange(0, (int)numFloats, [&](int begin, int end, int)
+			{
+				for (int i = begin; i < end; i++) values[i] = zUtilsCompression::halfToFloat(words[i]);
+			}, 4096);
+		}
+
+		return true;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsFieldReader::decodeFrame(int frame)
+	{
+		if (frame == currentFrame) return true;
+
+		zUtilsFieldFrame &f = frames[frame];
+		const unsigned char* data = (const unsigned char*)file.getData() + f.offset;
+
+		size_t numBytes = getFrameBytes();
+		size_t wordSize = (header.precision == zFieldFloat16) ? 2 : 4;
+
+		bool delta = (f.flags & zUtilsFieldFrame::deltaFlag) != 0;
+		if (delta && currentFrame != frame - 1) return false;
+
+		// packed values of the frame
+		const unsigned char* values = data;
+
+		if (f.flags & zUtilsFieldFrame::compressedFlag)
+		{
+			shuffled.resize(numBytes);
+			if (!zUtilsCompression::decompressChunks(data, (size_t)f.size, shuffled.data(), numBytes)) return false;
+
+			packed.resize(numBytes);
+			zUtilsCompression::unshuffleBytes(shuffled.data(), numBytes / wordSize, wordSize, packed.data());
+
+			values = packed.data();
+		}
+
+		if (delta)
+		{
+			zUtilsParallel::forRange(0, (int)numBytes, [&](int start, int end, int)
+			{
+				for (int i = start; i < end; i++) current[i] ^= values[i];
+			}, 65536);
+		}
+		else current.assign(values, values + numBytes);
+
+		currentFrame = frame;
+		return true;
+	}
+
+	ZSPACE_INLINE size_t zUtilsFieldReader::getFrameBytes()
+	{
+		size_t wordSize = (header.precision == zFieldFloat16) ? 2 : 4;
+		return (size_t)(header.numValues * header.numComponents) * wordSize;
+	}
+
+	//---- zUtilsVertexCacheWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsVertexCacheWriter::zUtilsVertexCacheWriter()
+	{
+		memset(&header, 0, sizeof(header));
+		position = 0;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsVertexCacheWriter::~zUtilsVertexCacheWriter()
+	{
+		if (isOpen()) close();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsVertexCacheWriter::open(string path, zUtilsVertexCacheHeader &_header, vector<int> &counts, vector<int> &connects)
+	{
+		if (isOpen()) close();
+
+		const uint32_t byteOrder = 0x01020304;
+
+		// the format is little endian, the topology is written from memory as is
+		if (*(const char*)&byteOrder != 0x04)
+		{
+			cout << " error: binary files can only be written on little endian platforms." << endl;
+			return false;
+		}
+
+		if (!(_header.quantization > 0) || _header.topology > zUtilsVertexCacheHeader::graphTopology)
+		{
+			cout << " error: invalid vertex cache header for  " << path.c_str() << endl;
+			return false;
+		}
+
+		header = _header;
+		memcpy(header.magic, "ZVTX", 4);
+		header.version = 1;
+		header.byteOrder = byteOrder;
+		header.numCounts = (uint32_t)counts.size();
+		header.numConnects = (uint32_t)connects.size();
+		if (header.keyFrameInterval < 1) header.keyFrameInterval = 1;
+		header.numFrames = 0;
+		header.topologyOffset = sizeof(header);
+		header.indexOffset = 0;
+
+		file.open(path.c_str(), ios::out | ios::binary | ios::trunc);
+
+		if (file.fail())
+		{
+			cout << " error in opening file  " << path.c_str() << endl;
+			return false;
+		}
+
+		// the header is rewritten with the frame index on close
+		file.write((const char*)&header, sizeof(header));
+
+		if (counts.size() > 0) file.write((const char*)counts.data(), counts.size() * sizeof(int));
+		if (connects.size() > 0) file.write((const char*)connects.data(), connects.size() * sizeof(int));
+
+		position = header.topologyOffset + (counts.size() + connects.size()) * sizeof(int);
+
+		frames.clear();
+		previous.assign((size_t)header.numVertices * 3, 0);
+
+		return file.good();
+	}
+
+	ZSPACE_INLINE bool zUtilsVertexCacheWriter::addFrame(const float* positions, double time)
+	{
+		if (!isOpen()) return false;
+
+		const uint64_t alignment = 64;
+
+		int numCoords = (int)header.numVertices * 3;
+		bool keyFrame = (frames.size() % header.keyFrameInterval) == 0;
+
+		double invStep = 1.0 / header.quantization;
+
+		current.resize(numCoords);
+
+		zUtilsParallel::forRange(0, numCoords, [&](int start, int end, int)
+		{
+			for (int i = start; i < end; i++)
+			{
+				double q = std::round(positions[i] * invStep);
+				q = (std::max)((std::min)(q, 2147483647.0), -2147483647.0);
+
+				int32_t value = (int32_t)q;
+
+				// key frames store the coordinates, the other frames the difference to the previous frame, wrapping on overflow
+				int32_t delta = (keyFrame) ? value : (int32_t)((uint32_t)value - (uint32_t)previous[i]);
+				previous[i] = value;
+
+				// zig zag encoding keeps small negative values small
+				current[i] = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+			}
+		}, 4096);
+
+		zUtilsFieldFrame frame;
+		frame.time = time;
+		frame.flags = (keyFrame) ? 0 : zUtilsFieldFrame::deltaFlag;
+		frame.reserved = 0;
+
+		size_t numBytes = (size_t)numCoords * sizeof(uint32_t);
+
+		shuffled.resize(numBytes);
+		zUtilsCompression::shuffleBytes((const unsigned char*)current.data(), numCoords, sizeof(uint32_t), shuffled.data());
+
+		compressed.clear();
+		zUtilsCompression::compressChunks(shuffled.data(), numBytes, compressed);
+
+		const unsigned char* payload = (const unsigned char*)current.data();
+		size_t payloadSize = numBytes;
+
+		if (compressed.size() < numBytes)
+		{
+			payload = compressed.data();
+			payloadSize = compressed.size();
+			frame.flags |= zUtilsFieldFrame::compressedFlag;
+		}
+
+		char padding[64] = { 0 };
+		uint64_t offset = (position + alignment - 1) & ~(alignment - 1);
+
+		file.write(padding, offset - position);
+		file.write((const char*)payload, payloadSize);
+
+		frame.offset = offset;
+		frame.size = payloadSize;
+		frames.push_back(frame);
+
+		position = offset + payloadSize;
+
+		return file.good();
+	}
+
+	ZSPACE_INLINE bool zUtilsVertexCacheWriter::close()
+	{
+		if (!isOpen()) return false;
+
+		header.numFrames = frames.size();
+		header.indexOffset = position;
+
+		if (frames.size() > 0) file.write((const char*)frames.data(), frames.size() * sizeof(zUtilsFieldFrame));
+
+		file.seekp(0);
+		file.write((const char*)&header, sizeof(header));
+
+		bool out = file.good();
+		file.close();
+
+		frames.clear();
+		previous.clear();
+		current.clear();
+		shuffled.clear();
+		compressed.clear();
+
+		return out;
+	}
+
+	ZSPACE_INLINE bool zUtilsVertexCacheWriter::isOpen()
+	{
+		return file.is_open();
+	}
+
+	ZSPACE_INLINE const zUtilsVertexCacheHeader& zUtilsVertexCacheWriter::getHeader()
+	{
+		return header;
+	}
+
+	ZSPACE_INLINE int zUtilsVertexCacheWriter::numFrames()
+	{
+		return (int)frames.size();
+	}
+
+	//---- zUtilsVertexCacheReader
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsVertexCacheReader::zUtilsVertexCacheReader()
+	{
+		memset(&header, 0, sizeof(header));
+		currentFrame = -1;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsVertexCacheReader::~zUtilsVertexCacheReader() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsVertexCacheReader::open(string path)
+	{
+		close();
+
+		if (!file.open(path)) return false;
+
+		bool valid = file.getSize() >= sizeof(zUtilsVertexCacheHeader);
+
+		if (valid)
+		{
+			memcpy(&header, file.getData(), sizeof(header));
+
+			valid = memcmp(header.magic, "ZVTX", 4) == 0;
+			valid = valid && header.byteOrder == 0x01020304;
+			valid = valid && header.version == 1;
+			valid = valid && header.topology <= zUtilsVertexCacheHeader::graphTopology;
+			valid = valid && header.quantization > 0 && header.keyFrameInterval > 0;
+			valid = valid && header.topologyOffset <= file.getSize() && (uint64_t)header.numCounts + header.numConnects <= (file.getSize() - header.topologyOffset) / sizeof(int);
+			valid = valid && header.indexOffset <= file.getSize() && header.numFrames <= (file.getSize() - header.indexOffset) / sizeof(zUtilsFieldFrame);
+		}
+
+		// topology must reference valid vertices
+		if (valid)
+		{
+			const int* counts = (const int*)(file.getData() + header.topologyOffset);
+			const int* connects = counts + header.numCounts;
+
+			uint64_t sum = 0;
+			for (uint32_t i = 0; i < header.numCounts; i++)
+			{
+				if (counts[i] < 0) valid = false;
+				else sum += counts[i];
+			}
+
+			for (uint32_t i = 0; i < header.numConnects; i++)
+			{
+				if (connects[i] < 0 || (uint32_t)connects[i] >= header.numVertices) valid = false;
+			}
+
+			if (header.topology == zUtilsVertexCacheHeader::meshTopology && sum != header.numConnects) valid = false;
+			if (header.topology == zUtilsVertexCacheHeader::graphTopology && header.numConnects % 2 != 0) valid = false;
+		}
+
+		if (valid)
+		{
+			frames.resize((size_t)header.numFrames);
+			if (frames.size() > 0) memcpy(frames.data(), file.getData() + header.indexOffset, frames.size() * sizeof(zUtilsFieldFrame));
+
+			size_t numBytes = (size_t)header.numVertices * 3 * sizeof(uint32_t);
+
+			for (auto &frame : frames)
+			{
+				if (frame.offset > file.getSize() || frame.size > file.getSize() - frame.offset) valid = false;
+				else if (!(frame.flags & zUtilsFieldFrame::compressedFlag) && frame.size != numBytes) valid = false;
+			}
+
+			if (frames.size() > 0 && (frames[0].flags & zUtilsFieldFrame::deltaFlag)) valid = false;
+		}
+
+		if (!valid)
+		{
+			cout << " error in reading file  " << path.c_str() << " : invalid vertex cache file." << endl;
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsVertexCacheReader::close()
+	{
+		file.close();
+		frames.clear();
+		current.clear();
+		packed.clear();
+		shuffled.clear();
+
+		memset(&header, 0, sizeof(header));
+		currentFrame = -1;
+	}
+
+	ZSPACE_INLINE bool zUtilsVertexCacheReader::isOpen()
+	{
+		return file.isOpen();
+	}
+
+	ZSPACE_INLINE const zUtilsVertexCacheHeader& zUtilsVertexCacheReader::getHeader()
+	{
+		return header;
+	}
+
+	ZSPACE_INLINE void zUtilsVertexCacheReader::getTopology(vector<int> &counts, vector<int> &connects)
+	{
+		counts.clear();
+		connects.clear();
+
+		if (!isOpen()) return;
+
+		const int* data = (const int*)(file.getData() + header.topologyOffset);
+
+		counts.assign(data, data + header.numCounts);
+		connects.assign(data + header.numCounts, data + header.numCounts + header.numConnects);
+	}
+
+	ZSPACE_INLINE int zUtilsVertexCacheReader::numFrames()
+	{
+		return (int)frames.size();
+	}
+
+	ZSPACE_INLINE double zUtilsVertexCacheReader::getFrameTime(int frame)
+	{
+		if (frame < 0 || frame >= (int)frames.size()) throw std::invalid_argument(" error: frame index out of bounds.");
+
+		return frames[frame].time;
+	}
+
+	ZSPACE_INLINE bool zUtilsVertexCacheReader::getFrame(int frame, float* positions)
+	{
+		if (frame < 0 || frame >= (int)frames.size()) return false;
+
+		// decode from the closest key frame, or continue from the last decoded frame
+		int start = frame;
+		while (start > 0 && (frames[start].flags & zUtilsFieldFrame::deltaFlag)) start--;
+
+		if (currentFrame >= start && currentFrame <= frame) start = currentFrame + 1;
+		if (start > frame) start = frame;
+
+		for (int i = start; i <= frame; i++)
+		{
+			if (!decodeFrame(i))
+			{
+				currentFrame = -1;
+				return false;
+			}
+		}
+
+		double step = header.quantization;
+
+		zUtilsParallel::forRange(0, (int)current.size(), [&](int begin, int end, int)
+		{
+			for (int i = begin; i < end; i++) positions[i] = (float)(current[i] * step);
+		}, 4096);
+
+		return true;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsVertexCacheReader::decodeFrame(int frame)
+	{
+		if (frame == currentFrame) return true;
+
+		zUtilsFieldFrame &f = frames[frame];
+		const unsigned char* data = (const unsigned char*)file.getData() + f.offset;
+
+		int numCoords = (int)header.numVertices * 3;
+		size_t numBytes = (size_t)numCoords * sizeof(uint32_t);
+
+		bool delta = (f.flags & zUtilsFieldFrame::deltaFlag) != 0;
+		if (delta && currentFrame != frame - 1) return false;
+
+		packed.resize(numCoords);
+
+		if (f.flags & zUtilsFieldFrame::compressedFlag)
+		{
+			shuffled.resize(numBytes);
+			if (!zUtilsCompression::decompressChunks(data, (size_t)f.size, shuffled.data(), numBytes)) return false;
+
+			zUtilsCompression::unshuffleBytes(shuffled.data(), numCoords, sizeof(uint32_t), (unsigned char*)packed.data());
+		}
+		else if (numBytes > 0) memcpy(packed.data(), data, numBytes);
+
+		current.resize(numCoords);
+
+		zUtilsParallel::forRange(0, numCoords, [&](int start, int end, int)
+		{
+			for (int i = start; i < end; i++)
+			{
+				int32_t value = (int32_t)((packed[i] >> 1) ^ (0u - (packed[i] & 1)));
+				current[i] = (delta) ? (int32_t)((uint32_t)current[i] + (uint32_t)value) : value;
+			}
+		}, 4096);
+
+		currentFrame = frame;
+		return true;
+	}
+
+}
@@ -0,0 +1,322 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsImageWriter.h>
+
+namespace zSpace
+{
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsImageWriter::zUtilsImageWriter(int numWorkers, int _capacity)
+	{
+		capacity = (_capacity > 0) ? _capacity : 1;
+
+		nextSubmit = 0;
+		nextWrite = 0;
+		errors = 0;
+
+		writing = false;
+		stopping = false;
+
+		if (numWorkers < 1) numWorkers = (int)thread::hardware_concurrency();
+		if (numWorkers < 1) numWorkers = 1;
+
+		for (int i = 0; i < numWorkers; i++) workers.push_back(thread(&zUtilsImageWriter::work, this));
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsImageWriter::~zUtilsImageWriter()
+	{
+		join();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsImageWriter::submit(vector<MatrixXf> &matrices, string path, zFileTpye type)
+	{
+		unique_ptr<zImageFrame> frame(new zImageFrame());
+		getPixels(matrices, frame->pixels, frame->width, frame->height);
+
+		frame->path = path;
+		frame->type = type;
+		frame->alpha = (matrices.size() == 4);
+
+		return enqueue(frame);
+	}
+
+	ZSPACE_INLINE bool zUtilsImageWriter::submit(vector<unsigned char> &pixels, int width, int height, string path, zFileTpye type, bool alpha)
+	{
+		if (width <= 0 || height <= 0 || pixels.size() != (size_t)width * height * 4)
+		{
+			throw std::invalid_argument(" error: pixel container size does not match the image size.");
+		}
+
+		unique_ptr<zImageFrame> frame(new zImageFrame());
+		frame->pixels.swap(pixels);
+
+		frame->width = width;
+		frame->height = height;
+		frame->path = path;
+		frame->type = type;
+		frame->alpha = alpha;
+
+		return enqueue(frame);
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::flush()
+	{
+		unique_lock<mutex> guard(lock);
+		writeSignal.wait(guard, [&] { return nextWrite == nextSubmit; });
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::join()
+	{
+		{
+			lock_guard<mutex> guard(lock);
+			if (stopping && workers.size() == 0) return;
+
+			stopping = true;
+		}
+
+		// the workers drain the queue before they exit
+		queueSignal.notify_all();
+
+		for (auto &w : workers) w.join();
+		workers.clear();
+	}
+
+	ZSPACE_INLINE int zUtilsImageWriter::numPending()
+	{
+		lock_guard<mutex> guard(lock);
+		return (int)(nextSubmit - nextWrite);
+	}
+
+	ZSPACE_INLINE int zUtilsImageWriter::numErrors()
+	{
+		lock_guard<mutex> guard(lock);
+		return errors;
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::getPixels(vector<MatrixXf> &matrices, vector<unsigned char> &pixels, int &width, int &height)
+	{
+		if (matrices.size() == 0)
+		{
+			throw std::invalid_argument(" error: matrix empty.");
+		}
+
+		width = matrices[0].rows();
+		height = matrices[0].cols();
+
+		for (int i = 1; i < (int)matrices.size(); i++)
+		{
+			if (matrices[i].rows() != width || matrices[i].cols() != height)
+			{
+				throw std::invalid_argument(" error: matrix sizes are not equal.");
+			}
+		}
+
+		int numChannels = (int)(std::min)(matrices.size(), (size_t)4);
+
+		pixels.assign((size_t)width * height * 4, 0);
+
+		zUtilsParallel::forEach(0, height, [&](int y)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				unsigned char* pixel = &pixels[4 * ((size_t)width * y + x)];
+				pixel[3] = 255;
+
+				for (int c = 0; c < numChannels; c++)
+				{
+					float val = (std::min)((std::max)(matrices[c].coeff(x, y), 0.0f), 1.0f);
+					pixel[c] = (unsigned char)(val * 255);
+				}
+			}
+		}, 16);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsImageWriter::enqueue(unique_ptr<zImageFrame> &frame)
+	{
+		if (frame->type != zPNG && frame->type != zJPEG && frame->type != zBMP)
+		{
+			throw std::invalid_argument(" error: image writer file type has to be zPNG, zJPEG or zBMP.");
+		}
+
+		{
+			unique_lock<mutex> guard(lock);
+
+			// back pressure
+			writeSignal.wait(guard, [&] { return stopping || nextSubmit - nextWrite < capacity; });
+
+			if (stopping)
+			{
+				cout << " error: image writer is stopped, frame not written  " << frame->path.c_str() << endl;
+				return false;
+			}
+
+			frame->sequence = nextSubmit++;
+			queue.push_back(std::move(frame));
+		}
+
+		queueSignal.notify_one();
+		return true;
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::work()
+	{
+		while (true)
+		{
+			unique_ptr<zImageFrame> frame;
+
+			{
+				unique_lock<mutex> guard(lock);
+				queueSignal.wait(guard, [&] { return stopping || queue.size() > 0; });
+
+				if (queue.size() == 0) return;
+
+				frame = std::move(queue.front());
+				queue.pop_front();
+			}
+
+			encode(*frame);
+
+			// frames are written in submission order, by whichever worker completes the next frame in sequence
+			unique_lock<mutex> guard(lock);
+
+			encoded[frame->sequence] = std::move(frame);
+			if (writing) continue;
+
+			writing = true;
+
+			while (true)
+			{
+				auto it = encoded.find(nextWrite);
+				if (it == encoded.end()) break;
+
+				unique_ptr<zImageFrame> next = std::move(it->second);
+				encoded.erase(it);
+
+				guard.unlock();
+				write(*next);
+				guard.lock();
+
+				if (!next->valid) errors++;
+
+				nextWrite++;
+				writeSignal.notify_all();
+			}
+
+			writing = false;
+		}
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::encode(zImageFrame &frame)
+	{
+		frame.valid = true;
+
+		try
+		{
+			if (frame.type == zPNG)
+			{
+				unsigned error = lodepng::encode(frame.bytes, frame.pixels, frame.width, frame.height);
+
+				if (error)
+				{
+					std::cout << "encoder error " << error << ": " << lodepng_error_text(error) << std::endl;
+					frame.valid = false;
+				}
+			}
+			else if (frame.type == zJPEG)
+			{
+				vector<unsigned char> rgb((size_t)frame.width * frame.height * 3);
+				for (size_t i = 0; i < (size_t)frame.width * frame.height; i++)
+				{
+					rgb[i * 3 + 0] = frame.pixels[i * 4 + 0];
+					rgb[i * 3 + 1] = frame.pixels[i * 4 + 1];
+					rgb[i * 3 + 2] = frame.pixels[i * 4 + 2];
+				}
+
+				// same settings as zUtilsCore::matrixToJPEG
+				jpegBuffer() = &frame.bytes;
+				frame.valid = TooJpeg::writeJpeg(jpegWriteByte, rgb.data(), frame.width, frame.height, true, 100, false, "zSpace JPEG image");
+				jpegBuffer() = nullptr;
+			}
+			else
+			{
+				frame.bmp.reset(new zUtilsBMP(frame.width, frame.height, frame.alpha));
+				uint32_t channels = frame.bmp->bmp_info_header.bit_count / 8;
+
+				for (size_t i = 0; i < (size_t)frame.width * frame.height; i++)
+				{
+					frame.bmp->data[channels * i + 0] = frame.pixels[i * 4 + 2];
+					frame.bmp->data[channels * i + 1] = frame.pixels[i * 4 + 1];
+					frame.bmp->data[channels * i + 2] = frame.pixels[i * 4 + 0];
+
+					if (channels == 4) frame.bmp->data[channels * i + 3] = frame.pixels[i * 4 + 3];
+				}
+			}
+		}
+		catch (const std::exception &e)
+		{
+			cout << " error in encoding image  " << frame.path.c_str() << " : " << e.what() << endl;
+			frame.valid = false;
+		}
+
+		vector<unsigned char>().swap(frame.pixels);
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::write(zImageFrame &frame)
+	{
+		if (!frame.valid) return;
+
+		try
+		{
+			if (frame.bmp) frame.bmp->write(frame.path.c_str());
+			else
+			{
+				ofstream myfile(frame.path.c_str(), ios::binary);
+
+				if (myfile.fail())
+				{
+					cout << " error in opening file  " << frame.path.c_str() << endl;
+					frame.valid = false;
+					return;
+				}
+
+				myfile.write((const char*)frame.bytes.data(), frame.bytes.size());
+				frame.valid = myfile.good();
+
+				myfile.close();
+			}
+		}
+		catch (const std::exception &e)
+		{
+			cout << " error in writing image  " << frame.path.c_str() << " : " << e.what() << endl;
+			frame.valid = false;
+		}
+	}
+
+	ZSPACE_INLINE vector<unsigned char>*& zUtilsImageWriter::jpegBuffer()
+	{
+		static thread_local vector<unsigned char>* buffer = nullptr;
+		return buffer;
+	}
+
+	ZSPACE_INLINE void zUtilsImageWriter::jpegWriteByte(unsigned char byte)
+	{
+		jpegBuffer()->push_back(byte);
+	}
+
+}
@@ -0,0 +1,383 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsJson.h>
+
+#include <cmath>
+#include <cstring>
+
+namespace zSpace
+{
+	//---- zUtilsJsonHEReader
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsJsonHEReader::zUtilsJsonHEReader()
+	{
+		clear();
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsJsonHEReader::~zUtilsJsonHEReader() {}
+
+	//---- METHODS
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::read(std::string path)
+	{
+		clear();
+
+		zUtilsMappedFile file;
+		if (!file.open(path))
+		{
+			error = "unable to open file";
+			return false;
+		}
+
+		const char* data = file.getData();
+		if (data == nullptr)
+		{
+			error = "empty file";
+			return false;
+		}
+
+		bool chk = json::sax_parse(data, data + file.getSize(), this);
+		file.close();
+
+		if (chk && depth != 0)
+		{
+			error = "unexpected end of file";
+			chk = false;
+		}
+
+		return chk;
+	}
+
+	ZSPACE_INLINE void zUtilsJsonHEReader::clear()
+	{
+		vertices.clear();
+		halfedges.clear();
+		faces.clear();
+		vertexAttributes.clear();
+		halfedgeAttributes.clear();
+		faceAttributes.clear();
+
+		halfedgeStride = -1;
+		vertexAttributeStride = -1;
+		halfedgeAttributeStride = -1;
+		faceAttributeStride = -1;
+
+		depth = 0;
+		intTarget = nullptr;
+		doubleTarget = nullptr;
+		strideTarget = nullptr;
+		rowSize = 0;
+
+		error.clear();
+	}
+
+	ZSPACE_INLINE std::string zUtilsJsonHEReader::getError()
+	{
+		return error;
+	}
+
+	//---- SAX METHODS
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::null()
+	{
+		// non finite values are written as null
+		if (doubleTarget != nullptr) return addNumber(nan(""), false);
+		if (!inKnownKey()) return true;
+
+		error = "unexpected null value";
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::boolean(bool)
+	{
+		if (!inKnownKey()) return true;
+
+		error = "unexpected boolean value";
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::number_integer(number_integer_t val)
+	{
+		return addNumber((double)val, true);
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::number_unsigned(number_unsigned_t val)
+	{
+		return addNumber((double)val, true);
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::number_float(number_float_t val, const string_t &)
+	{
+		return addNumber(val, false);
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::string(string_t &)
+	{
+		if (!inKnownKey()) return true;
+
+		error = "unexpected string value";
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::binary(binary_t &)
+	{
+		if (!inKnownKey()) return true;
+
+		error = "unexpected binary value";
+		return false;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::start_object(std::size_t)
+	{
+		if (inKnownKey())
+		{
+			error = "unexpected object";
+			return false;
+		}
+
+		depth++;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::end_object()
+	{
+		depth--;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::start_array(std::size_t)
+	{
+		if (depth == 0)
+		{
+			error = "expected an object";
+			return false;
+		}
+
+		if (inKnownKey())
+		{
+			// the value of the key, or a row of it
+			bool valid = (depth == 1) || (depth == 2 && strideTarget != nullptr);
+
+			if (!valid)
+			{
+				error = "unexpected nested array";
+				return false;
+			}
+
+			rowSize = 0;
+		}
+
+		depth++;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::end_array()
+	{
+		if (inKnownKey() && depth == 3)
+		{
+			if (*strideTarget == -1) *strideTarget = rowSize;
+			else if (*strideTarget != rowSize)
+			{
+				error = "inconsistent row size";
+				return false;
+			}
+		}
+
+		depth--;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::key(string_t &val)
+	{
+		if (depth != 1) return true;
+
+		intTarget = nullptr;
+		doubleTarget = nullptr;
+		strideTarget = nullptr;
+
+		if (val == "Vertices") intTarget = &vertices;
+		else if (val == "Faces") intTarget = &faces;
+		else if (val == "Halfedges")
+		{
+			intTarget = &halfedges;
+			strideTarget = &halfedgeStride;
+		}
+		else if (val == "VertexAttributes")
+		{
+			doubleTarget = &vertexAttributes;
+			strideTarget = &vertexAttributeStride;
+		}
+		else if (val == "HalfedgeAttributes")
+		{
+			doubleTarget = &halfedgeAttributes;
+			strideTarget = &halfedgeAttributeStride;
+		}
+		else if (val == "FaceAttributes")
+		{
+			doubleTarget = &faceAttributes;
+			strideTarget = &faceAttributeStride;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex)
+	{
+		error = ex.what();
+		return false;
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::addNumber(double value, bool integral)
+	{
+		if (!inKnownKey()) return true;
+
+		// flat arrays hold their values at depth 2, row arrays at depth 3
+		int valueDepth = (strideTarget != nullptr) ? 3 : 2;
+
+		if (depth != valueDepth)
+		{
+			error = "unexpected number";
+			return false;
+		}
+
+		if (intTarget != nullptr)
+		{
+			if (!integral)
+			{
+				error = "expected an integer";
+				return false;
+			}
+
+			intTarget->push_back((int)value);
+		}
+		else doubleTarget->push_back(value);
+
+		rowSize++;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonHEReader::inKnownKey()
+	{
+		return depth >= 1 && (intTarget != nullptr || doubleTarget != nullptr);
+	}
+
+	//---- zUtilsJsonWriter
+
+	//---- CONSTRUCTOR
+
+	ZSPACE_INLINE zUtilsJsonWriter::zUtilsJsonWriter(ostream &_out)
+	{
+		out = &_out;
+		afterKey = false;
+	}
+
+	//---- DESTRUCTOR
+
+	ZSPACE_INLINE zUtilsJsonWriter::~zUtilsJsonWriter()
+	{
+		flush();
+	}
+
+	//---- METHODS
+
+	ZSPACE_INLINE void zUtilsJsonWriter::beginObject()
+	{
+		beginElement();
+		buffer.write('{');
+		firstElement.push_back(true);
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::endObject()
+	{
+		buffer.write('}');
+		if (!firstElement.empty()) firstElement.pop_back();
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::beginArray()
+	{
+		beginElement();
+		buffer.write('[');
+		firstElement.push_back(true);
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::endArray()
+	{
+		buffer.write(']');
+		if (!firstElement.empty()) firstElement.pop_back();
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::key(const char* name)
+	{
+		beginElement();
+
+		buffer.write('"');
+		buffer.write(name);
+		buffer.write("\":");
+
+		afterKey = true;
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::value(int value)
+	{
+		beginElement();
+		buffer.write(value);
+	}
+
+	ZSPACE_INLINE void zUtilsJsonWriter::value(double value)
+	{
+		beginElement();
+
+		if (!std::isfinite(value))
+		{
+			buffer.write("null");
+			return;
+		}
+
+		// shortest round trip representation, same as json::dump
+		char number[64];
+		char* end = nlohmann::detail::to_chars(number, number + sizeof(number) - 1, value);
+		*end = '\0';
+
+		buffer.write(number);
+	}
+
+	ZSPACE_INLINE bool zUtilsJsonWriter::flush()
+	{
+		return buffer.flush(*out);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zUtilsJsonWriter::beginElement()
+	{
+		if (buffer.getSize() >= (1 << 20)) flush();
+
+		if (afterKey)
+		{
+			afterKey = false;
+			return;
+		}
+
+		if (firstElement.empty()) return;
+
+		if (firstElement.back()) firstElement.back() = false;
+		else buffer.write(',');
+	}
+
+}
@@ -0,0 +1,61 @@
+// This file is part of zspace, a simple C++ collection of geometry data-structures & algorithms, 
+// data analysis & visualization framework.
+//
+// Copyright (C) 2019 ZSPACE 
+// 
+// This Source Code Form is subject to the terms of the MIT License 
+// If a copy of the MIT License was not distributed with this file, You can 
+// obtain one at https://opensource.org/licenses/MIT.
+//
+// Author : Vishu Bhooshan <vishu.bhooshan@zaha-hadid.com>
+//
+
+#include<headers/zCore/utilities/zUtilsParallel.h>
+
+namespace zSpace
+{
+	//---- METHODS
+
+	ZSPACE_INLINE int zUtilsParallel::getNumThreads()
+	{
+		int numThreads = threadCount();
+		if (numThreads > 0) return numThreads;
+
+		numThreads = (int)thread::hardware_concurrency();
+		return (numThreads > 0) ? numThreads : 1;
+	}
+
+	ZSPACE_INLINE void zUtilsParallel::setNumThreads(int numThreads)
+	{
+		threadCount() = (numThreads > 0) ? numThreads : 0;
+	}
+
+	ZSPACE_INLINE bool zUtilsParallel::inParallelRegion()
+	{
+		return workerFlag();
+	}
+
+	ZSPACE_INLINE int zUtilsParallel::getNumRanges(int numIndicies, int grain)
+	{
+		if (numIndicies <= 0) return 0;
+		if (grain < 1) grain = 1;
+
+		int maxRanges = (numIndicies + grain - 1) / grain;
+		return (std::min)(getNumThreads(), maxRanges);
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE bool& zUtilsParallel::workerFlag()
+	{
+		static thread_local bool worker = false;
+		return worker;
+	}
+
+	ZSPACE_INLINE int& zUtilsParallel::threadCount()
+	{
+		static int numThreads = 0;
+		return numThreads;
+	}
+
+}
@@ -21,6 +21,8 @@ namespace zSpace
 	ZSPACE_INLINE zFn::zFn()
 	{
 		fnType = zInvalidFn;
+		filePrecision = 6;
+		fileQuantization = false;
 
 	}
 
@@ -29,6 +31,30 @@ namespace zSpace
 	ZSPACE_INLINE zFn::~zFn() {}
 
 
+	//---- SET METHODS
+
+	ZSPACE_INLINE void zFn::setFilePrecision(int precision)
+	{
+		filePrecision = (precision > 0) ? precision : 6;
+	}
+
+	ZSPACE_INLINE void zFn::setFileQuantization(bool quantize)
+	{
+		fileQuantization = quantize;
+	}
+
+	//---- GET METHODS
+
+	ZSPACE_INLINE int zFn::getFilePrecision()
+	{
+		return filePrecision;
+	}
+
+	ZSPACE_INLINE bool zFn::getFileQuantization()
+	{
+		return fileQuantization;
+	}
+
 	//---- OVERRIDE METHODS
 
 	ZSPACE_INLINE bool zFn::json_read(string path, json& j)
@@ -58,13 +58,13 @@ namespace zSpace
 		}
 		else if (type == zJSON)
 		{
-			json j;
-
-			bool chk = json_read(path, j);
-			if (chk) from(j, staticGeom);
-
-			//bool chk = fromJSON(path);
-			//if (chk && staticGeom) setStaticContainers();
+			bool chk = fromJSON(path);
+			if (chk && staticGeom) setStaticContainers();
+		}
+		else if (type == zGRAPH)
+		{
+			bool chk = fromGRAPH(path);
+			if (chk && staticGeom) setStaticContainers();
 		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
@@ -234,13 +234,8 @@ namespace zSpace
 	ZSPACE_INLINE void zFnGraph::to(string path, zFileTpye type)
 	{
 		if (type == zTXT) toTXT(path);
-		else if (type == zJSON)
-		{
-			json j;
-			to(j);
-			bool chk = json_write(path, j);
-			//toJSON(path);
-		}
+		else if (type == zJSON) toJSON(path);
+		else if (type == zGRAPH) toGRAPH(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -1255,6 +1250,49 @@ namespace zSpace
 		transform = graphObj->transformationMatrix.asMatrix();
 	}
 
+	//---- DATABASE METHODS
+
+	ZSPACE_INLINE bool zFnGraph::to(zDatabase &database, string tableName, int64_t id)
+	{
+		string name = tableName + " : " + to_string(id);
+
+		vector<unsigned char> data;
+		if (!writeGRAPH(name, &data)) return false;
+
+		zPoint minBB, maxBB;
+		getBounds(minBB, maxBB);
+
+		if (!database.geometryTableCreate(tableName)) return false;
+
+		if (!database.geometryInsert(tableName, id, zGRAPH, minBB, maxBB, data.data(), data.size()))
+		{
+			cout << " error in writing geometry  " << name.c_str() << endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnGraph::from(zDatabase &database, string tableName, int64_t id, bool staticGeom)
+	{
+		string name = tableName + " : " + to_string(id);
+
+		int type;
+		vector<unsigned char> data;
+		zUtilsBinaryReader reader;
+
+		if (!database.geometrySelect(tableName, id, type, data) || type != zGRAPH || !reader.open(data.data(), data.size(), "ZGRF", 1))
+		{
+			cout << " error in reading geometry  " << name.c_str() << endl;
+			return false;
+		}
+
+		bool chk = readGRAPH(reader, name);
+		if (chk && staticGeom) setStaticContainers();
+
+		return chk;
+	}
+
 	//---- PROTECTED OVERRIDE METHODS
 
 	ZSPACE_INLINE void zFnGraph::transformObject(zTransform &transform)
@@ -1517,171 +1555,307 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zFnGraph::fromJSON(string infilename)
 	{
-		json j;
-		zUtilsJsonHE graphJSON;
-		// read data to json
-		ifstream in_myfile;
-		in_myfile.open(infilename.c_str());
-		int lineCnt = 0;
-		if (in_myfile.fail())
+		zUtilsJsonHEReader reader;
+
+		if (!reader.read(infilename))
 		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
+			cout << " error in reading file  " << infilename.c_str() << " : " << reader.getError() << endl;
 			return false;
 		}
-		in_myfile >> j;
-		in_myfile.close();
-		// read data to json graph
-		// Vertices
-		graphJSON.vertices.clear();
-		graphJSON.vertices = (j["Vertices"].get<vector<int>>());
-		// Edges
-		graphJSON.halfedges.clear();
-		graphJSON.halfedges = (j["Halfedges"].get<vector<vector<int>>>());
-		graphObj->graph.edges.clear();
-		// update graph
-		graphObj->graph.clear();
-		graphObj->graph.vertices.assign(graphJSON.vertices.size(), zVertex());
-		graphObj->graph.halfEdges.assign(graphJSON.halfedges.size(), zHalfEdge());
-		graphObj->graph.edges.assign(floor(graphJSON.halfedges.size() * 0.5), zEdge());
-		graphObj->graph.vHandles.assign(graphJSON.vertices.size(), zVertexHandle());
-		graphObj->graph.eHandles.assign(floor(graphJSON.halfedges.size() * 0.5), zEdgeHandle());
-		graphObj->graph.heHandles.assign(graphJSON.halfedges.size(), zHalfEdgeHandle());
-		// set IDs
-		for (int i = 0; i < graphJSON.vertices.size(); i++) graphObj->graph.vertices[i].setId(i);
-		for (int i = 0; i < graphJSON.halfedges.size(); i++)graphObj->graph.halfEdges[i].setId(i);
-		// set Pointers
-		int n_v = 0;
-		for (zItGraphVertex v(*graphObj); !v.end(); v++)
+
+		const int grain = 1 << 14;
+
+		int nV = (int)reader.vertices.size();
+		int nHE = (reader.halfedgeStride == 3) ? (int)reader.halfedges.size() / 3 : 0;
+
+		// vertex rows hold position, followed by color (6)
+		int vStride = reader.vertexAttributeStride;
+
+		bool valid = (reader.halfedgeStride == 3 || reader.halfedges.empty());
+		valid = valid && (vStride == 3 || vStride == 6 || nV == 0);
+		valid = valid && (nV == 0 || (int)reader.vertexAttributes.size() == nV * vStride);
+
+		if (valid) valid = setHalfEdgeTopology(reader.vertices.data(), nV, reader.halfedges.data(), nHE);
+
+		if (!valid)
 		{
-			v.setId(n_v);
-			if (graphJSON.vertices[n_v] != -1)
-			{
-				zItGraphHalfEdge he(*graphObj, graphJSON.vertices[n_v]);
-				v.setHalfEdge(he);
-				graphObj->graph.vHandles[n_v].id = n_v;
-				graphObj->graph.vHandles[n_v].he = graphJSON.vertices[n_v];
-			}
-			n_v++;
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete graph data." << endl;
+			return false;
 		}
-		graphObj->graph.setNumVertices(n_v);
-		int n_he = 0;
-		int n_e = 0;
-		for (zItGraphHalfEdge he(*graphObj); !he.end(); he++)
+
+		int nE = nHE / 2;
+
+		// vertex attributes
+		const double* vData = reader.vertexAttributes.data();
+
+		graphObj->graph.vertexPositions.resize(nV);
+		graphObj->graph.vertexColors.resize(nV);
+		graphObj->graph.vertexWeights.assign(nV, 2.0);
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
 		{
-			// Half Edge
-			he.setId(n_he);
-			graphObj->graph.heHandles[n_he].id = n_he;
-			if (graphJSON.halfedges[n_he][0] != -1)
-			{
-				zItGraphHalfEdge e(*graphObj, graphJSON.halfedges[n_he][0]);
-				he.setPrev(e);
-				graphObj->graph.heHandles[n_he].p = graphJSON.halfedges[n_he][0];
-			}
-			if (graphJSON.halfedges[n_he][1] != -1)
-			{
-				zItGraphHalfEdge e(*graphObj, graphJSON.halfedges[n_he][1]);
-				he.setNext(e);
-				graphObj->graph.heHandles[n_he].n = graphJSON.halfedges[n_he][1];
-			}
-			if (graphJSON.halfedges[n_he][2] != -1)
-			{
-				zItGraphVertex v(*graphObj, graphJSON.halfedges[n_he][2]);
-				he.setVertex(v);
-				graphObj->graph.heHandles[n_he].v = graphJSON.halfedges[n_he][2];
-			}
-			// symmetry half edges
-			if (n_he % 2 == 1)
+			const double* row = vData + (size_t)i * vStride;
+
+			graphObj->graph.vertexPositions[i] = zVector(row[0], row[1], row[2]);
+			graphObj->graph.vertexColors[i] = (vStride == 6) ? zColor(row[3], row[4], row[5], 1) : zColor(1, 0, 0, 1);
+		}, grain);
+
+		// edge attributes, one color row per half edge
+		int eStride = reader.halfedgeAttributeStride;
+
+		if (nE > 0 && eStride == 3 && (int)reader.halfedgeAttributes.size() == nHE * eStride)
+		{
+			const double* eData = reader.halfedgeAttributes.data();
+
+			graphObj->graph.edgeColors.resize(nE);
+
+			zUtilsParallel::forEach(0, nE, [&](int i)
 			{
-				zItGraphHalfEdge heSym(*graphObj, n_he - 1);
-				he.setSym(heSym);
-				zItGraphEdge e(*graphObj, n_e);
-				e.setId(n_e);
-				e.setHalfEdge(heSym, 0);
-				e.setHalfEdge(he, 1);
-				he.setEdge(e);
-				heSym.setEdge(e);
-				graphObj->graph.heHandles[n_he].e = n_e;
-				graphObj->graph.heHandles[n_he - 1].e = n_e;
-				graphObj->graph.eHandles[n_e].id = n_e;
-				graphObj->graph.eHandles[n_e].he0 = n_he - 1;
-				graphObj->graph.eHandles[n_e].he1 = n_he;
-				n_e++;
-			}
-			n_he++;
+				const double* row = eData + (size_t)i * 2 * eStride;
+				graphObj->graph.edgeColors[i] = zColor(row[0], row[1], row[2], 1);
+			}, grain);
 		}
-		graphObj->graph.setNumEdges(n_e);
+		else graphObj->graph.edgeColors.assign(nE, zColor());
 
-		// Vertex Attributes
-		graphJSON.vertexAttributes = j["VertexAttributes"].get<vector<vector<double>>>();
-		//printf("\n vertexAttributes: %zi %zi", vertexAttributes.size(), vertexAttributes[0].size());
-		graphObj->graph.vertexPositions.clear();
-		graphObj->graph.vertexColors.clear();
-		graphObj->graph.vertexWeights.clear();
-		for (int i = 0; i < graphJSON.vertexAttributes.size(); i++)
+		graphObj->graph.edgeWeights.assign(nE, 1.0);
+
+		reader.clear();
+
+		printf("\n graph: %i %i ", numVertices(), numEdges());
+
+		// add to maps
+		graphObj->graph.positionVertex.reserve(nV);
+		graphObj->graph.existingHalfEdges.reserve(nHE);
+
+		for (int i = 0; i < graphObj->graph.vertexPositions.size(); i++)
 		{
-			for (int k = 0; k < graphJSON.vertexAttributes[i].size(); k++)
-			{
-				// position
-				if (graphJSON.vertexAttributes[i].size() == 3)
-				{
-					zVector pos(graphJSON.vertexAttributes[i][k], graphJSON.vertexAttributes[i][k + 1], graphJSON.vertexAttributes[i][k + 2]);
-					graphObj->graph.vertexPositions.push_back(pos);
-					graphObj->graph.vertexColors.push_back(zColor(1,0,0,1));
-					graphObj->graph.vertexWeights.push_back(2.0);
-					k += 2;
-				}
-				
-				// position and color
-				if (graphJSON.vertexAttributes[i].size() == 6)
-				{
-					zVector pos(graphJSON.vertexAttributes[i][k], graphJSON.vertexAttributes[i][k + 1], graphJSON.vertexAttributes[i][k + 2]);
-					graphObj->graph.vertexPositions.push_back(pos);
-					zColor col(graphJSON.vertexAttributes[i][k + 3], graphJSON.vertexAttributes[i][k + 4], graphJSON.vertexAttributes[i][k + 5], 1);
-					graphObj->graph.vertexColors.push_back(col);
-					graphObj->graph.vertexWeights.push_back(2.0);
-					k += 5;
-				}
-			}
+			graphObj->graph.addToPositionMap(graphObj->graph.vertexPositions[i], i);
 		}
-		// Edge Attributes
-		graphJSON.halfedgeAttributes = j["HalfedgeAttributes"].get<vector<vector<double>>>();
-		graphObj->graph.edgeColors.clear();
-		graphObj->graph.edgeWeights.clear();
-		if (graphJSON.halfedgeAttributes.size() == 0)
+
+		for (zItGraphEdge e(*graphObj); !e.end(); e++)
 		{
-			for (int i = 0; i < graphObj->graph.n_e; i++)
-			{
-				graphObj->graph.edgeColors.push_back(zColor());
-				graphObj->graph.edgeWeights.push_back(1.0);
-			}
+			int v1 = e.getHalfEdge(0).getVertex().getId();
+			int v2 = e.getHalfEdge(1).getVertex().getId();
+
+			graphObj->graph.addToHalfEdgesMap(v1, v2, e.getHalfEdge(0).getId());
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnGraph::fromGRAPH(string infilename)
+	{
+		zUtilsBinaryReader reader;
+
+		if (!reader.open(infilename, "ZGRF", 1))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		return readGRAPH(reader, infilename);
+	}
+
+	ZSPACE_INLINE bool zFnGraph::readGRAPH(zUtilsBinaryReader &reader, string infilename)
+	{
+		const int grain = 1 << 14;
+
+		// topology
+		size_t nV = 0, nHE = 0;
+		const int* vertexData = (const int*)reader.getBlock(zBinVertices, sizeof(int), nV);
+		const int* halfEdgeData = (const int*)reader.getBlock(zBinHalfEdges, 3 * sizeof(int), nHE);
+
+		// positions
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		size_t nP = 0, nD = 0;
+		const float* positionData = (const float*)reader.getBlock(zBinVertexPositions, sizeof(zVector), nP);
+		const uint16_t* quantizedData = nullptr;
+		const float* positionDomain = nullptr;
+
+		if (positionData == nullptr)
+		{
+			quantizedData = (const uint16_t*)reader.getBlock(zBinVertexPositionsQuantized, 3 * sizeof(uint16_t), nP);
+			positionDomain = (const float*)reader.getBlock(zBinPositionDomain, 6 * sizeof(float), nD);
+		}
+
+		bool valid = vertexData != nullptr && halfEdgeData != nullptr && nHE % 2 == 0 && nP == nV;
+		valid = valid && (positionData != nullptr || (quantizedData != nullptr && positionDomain != nullptr && nD == 1));
+
+		if (valid) valid = setHalfEdgeTopology(vertexData, nV, halfEdgeData, nHE);
+
+		if (!valid)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete graph data." << endl;
+			return false;
+		}
+
+		int nE = nHE / 2;
+
+		// vertex attributes
+		graphObj->graph.vertexPositions.resize(nV);
+
+		if (positionData != nullptr)
+		{
+			if (nV > 0) memcpy(&graphObj->graph.vertexPositions[0].x, positionData, nV * sizeof(zVector));
 		}
 		else
 		{
-			for (int i = 0; i < graphJSON.halfedgeAttributes.size(); i += 2)
+			zUtilsParallel::forEach(0, nV, [&](int i)
 			{
-				// color
-				if (graphJSON.halfedgeAttributes[i].size() == 3)
+				float* pos = &graphObj->graph.vertexPositions[i].x;
+
+				for (int k = 0; k < 3; k++)
 				{
-					zColor col(graphJSON.halfedgeAttributes[i][0], graphJSON.halfedgeAttributes[i][1], graphJSON.halfedgeAttributes[i][2], 1);
-					graphObj->graph.edgeColors.push_back(col);
-					graphObj->graph.edgeWeights.push_back(1.0);
+					pos[k] = positionDomain[k] + (positionDomain[k + 3] - positionDomain[k]) * (quantizedData[i * 3 + k] / 65535.0f);
 				}
-			}
+			}, grain);
 		}
-		printf("\n graph: %i %i ", numVertices(), numEdges());
-		// add to maps
-		for (int i = 0; i < graphObj->graph.vertexPositions.size(); i++)
+
+		auto unpackColors = [&](int type, size_t n, zColorArray &colors, zColor defaultColor)
+		{
+			size_t count = 0;
+			const float* colorData = (const float*)reader.getBlock(type, 4 * sizeof(float), count);
+
+			if (colorData == nullptr || count != n)
+			{
+				colors.assign(n, defaultColor);
+				return;
+			}
+
+			colors.resize(n);
+
+			zUtilsParallel::forEach(0, n, [&](int i)
+			{
+				colors[i] = zColor(colorData[i * 4 + 0], colorData[i * 4 + 1], colorData[i * 4 + 2], colorData[i * 4 + 3]);
+			}, grain);
+		};
+
+		auto copyWeights = [&](int type, size_t n, zDoubleArray &weights, double defaultWeight)
+		{
+			size_t count = 0;
+			const double* weightData = (const double*)reader.getBlock(type, sizeof(double), count);
+
+			if (weightData != nullptr && count == n) weights.assign(weightData, weightData + n);
+			else weights.assign(n, defaultWeight);
+		};
+
+		unpackColors(zBinVertexColors, nV, graphObj->graph.vertexColors, zColor(1, 0, 0, 1));
+		copyWeights(zBinVertexWeights, nV, graphObj->graph.vertexWeights, 2.0);
+
+		// edge attributes
+		unpackColors(zBinEdgeColors, nE, graphObj->graph.edgeColors, zColor());
+		copyWeights(zBinEdgeWeights, nE, graphObj->graph.edgeWeights, 1.0);
+
+		reader.close();
+
+		// add to maps 
+		graphObj->graph.positionVertex.reserve(nV);
+		graphObj->graph.existingHalfEdges.reserve(nHE);
+
+		for (int i = 0; i < (int)graphObj->graph.vertexPositions.size(); i++)
 		{
 			graphObj->graph.addToPositionMap(graphObj->graph.vertexPositions[i], i);
 		}
+
 		for (zItGraphEdge e(*graphObj); !e.end(); e++)
 		{
 			int v1 = e.getHalfEdge(0).getVertex().getId();
 			int v2 = e.getHalfEdge(1).getVertex().getId();
+
 			graphObj->graph.addToHalfEdgesMap(v1, v2, e.getHalfEdge(0).getId());
 		}
+
+		printf("\n graph: %i %i ", numVertices(), numEdges());
+
 		return true;
+	}
+
+	ZSPACE_INLINE bool zFnGraph::setHalfEdgeTopology(const int* vertexData, int nV, const int* halfEdgeData, int nHE)
+	{
+		if (nV < 0 || nHE < 0 || nHE % 2 != 0) return false;
+
+		const int grain = 1 << 14;
+
+		// indicies need to be in range, as they are used unchecked by the iterators
+		vector<char> rangeValid(zUtilsParallel::getNumThreads(), 1);
+
+		auto inRange = [](int id, int n) { return id >= -1 && id < n; };
+
+		zUtilsParallel::forRange(0, nHE, [&](int start, int end, int threadId)
+		{
+			for (int i = start; i < end; i++)
+			{
+				if (!inRange(halfEdgeData[i * 3 + 0], nHE) || !inRange(halfEdgeData[i * 3 + 1], nHE) || !inRange(halfEdgeData[i * 3 + 2], nV)) rangeValid[threadId] = 0;
+			}
+		}, grain);
+
+		bool valid = true;
+		for (int i = 0; i < nV; i++) valid = valid && inRange(vertexData[i], nHE);
+		for (char c : rangeValid) valid = valid && c;
+
+		if (!valid) return false;
+
+		int nE = nHE / 2;
+
+		// update graph
+		graphObj->graph.clear();
+
+		graphObj->graph.vertices.assign(nV, zVertex());
+		graphObj->graph.halfEdges.assign(nHE, zHalfEdge());
+		graphObj->graph.edges.assign(nE, zEdge());
+
+		graphObj->graph.vHandles.assign(nV, zVertexHandle());
+		graphObj->graph.eHandles.assign(nE, zEdgeHandle());
+		graphObj->graph.heHandles.assign(nHE, zHalfEdgeHandle());
 
+		zUtilsParallel::forEach(0, nV, [&](int i)
+		{
+			graphObj->graph.vertices[i].setId(i);
+
+			if (vertexData[i] != -1)
+			{
+				graphObj->graph.vertices[i].setHalfEdge(vertexData[i]);
+
+				graphObj->graph.vHandles[i].id = i;
+				graphObj->graph.vHandles[i].he = vertexData[i];
+			}
+		}, grain);
+
+		zUtilsParallel::forEach(0, nHE, [&](int i)
+		{
+			zHalfEdge &he = graphObj->graph.halfEdges[i];
+			zHalfEdgeHandle &heHandle = graphObj->graph.heHandles[i];
+
+			he.setId(i);
+			he.setPrev(halfEdgeData[i * 3 + 0]);
+			he.setNext(halfEdgeData[i * 3 + 1]);
+			he.setVertex(halfEdgeData[i * 3 + 2]);
+			he.setSym(i ^ 1);
+			he.setEdge(i / 2);
+
+			heHandle.id = i;
+			heHandle.p = halfEdgeData[i * 3 + 0];
+			heHandle.n = halfEdgeData[i * 3 + 1];
+			heHandle.v = halfEdgeData[i * 3 + 2];
+			heHandle.e = i / 2;
+		}, grain);
+
+		zUtilsParallel::forEach(0, nE, [&](int i)
+		{
+			graphObj->graph.edges[i].setId(i);
+			graphObj->graph.edges[i].setHalfEdge(i * 2, 0);
+			graphObj->graph.edges[i].setHalfEdge(i * 2 + 1, 1);
+
+			graphObj->graph.eHandles[i].id = i;
+			graphObj->graph.eHandles[i].he0 = i * 2;
+			graphObj->graph.eHandles[i].he1 = i * 2 + 1;
+		}, grain);
+
+		graphObj->graph.setNumVertices(nV);
+		graphObj->graph.setNumEdges(nE);
+
+		return true;
 	}
 
 	ZSPACE_INLINE void zFnGraph::toTXT(string outfilename)
@@ -1702,29 +1876,57 @@ namespace zSpace
 
 		}
 
+		// the text of contiguous element ranges is formatted in parallel and written in order
+		const int grain = 1 << 14;
+
 		myfile << "\n ";
 
 		// vertex positions
-		for (auto &vPos : graphObj->graph.vertexPositions)
+		int nV = graphObj->graph.vertexPositions.size();
+		vector<zUtilsTextWriter> vWriters(zUtilsParallel::getNumRanges(nV, grain), zUtilsTextWriter(filePrecision));
+
+		zUtilsParallel::forRange(0, nV, [&](int start, int end, int threadId)
 		{
+			zUtilsTextWriter &writer = vWriters[threadId];
+			writer.reserve((size_t)(end - start) * (3 * filePrecision + 20));
 
-			myfile << "\n v " << vPos.x << " " << vPos.y << " " << vPos.z;
+			for (int i = start; i < end; i++)
+			{
+				zPoint &vPos = graphObj->graph.vertexPositions[i];
+
+				writer.write("\n v ");
+				writer.write(vPos.x);
+				writer.write(' ');
+				writer.write(vPos.y);
+				writer.write(' ');
+				writer.write(vPos.z);
+			}
+		}, grain);
 
-		}
+		for (auto &writer : vWriters) writer.flush(myfile);
 
 		myfile << "\n ";
 
 		// edge connectivity
-		for (zItGraphEdge e(*graphObj); !e.end(); e++)
+		int nE = graphObj->graph.edges.size();
+		vector<zUtilsTextWriter> eWriters(zUtilsParallel::getNumRanges(nE, grain));
+
+		zUtilsParallel::forRange(0, nE, [&](int start, int end, int threadId)
 		{
-			int v1 = e.getHalfEdge(0).getVertex().getId();
-			int v2 = e.getHalfEdge(1).getVertex().getId();
+			zUtilsTextWriter &writer = eWriters[threadId];
 
-			myfile << "\n e ";
+			for (int i = start; i < end; i++)
+			{
+				zItGraphEdge e(*graphObj, i);
 
-			myfile << v1 << " ";
-			myfile << v2;
-		}
+				writer.write("\n e ");
+				writer.write(e.getHalfEdge(0).getVertex().getId());
+				writer.write(' ');
+				writer.write(e.getHalfEdge(1).getVertex().getId());
+			}
+		}, grain);
+
+		for (auto &writer : eWriters) writer.flush(myfile);
 
 		myfile << "\n ";
 
@@ -1739,80 +1941,188 @@ namespace zSpace
 		if (numVertices() != graphObj->graph.vertices.size()) removeInactiveElements(zVertexData);
 		if (numEdges() != graphObj->graph.edges.size()) removeInactiveElements(zEdgeData);
 
+		// export json
+		ofstream myfile;
+		myfile.open(outfilename.c_str());
 
-		// output file
-		zUtilsJsonHE graphJSON;
-		json j;
+		if (myfile.fail())
+		{
+			cout << " error in opening file  " << outfilename.c_str() << endl;
+			return;
+		}
+		else cout << endl << " JSON exported. File:   " << outfilename.c_str() << endl;
 
-		// create json
+		// keys are written in the sorted order of json::dump
+		zUtilsJsonWriter writer(myfile);
+		writer.beginObject();
 
-		// Vertices
-		for (zItGraphVertex v(*graphObj); !v.end(); v++)
+		// he Attributes, not exported
+		writer.key("HalfedgeAttributes");
+		writer.beginArray();
+		writer.endArray();
+
+		// Halfedges
+		writer.key("Halfedges");
+		writer.beginArray();
+		for (zItGraphHalfEdge he(*graphObj); !he.end(); he++)
 		{
-			if (v.getHalfEdge().isActive()) graphJSON.vertices.push_back(v.getHalfEdge().getId());
-			else graphJSON.vertices.push_back(-1);
+			writer.beginArray();
+
+			writer.value((he.getPrev().isActive()) ? he.getPrev().getId() : -1);
+			writer.value((he.getNext().isActive()) ? he.getNext().getId() : -1);
+			writer.value((he.getVertex().isActive()) ? he.getVertex().getId() : -1);
 
+			writer.endArray();
 		}
+		writer.endArray();
 
-		//Edges
-		for (zItGraphHalfEdge he(*graphObj); !he.end(); he++)
+		// vertex Attributes
+		writer.key("VertexAttributes");
+		writer.beginArray();
+		for (int i = 0; i < graphObj->graph.vertexPositions.size(); i++)
 		{
-			vector<int> HE_edges;
+			writer.beginArray();
 
-			if (he.getPrev().isActive()) HE_edges.push_back(he.getPrev().getId());
-			else HE_edges.push_back(-1);
+			writer.value((double)graphObj->graph.vertexPositions[i].x);
+			writer.value((double)graphObj->graph.vertexPositions[i].y);
+			writer.value((double)graphObj->graph.vertexPositions[i].z);
 
-			if (he.getNext().isActive()) HE_edges.push_back(he.getNext().getId());
-			else HE_edges.push_back(-1);
+			writer.value((double)graphObj->graph.vertexColors[i].r);
+			writer.value((double)graphObj->graph.vertexColors[i].g);
+			writer.value((double)graphObj->graph.vertexColors[i].b);
 
-			if (he.getVertex().isActive()) HE_edges.push_back(he.getVertex().getId());
-			else HE_edges.push_back(-1);
+			writer.endArray();
+		}
+		writer.endArray();
 
-			graphJSON.halfedges.push_back(HE_edges);
+		// Vertices
+		writer.key("Vertices");
+		writer.beginArray();
+		for (zItGraphVertex v(*graphObj); !v.end(); v++)
+		{
+			writer.value((v.getHalfEdge().isActive()) ? v.getHalfEdge().getId() : -1);
 		}
+		writer.endArray();
 
+		writer.endObject();
+		writer.flush();
 
-		// vertex Attributes
-		for (int i = 0; i < graphObj->graph.vertexPositions.size(); i++)
+		myfile.close();
+	}
+
+	ZSPACE_INLINE void zFnGraph::toGRAPH(string outfilename)
+	{
+		writeGRAPH(outfilename, nullptr);
+	}
+
+	ZSPACE_INLINE bool zFnGraph::writeGRAPH(string outfilename, vector<unsigned char>* buffer)
+	{
+		// remove inactive elements
+		if (numVertices() != (int)graphObj->graph.vertices.size()) removeInactiveElements(zVertexData);
+		if (numEdges() != (int)graphObj->graph.edges.size()) removeInactiveElements(zEdgeData);
+
+		const int grain = 1 << 14;
+
+		int nV = graphObj->graph.vertices.size();
+		int nHE = graphObj->graph.halfEdges.size();
+		int nE = graphObj->graph.edges.size();
+
+		// topology - the half edges of an edge are stored as consecutive pairs, so symmetry and edges are implicit
+		zIntArray vertexData(nV);
+		zIntArray halfEdgeData(nHE * 3);
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
 		{
-			vector<double> v_attrib;
+			vertexData[i] = graphObj->graph.vertices[i].getHalfEdge();
+		}, grain);
 
-			v_attrib.push_back(graphObj->graph.vertexPositions[i].x);
-			v_attrib.push_back(graphObj->graph.vertexPositions[i].y);
-			v_attrib.push_back(graphObj->graph.vertexPositions[i].z);
+		zUtilsParallel::forEach(0, nHE, [&](int i)
+		{
+			zHalfEdge &he = graphObj->graph.halfEdges[i];
 
+			halfEdgeData[i * 3 + 0] = he.getPrev();
+			halfEdgeData[i * 3 + 1] = he.getNext();
+			halfEdgeData[i * 3 + 2] = he.getVertex();
+		}, grain);
 
-			v_attrib.push_back(graphObj->graph.vertexColors[i].r);
-			v_attrib.push_back(graphObj->graph.vertexColors[i].g);
-			v_attrib.push_back(graphObj->graph.vertexColors[i].b);
+		zUtilsBinaryWriter writer;
+		writer.addBlock(zBinVertices, vertexData.data(), sizeof(int), nV);
+		writer.addBlock(zBinHalfEdges, halfEdgeData.data(), 3 * sizeof(int), nHE);
 
+		// positions
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
 
+		vector<uint16_t> quantizedPositions;
+		zFloatArray positionDomain;
 
-			graphJSON.vertexAttributes.push_back(v_attrib);
+		if (fileQuantization && nV > 0)
+		{
+			zPoint minBB, maxBB;
+			coreUtils.getBounds(graphObj->graph.vertexPositions, minBB, maxBB);
+
+			positionDomain = { minBB.x, minBB.y, minBB.z, maxBB.x, maxBB.y, maxBB.z };
+			quantizedPositions.resize(nV * 3);
+
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				float* pos = &graphObj->graph.vertexPositions[i].x;
+
+				for (int k = 0; k < 3; k++)
+				{
+					float range = positionDomain[k + 3] - positionDomain[k];
+					float t = (range > 0) ? (pos[k] - positionDomain[k]) / range : 0;
+
+					quantizedPositions[i * 3 + k] = (uint16_t)std::round(t * 65535.0f);
+				}
+			}, grain);
+
+			writer.addBlock(zBinVertexPositionsQuantized, quantizedPositions.data(), 3 * sizeof(uint16_t), nV);
+			writer.addBlock(zBinPositionDomain, positionDomain.data(), 6 * sizeof(float), 1);
 		}
+		else writer.addBlock(zBinVertexPositions, graphObj->graph.vertexPositions.data(), sizeof(zVector), nV);
 
+		// attributes
+		auto packColors = [&](zColorArray &colors, zFloatArray &out)
+		{
+			out.resize(colors.size() * 4);
 
-		// Json file 
-		j["Vertices"] = graphJSON.vertices;
-		j["Halfedges"] = graphJSON.halfedges;
-		j["VertexAttributes"] = graphJSON.vertexAttributes;
-		j["HalfedgeAttributes"] = graphJSON.halfedgeAttributes;
+			zUtilsParallel::forEach(0, colors.size(), [&](int i)
+			{
+				out[i * 4 + 0] = colors[i].r;
+				out[i * 4 + 1] = colors[i].g;
+				out[i * 4 + 2] = colors[i].b;
+				out[i * 4 + 3] = colors[i].a;
+			}, grain);
+		};
 
+		zFloatArray vertexColorData, edgeColorData;
 
-		// export json
+		if ((int)graphObj->graph.vertexColors.size() == nV)
+		{
+			packColors(graphObj->graph.vertexColors, vertexColorData);
+			writer.addBlock(zBinVertexColors, vertexColorData.data(), 4 * sizeof(float), nV);
+		}
 
-		ofstream myfile;
-		myfile.open(outfilename.c_str());
+		if ((int)graphObj->graph.vertexWeights.size() == nV) writer.addBlock(zBinVertexWeights, graphObj->graph.vertexWeights.data(), sizeof(double), nV);
 
-		if (myfile.fail())
+		if ((int)graphObj->graph.edgeColors.size() == nE)
 		{
-			cout << " error in opening file  " << outfilename.c_str() << endl;
-			return;
+			packColors(graphObj->graph.edgeColors, edgeColorData);
+			writer.addBlock(zBinEdgeColors, edgeColorData.data(), 4 * sizeof(float), nE);
 		}
 
-		//myfile.precision(16);
-		myfile << j.dump();
-		myfile.close();
+		if ((int)graphObj->graph.edgeWeights.size() == nE) writer.addBlock(zBinEdgeWeights, graphObj->graph.edgeWeights.data(), sizeof(double), nE);
+
+		if (buffer) return writer.write(*buffer, "ZGRF", 1);
+
+		if (!writer.write(outfilename, "ZGRF", 1))
+		{
+			cout << " error in writing file  " << outfilename.c_str() << endl;
+			return false;
+		}
+
+		cout << endl << " GRAPH exported. File:   " << outfilename.c_str() << endl;
+		return true;
 	}
 
 	//---- PRIVATE METHODS
@@ -58,6 +58,11 @@ namespace zSpace
 			fromJSON(path);
 			setStaticContainers();
 		}
+		else if (type == zGRAPH)
+		{
+			fromGRAPH(path);
+			setStaticContainers();
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -66,6 +71,7 @@ namespace zSpace
 	{
 		if (type == zTXT) toTXT(path);
 		else if (type == zJSON) toJSON(path);
+		else if (type == zGRAPH) toGRAPH(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -382,6 +388,66 @@ namespace zSpace
 		}
 	}
 
+	//---- CACHE METHODS 
+
+	ZSPACE_INLINE bool zFnGraphDynamics::openCache(zUtilsVertexCacheWriter &writer, string path, double quantization, int keyFrameInterval)
+	{
+		zIntArray edgeConnects, counts;
+		getEdgeData(edgeConnects);
+
+		zUtilsVertexCacheHeader header;
+		memset(&header, 0, sizeof(header));
+
+		header.topology = zUtilsVertexCacheHeader::graphTopology;
+		header.numVertices = numVertices();
+		header.keyFrameInterval = (keyFrameInterval > 0) ? keyFrameInterval : 1;
+		header.quantization = quantization;
+
+		return writer.open(path, header, counts, edgeConnects);
+	}
+
+	ZSPACE_INLINE bool zFnGraphDynamics::writeCacheFrame(zUtilsVertexCacheWriter &writer, double time)
+	{
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		if (!writer.isOpen() || (int)writer.getHeader().numVertices != numVertices())
+		{
+			cout << " error: graph does not match the vertex cache writer." << endl;
+			return false;
+		}
+
+		return writer.addFrame((const float*)graphObj->graph.vertexPositions.data(), time);
+	}
+
+	ZSPACE_INLINE bool zFnGraphDynamics::readCacheFrame(zUtilsVertexCacheReader &reader, int frame)
+	{
+		if (!reader.isOpen() || frame < 0 || frame >= reader.numFrames()) return false;
+
+		const zUtilsVertexCacheHeader &header = reader.getHeader();
+
+		if (header.topology != zUtilsVertexCacheHeader::graphTopology)
+		{
+			cout << " error: vertex cache does not hold a graph." << endl;
+			return false;
+		}
+
+		if ((int)header.numVertices == numVertices()) return reader.getFrame(frame, (float*)graphObj->graph.vertexPositions.data());
+
+		zIntArray counts, edgeConnects;
+		reader.getTopology(counts, edgeConnects);
+
+		zPointArray positions(header.numVertices);
+		if (!reader.getFrame(frame, (float*)positions.data())) return false;
+
+		// the particles point to the positions of the previous graph
+		particlesObj.clear();
+
+		zFnGraph::create(positions, edgeConnects);
+		setStaticContainers();
+
+		return true;
+	}
+
 	//---- PRIVATE METHODS
 
 	ZSPACE_INLINE void zFnGraphDynamics::setStaticContainers()
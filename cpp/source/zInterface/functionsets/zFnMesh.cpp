@@ -52,11 +52,20 @@ namespace zSpace
 
 		else if (type == zJSON)
 		{
-			json j;
+			bool chk = fromJSON(path);
+			if (chk && staticGeom) setStaticContainers();
+		}
+
+		else if (type == zMESH)
+		{
+			bool chk = fromMESH(path);
+			if (chk && staticGeom) setStaticContainers();
+		}
 
-			bool chk = json_read(path, j);
-			if(chk) from(j, staticGeom);
-			//if (chk && staticGeom) setStaticContainers();
+		else if (type == zPLY || type == zPLYASCII)
+		{
+			bool chk = fromPLY(path);
+			if (chk && staticGeom) setStaticContainers();
 		}
 
 #if defined ZSPACE_USD_INTEROP
@@ -415,12 +424,10 @@ namespace zSpace
 	ZSPACE_INLINE void zFnMesh::to(string path, zFileTpye type)
 	{
 		if (type == zOBJ) toOBJ(path);
-		else if (type == zJSON)
-		{
-			json j;
-			to(j);
-			bool chk = json_write(path, j);
-		}
+		else if (type == zJSON) toJSON(path);
+		else if (type == zMESH) toMESH(path);
+		else if (type == zPLY) toPLY(path, zPlyBinaryLittleEndian);
+		else if (type == zPLYASCII) toPLY(path, zPlyASCII);
 
 #if defined ZSPACE_USD_INTEROP
 		else if (type == zUSD)
@@ -1286,6 +1293,11 @@ namespace zSpace
 	{
 		meshObj->mesh.faceNormals.clear();
 
+		// per face temporaries are drawn from the thread scratch arena and reused across faces
+		zScratchScope scratch;
+		zScratchIntArray fVerts;
+		zScratchPointArray points;
+
 		for (zItMeshFace f(*meshObj); !f.end(); f++)
 		{
 			if (f.isActive())
@@ -1293,12 +1305,11 @@ namespace zSpace
 				// get face vertices and correspondiing positions
 
 				//printf("\n f %i :", f.getId());
-				vector<int> fVerts;
 				f.getVertices(fVerts);
 
 				zVector fCen; // face center
 
-				vector<zVector> points;
+				points.clear();
 				for (int i = 0; i < fVerts.size(); i++)
 				{
 					//printf(" %i ", fVerts[i]);
@@ -4886,6 +4897,49 @@ namespace zSpace
 		transform = meshObj->transformationMatrix.asMatrix();
 	}
 
+	//---- DATABASE METHODS
+
+	ZSPACE_INLINE bool zFnMesh::to(zDatabase &database, string tableName, int64_t id)
+	{
+		string name = tableName + " : " + to_string(id);
+
+		vector<unsigned char> data;
+		if (!writeMESH(name, &data)) return false;
+
+		zPoint minBB, maxBB;
+		getBounds(minBB, maxBB);
+
+		if (!database.geometryTableCreate(tableName)) return false;
+
+		if (!database.geometryInsert(tableName, id, zMESH, minBB, maxBB, data.data(), data.size()))
+		{
+			cout << " error in writing geometry  " << name.c_str() << endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnMesh::from(zDatabase &database, string tableName, int64_t id, bool staticGeom)
+	{
+		string name = tableName + " : " + to_string(id);
+
+		int type;
+		vector<unsigned char> data;
+		zUtilsBinaryReader reader;
+
+		if (!database.geometrySelect(tableName, id, type, data) || type != zMESH || !reader.open(data.data(), data.size(), "ZMSH", 1))
+		{
+			cout << " error in reading geometry  " << name.c_str() << endl;
+			return false;
+		}
+
+		bool chk = readMESH(reader, name);
+		if (chk && staticGeom) setStaticContainers();
+
+		return chk;
+	}
+
 	//---- PROTECTED TRANSFORM  METHODS
 
 	ZSPACE_INLINE void zFnMesh::transformObject(zTransform &transform)
@@ -4920,11 +4974,32 @@ namespace zSpace
 			return;
 		}
 
+		// the text of contiguous element ranges is formatted in parallel and written in order
+		const int grain = 1 << 14;
+
 		// vertex positions
-		for (auto &vPos : meshObj->mesh.vertexPositions)
+		int nV = meshObj->mesh.vertexPositions.size();
+		vector<zUtilsTextWriter> vWriters(zUtilsParallel::getNumRanges(nV, grain), zUtilsTextWriter(filePrecision));
+
+		zUtilsParallel::forRange(0, nV, [&](int start, int end, int threadId)
 		{
-			myfile << "\n v " << vPos.x << " " << vPos.y << " " << vPos.z;
-		}
+			zUtilsTextWriter &writer = vWriters[threadId];
+			writer.reserve((size_t)(end - start) * (3 * filePrecision + 20));
+
+			for (int i = start; i < end; i++)
+			{
+				zPoint &vPos = meshObj->mesh.vertexPositions[i];
+
+				writer.write("\n v ");
+				writer.write(vPos.x);
+				writer.write(' ');
+				writer.write(vPos.y);
+				writer.write(' ');
+				writer.write(vPos.z);
+			}
+		}, grain);
+
+		for (auto &writer : vWriters) writer.flush(myfile);
 
 		// vertex nornmals
 		/*for (auto &vNorm : meshObj->mesh.vertexNormals)
@@ -4936,20 +5011,33 @@ namespace zSpace
 		myfile << "\n";
 
 		// face connectivity
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
+		int nF = meshObj->mesh.faces.size();
+		vector<zUtilsTextWriter> fWriters(zUtilsParallel::getNumRanges(nF, grain));
+
+		zUtilsParallel::forRange(0, nF, [&](int start, int end, int threadId)
 		{
-			vector<int> fVerts;
-			f.getVertices(fVerts);
+			zUtilsTextWriter &writer = fWriters[threadId];
 
-			myfile << "\n f ";
+			zScratchScope scratch;
+			zScratchIntArray fVerts;
 
-			for (int j = 0; j < fVerts.size(); j++)
+			for (int i = start; i < end; i++)
 			{
-				myfile << fVerts[j] + 1;
+				zItMeshFace f(*meshObj, i);
+				f.getVertices(fVerts);
 
-				if (j != fVerts.size() - 1) myfile << " ";
+				writer.write("\n f ");
+
+				for (int j = 0; j < (int)fVerts.size(); j++)
+				{
+					writer.write(fVerts[j] + 1);
+
+					if (j != (int)fVerts.size() - 1) writer.write(' ');
+				}
 			}
-		}
+		}, grain);
+
+		for (auto &writer : fWriters) writer.flush(myfile);
 
 		myfile.close();
 
@@ -4963,542 +5051,761 @@ namespace zSpace
 		if (numEdges() != meshObj->mesh.edges.size()) garbageCollection(zEdgeData);
 		if (numPolygons() != meshObj->mesh.faces.size())garbageCollection(zFaceData);
 
-		// CREATE JSON FILE
-		zUtilsJsonHE meshJSON;
-		json j;
+		// EXPORT	
+		ofstream myfile;
+		myfile.open(outfilename.c_str());
 
-		// Vertices
-		for (zItMeshVertex v(*meshObj); !v.end(); v++)
+		if (myfile.fail())
 		{
-			if (v.getHalfEdge().isActive()) meshJSON.vertices.push_back(v.getHalfEdge().getId());
-			else meshJSON.vertices.push_back(-1);
+			cout << " error in opening file  " << outfilename.c_str() << endl;
+			return;
 		}
+		else cout << endl << " JSON exported. File:   " << outfilename.c_str() << endl;
 
-		//Edges
-		for (zItMeshHalfEdge he(*meshObj); !he.end(); he++)
-		{
-			vector<int> HE_edges;
-
-			if (he.getPrev().isActive()) HE_edges.push_back(he.getPrev().getId());
-			else HE_edges.push_back(-1);
+		// keys are written in the sorted order of json::dump
+		zUtilsJsonWriter writer(myfile);
+		writer.beginObject();
 
-			if (he.getNext().isActive()) HE_edges.push_back(he.getNext().getId());
-			else HE_edges.push_back(-1);
+		// face Attributes
+		writer.key("FaceAttributes");
+		writer.beginArray();
+		for (int i = 0; i < numPolygons(); i++)
+		{
+			writer.beginArray();
 
-			if (he.getVertex().isActive()) HE_edges.push_back(he.getVertex().getId());
-			else HE_edges.push_back(-1);
+			writer.value((double)meshObj->mesh.faceNormals[i].x);
+			writer.value((double)meshObj->mesh.faceNormals[i].y);
+			writer.value((double)meshObj->mesh.faceNormals[i].z);
 
-			if (!he.onBoundary()) HE_edges.push_back(he.getFace().getId());
-			else HE_edges.push_back(-1);
+			writer.value((double)meshObj->mesh.faceColors[i].r);
+			writer.value((double)meshObj->mesh.faceColors[i].g);
+			writer.value((double)meshObj->mesh.faceColors[i].b);
 
-			meshJSON.halfedges.push_back(HE_edges);
+			writer.endArray();
 		}
+		writer.endArray();
 
 		// Faces
+		writer.key("Faces");
+		writer.beginArray();
 		for (zItMeshFace f(*meshObj); !f.end(); f++)
 		{
-			if (f.getHalfEdge().isActive()) meshJSON.faces.push_back(f.getHalfEdge().getId());
-			else meshJSON.faces.push_back(-1);
+			writer.value((f.getHalfEdge().isActive()) ? f.getHalfEdge().getId() : -1);
 		}
+		writer.endArray();
 
-		// vertex Attributes
-		for (int i = 0; i < meshObj->mesh.vertexPositions.size(); i++)
+		// he Attributes, written once per half edge
+		writer.key("HalfedgeAttributes");
+		writer.beginArray();
+		for (int i = 0; i < numEdges(); i++)
 		{
-			vector<double> v_attrib;
-
-			v_attrib.push_back(meshObj->mesh.vertexPositions[i].x);
-			v_attrib.push_back(meshObj->mesh.vertexPositions[i].y);
-			v_attrib.push_back(meshObj->mesh.vertexPositions[i].z);
-
-			v_attrib.push_back(meshObj->mesh.vertexNormals[i].x);
-			v_attrib.push_back(meshObj->mesh.vertexNormals[i].y);
-			v_attrib.push_back(meshObj->mesh.vertexNormals[i].z);
-
+			for (int k = 0; k < 2; k++)
+			{
+				writer.beginArray();
 
-			v_attrib.push_back(meshObj->mesh.vertexColors[i].r);
-			v_attrib.push_back(meshObj->mesh.vertexColors[i].g);
-			v_attrib.push_back(meshObj->mesh.vertexColors[i].b);
+				writer.value((double)meshObj->mesh.edgeColors[i].r);
+				writer.value((double)meshObj->mesh.edgeColors[i].g);
+				writer.value((double)meshObj->mesh.edgeColors[i].b);
 
-			meshJSON.vertexAttributes.push_back(v_attrib);
+				writer.endArray();
+			}
 		}
+		writer.endArray();
 
-		// face Attributes
-		for (int i = 0; i < numPolygons(); i++)
+		// Halfedges
+		writer.key("Halfedges");
+		writer.beginArray();
+		for (zItMeshHalfEdge he(*meshObj); !he.end(); he++)
 		{
-			vector<double> f_attrib;
-
-			f_attrib.push_back(meshObj->mesh.faceNormals[i].x);
-			f_attrib.push_back(meshObj->mesh.faceNormals[i].y);
-			f_attrib.push_back(meshObj->mesh.faceNormals[i].z);
+			writer.beginArray();
 
-			f_attrib.push_back(meshObj->mesh.faceColors[i].r);
-			f_attrib.push_back(meshObj->mesh.faceColors[i].g);
-			f_attrib.push_back(meshObj->mesh.faceColors[i].b);
+			writer.value((he.getPrev().isActive()) ? he.getPrev().getId() : -1);
+			writer.value((he.getNext().isActive()) ? he.getNext().getId() : -1);
+			writer.value((he.getVertex().isActive()) ? he.getVertex().getId() : -1);
+			writer.value((!he.onBoundary()) ? he.getFace().getId() : -1);
 
-			meshJSON.faceAttributes.push_back(f_attrib);
+			writer.endArray();
 		}
+		writer.endArray();
 
-		// he Attributes
-		for (int i = 0; i < numEdges(); i++)
+		// vertex Attributes
+		writer.key("VertexAttributes");
+		writer.beginArray();
+		for (int i = 0; i < (int)meshObj->mesh.vertexPositions.size(); i++)
 		{
-			vector<double> he_attrib;
-
-			he_attrib.push_back(meshObj->mesh.edgeColors[i].r);
-			he_attrib.push_back(meshObj->mesh.edgeColors[i].g);
-			he_attrib.push_back(meshObj->mesh.edgeColors[i].b);
+			writer.beginArray();
 
-			meshJSON.halfedgeAttributes.push_back(he_attrib);
+			writer.value((double)meshObj->mesh.vertexPositions[i].x);
+			writer.value((double)meshObj->mesh.vertexPositions[i].y);
+			writer.value((double)meshObj->mesh.vertexPositions[i].z);
 
-			meshJSON.halfedgeAttributes.push_back(he_attrib);
-		}
+			writer.value((double)meshObj->mesh.vertexNormals[i].x);
+			writer.value((double)meshObj->mesh.vertexNormals[i].y);
+			writer.value((double)meshObj->mesh.vertexNormals[i].z);
 
-		// Json file 
-		j["Vertices"] = meshJSON.vertices;
-		j["Halfedges"] = meshJSON.halfedges;
-		j["Faces"] = meshJSON.faces;
-		j["VertexAttributes"] = meshJSON.vertexAttributes;
-		j["HalfedgeAttributes"] = meshJSON.halfedgeAttributes;
-		j["FaceAttributes"] = meshJSON.faceAttributes;
+			writer.value((double)meshObj->mesh.vertexColors[i].r);
+			writer.value((double)meshObj->mesh.vertexColors[i].g);
+			writer.value((double)meshObj->mesh.vertexColors[i].b);
 
-		// EXPORT	
-		ofstream myfile;
-		myfile.open(outfilename.c_str());
+			writer.endArray();
+		}
+		writer.endArray();
 
-		if (myfile.fail())
+		// Vertices
+		writer.key("Vertices");
+		writer.beginArray();
+		for (zItMeshVertex v(*meshObj); !v.end(); v++)
 		{
-			cout << " error in opening file  " << outfilename.c_str() << endl;
-			return;
+			writer.value((v.getHalfEdge().isActive()) ? v.getHalfEdge().getId() : -1);
 		}
-		else cout << endl << " JSON exported. File:   " << outfilename.c_str() << endl;
+		writer.endArray();
 
+		writer.endObject();
+		writer.flush();
 
-		//myfile.precision(16);
-		myfile << j.dump();
 		myfile.close();
 	}
 
-	ZSPACE_INLINE bool zFnMesh::fromOBJ(string infilename)
+	ZSPACE_INLINE void zFnMesh::toMESH(string outfilename)
 	{
-		vector<zVector>positions;
-		vector<int>polyConnects;
-		vector<int>polyCounts;
+		writeMESH(outfilename, nullptr);
+	}
+
+	ZSPACE_INLINE bool zFnMesh::writeMESH(string outfilename, vector<unsigned char>* buffer)
+	{
+		// remove inactive elements
+		if (numVertices() != (int)meshObj->mesh.vertices.size()) garbageCollection(zVertexData);
+		if (numEdges() != (int)meshObj->mesh.edges.size()) garbageCollection(zEdgeData);
+		if (numPolygons() != (int)meshObj->mesh.faces.size()) garbageCollection(zFaceData);
 
-		vector<zVector>  vertexNormals;
-		vector<zVector>  faceNormals;
+		const int grain = 1 << 14;
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+		int nV = meshObj->mesh.vertices.size();
+		int nHE = meshObj->mesh.halfEdges.size();
+		int nE = meshObj->mesh.edges.size();
+		int nF = meshObj->mesh.faces.size();
 
-		if (myfile.fail())
+		// topology - the half edges of an edge are stored as consecutive pairs, so symmetry and edges are implicit
+		zIntArray vertexData(nV);
+		zIntArray halfEdgeData(nHE * 4);
+		zIntArray faceData(nF);
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
 		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return false;
-		}
+			vertexData[i] = meshObj->mesh.vertices[i].getHalfEdge();
+		}, grain);
 
-		while (!myfile.eof())
+		zUtilsParallel::forEach(0, nHE, [&](int i)
 		{
-			string str;
-			getline(myfile, str);
+			zHalfEdge &he = meshObj->mesh.halfEdges[i];
 
-			vector<string> perlineData = meshObj->mesh.coreUtils.splitString(str, " ");
+			halfEdgeData[i * 4 + 0] = he.getPrev();
+			halfEdgeData[i * 4 + 1] = he.getNext();
+			halfEdgeData[i * 4 + 2] = he.getVertex();
+			halfEdgeData[i * 4 + 3] = he.getFace();
+		}, grain);
 
-			if (perlineData.size() > 0)
-			{
-				// vertex
-				if (perlineData[0] == "v")
-				{
-					if (perlineData.size() == 4)
-					{
-						zVector pos;
-						pos.x = atof(perlineData[1].c_str());
-						pos.y = atof(perlineData[2].c_str());
-						pos.z = atof(perlineData[3].c_str());
+		zUtilsParallel::forEach(0, nF, [&](int i)
+		{
+			faceData[i] = meshObj->mesh.faces[i].getHalfEdge();
+		}, grain);
 
-						positions.push_back(pos);
-					}
-					//printf("\n working vertex");
-				}
+		zUtilsBinaryWriter writer;
+		writer.addBlock(zBinVertices, vertexData.data(), sizeof(int), nV);
+		writer.addBlock(zBinHalfEdges, halfEdgeData.data(), 4 * sizeof(int), nHE);
+		writer.addBlock(zBinFaces, faceData.data(), sizeof(int), nF);
 
-				// vertex normal
-				if (perlineData[0] == "vn")
+		// positions
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		vector<uint16_t> quantizedPositions;
+		zFloatArray positionDomain;
+
+		if (fileQuantization && nV > 0)
+		{
+			zPoint minBB, maxBB;
+			coreUtils.getBounds(meshObj->mesh.vertexPositions, minBB, maxBB);
+
+			positionDomain = { minBB.x, minBB.y, minBB.z, maxBB.x, maxBB.y, maxBB.z };
+			quantizedPositions.resize(nV * 3);
+
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				float* pos = &meshObj->mesh.vertexPositions[i].x;
+
+				for (int k = 0; k < 3; k++)
 				{
-					//printf("\n working vertex normal ");
-					if (perlineData.size() == 4)
-					{
-						zVector norm;
-						norm.x = atof(perlineData[1].c_str());
-						norm.y = atof(perlineData[2].c_str());
-						norm.z = atof(perlineData[3].c_str());
+					float range = positionDomain[k + 3] - positionDomain[k];
+					float t = (range > 0) ? (pos[k] - positionDomain[k]) / range : 0;
 
-						vertexNormals.push_back(norm);
-					}
-					//printf("\n working vertex");
+					quantizedPositions[i * 3 + k] = (uint16_t)std::round(t * 65535.0f);
 				}
+			}, grain);
 
-				// face
-				if (perlineData[0] == "f")
-				{
-					zVector norm;
+			writer.addBlock(zBinVertexPositionsQuantized, quantizedPositions.data(), 3 * sizeof(uint16_t), nV);
+			writer.addBlock(zBinPositionDomain, positionDomain.data(), 6 * sizeof(float), 1);
+		}
+		else writer.addBlock(zBinVertexPositions, meshObj->mesh.vertexPositions.data(), sizeof(zVector), nV);
 
-					for (int i = 1; i < perlineData.size(); i++)
-					{
-						vector<string> faceData = meshObj->mesh.coreUtils.splitString(perlineData[i], "/");
+		// attributes
+		auto packColors = [&](zColorArray &colors, zFloatArray &out)
+		{
+			out.resize(colors.size() * 4);
 
-						//vector<string> cleanFaceData = splitString(faceData[0], "/\/");
+			zUtilsParallel::forEach(0, colors.size(), [&](int i)
+			{
+				out[i * 4 + 0] = colors[i].r;
+				out[i * 4 + 1] = colors[i].g;
+				out[i * 4 + 2] = colors[i].b;
+				out[i * 4 + 3] = colors[i].a;
+			}, grain);
+		};
 
-						int id = atoi(faceData[0].c_str()) - 1;
-						polyConnects.push_back(id);
+		zFloatArray vertexColorData, edgeColorData, faceColorData;
 
-						//printf(" %i ", id);
+		if ((int)meshObj->mesh.vertexNormals.size() == nV) writer.addBlock(zBinVertexNormals, meshObj->mesh.vertexNormals.data(), sizeof(zVector), nV);
 
-						int normId = atoi(faceData[faceData.size() - 1].c_str()) - 1;
-						norm += vertexNormals[normId];
-					}
+		if ((int)meshObj->mesh.vertexColors.size() == nV)
+		{
+			packColors(meshObj->mesh.vertexColors, vertexColorData);
+			writer.addBlock(zBinVertexColors, vertexColorData.data(), 4 * sizeof(float), nV);
+		}
 
-					norm /= (perlineData.size() - 1);
-					norm.normalize();
-					faceNormals.push_back(norm);
+		if ((int)meshObj->mesh.vertexWeights.size() == nV) writer.addBlock(zBinVertexWeights, meshObj->mesh.vertexWeights.data(), sizeof(double), nV);
 
-					polyCounts.push_back(perlineData.size() - 1);
-					//printf("\n working face ");
-				}
-			}
+		if ((int)meshObj->mesh.edgeColors.size() == nE)
+		{
+			packColors(meshObj->mesh.edgeColors, edgeColorData);
+			writer.addBlock(zBinEdgeColors, edgeColorData.data(), 4 * sizeof(float), nE);
 		}
 
-		myfile.close();
+		if ((int)meshObj->mesh.edgeWeights.size() == nE) writer.addBlock(zBinEdgeWeights, meshObj->mesh.edgeWeights.data(), sizeof(double), nE);
 
-		meshObj->mesh.create(positions, polyCounts, polyConnects);;
-		printf("\n mesh: %i %i %i", numVertices(), numEdges(), numPolygons());
+		if ((int)meshObj->mesh.faceNormals.size() == nF) writer.addBlock(zBinFaceNormals, meshObj->mesh.faceNormals.data(), sizeof(zVector), nF);
+
+		if ((int)meshObj->mesh.faceColors.size() == nF)
+		{
+			packColors(meshObj->mesh.faceColors, faceColorData);
+			writer.addBlock(zBinFaceColors, faceColorData.data(), 4 * sizeof(float), nF);
+		}
 
-		setFaceNormals(faceNormals);
+		if (buffer) return writer.write(*buffer, "ZMSH", 1);
+
+		if (!writer.write(outfilename, "ZMSH", 1))
+		{
+			cout << " error in writing file  " << outfilename.c_str() << endl;
+			return false;
+		}
 
+		cout << endl << " MESH exported. File:   " << outfilename.c_str() << endl;
 		return true;
 	}
 
-	ZSPACE_INLINE bool zFnMesh::fromJSON(string infilename)
+	ZSPACE_INLINE void zFnMesh::toPLY(string outfilename, int format)
 	{
-		json j;
-		zUtilsJsonHE meshJSON;
+		// remove inactive elements
+		if (numVertices() != (int)meshObj->mesh.vertices.size()) garbageCollection(zVertexData);
+		if (numEdges() != (int)meshObj->mesh.edges.size()) garbageCollection(zEdgeData);
+		if (numPolygons() != (int)meshObj->mesh.faces.size()) garbageCollection(zFaceData);
+
+		zIntArray polyConnects, polyCounts;
+		getPolygonData(polyConnects, polyCounts);
+
+		int nV = meshObj->mesh.vertexPositions.size();
+		bool vNormals = (int)meshObj->mesh.vertexNormals.size() == nV;
+		bool vColors = (int)meshObj->mesh.vertexColors.size() == nV;
 
-		ifstream in_myfile;
-		in_myfile.open(infilename.c_str());
+		// columns over the mesh containers
+		const size_t vStride = sizeof(zVector) / sizeof(float);
+		const size_t cStride = sizeof(zColor) / sizeof(float);
 
-		int lineCnt = 0;
+		zUtilsPlyWriter writer;
 
-		if (in_myfile.fail())
+		writer.addElement("vertex", nV);
+
+		if (nV > 0)
 		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
-			return false;
+			writer.addProperty("x", zPlyFloat32, &meshObj->mesh.vertexPositions[0].x, vStride);
+			writer.addProperty("y", zPlyFloat32, &meshObj->mesh.vertexPositions[0].y, vStride);
+			writer.addProperty("z", zPlyFloat32, &meshObj->mesh.vertexPositions[0].z, vStride);
 		}
 
-		in_myfile >> j;
-		in_myfile.close();
+		if (nV > 0 && vNormals)
+		{
+			writer.addProperty("nx", zPlyFloat32, &meshObj->mesh.vertexNormals[0].x, vStride);
+			writer.addProperty("ny", zPlyFloat32, &meshObj->mesh.vertexNormals[0].y, vStride);
+			writer.addProperty("nz", zPlyFloat32, &meshObj->mesh.vertexNormals[0].z, vStride);
+		}
 
-		// READ Data from JSON
+		if (nV > 0 && vColors)
+		{
+			writer.addProperty("red", zPlyUInt8, &meshObj->mesh.vertexColors[0].r, cStride, 255.0f);
+			writer.addProperty("green", zPlyUInt8, &meshObj->mesh.vertexColors[0].g, cStride, 255.0f);
+			writer.addProperty("blue", zPlyUInt8, &meshObj->mesh.vertexColors[0].b, cStride, 255.0f);
+			writer.addProperty("alpha", zPlyUInt8, &meshObj->mesh.vertexColors[0].a, cStride, 255.0f);
+		}
 
-		// Vertices
-		meshJSON.vertices.clear();
-		meshJSON.vertices = (j["Vertices"].get<vector<int>>());
-				
+		writer.addElement("face", polyCounts.size());
+		writer.addListProperty("vertex_indices", zPlyUInt8, zPlyInt32, polyCounts.data(), polyConnects.data());
 
-		//Edges
-		meshJSON.halfedges.clear();
-		meshJSON.halfedges = (j["Halfedges"].get<vector<vector<int>>>());
+		if (!writer.write(outfilename, format, filePrecision))
+		{
+			cout << " error in opening file  " << outfilename.c_str() << endl;
+			return;
+		}
 
-		// Faces
-		meshJSON.faces.clear();
-		meshJSON.faces = (j["Faces"].get<vector<int>>());
+		cout << endl << " PLY exported. File:   " << outfilename.c_str() << endl;
+	}
 
-		// update  mesh
-		meshObj->mesh.clear();
+	ZSPACE_INLINE bool zFnMesh::fromOBJ(string infilename)
+	{
+		zUtilsMappedFile objFile;
 
-		meshObj->mesh.vertices.assign(meshJSON.vertices.size(), zVertex());
-		meshObj->mesh.halfEdges.assign(meshJSON.halfedges.size(), zHalfEdge());
+		if (!objFile.open(infilename))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
 
-		int numE = (int)floor(meshJSON.halfedges.size()*0.5);
-		meshObj->mesh.edges.assign(numE, zEdge());
-		meshObj->mesh.faces.assign(meshJSON.faces.size(), zFace());
+		// per chunk parse results. Negative (relative) indicies are resolved against the chunk local counts, the corners that need the chunk offsets added are stored in relativeConnects / relativeNormals.
+		struct zOBJChunk
+		{
+			zPointArray positions;
+			zVectorArray normals;
+			zIntArray polyCounts;
+			zIntArray polyConnects;
+			zIntArray normalConnects;
+			zIntArray relativeConnects;
+			zIntArray relativeNormals;
+			bool hasNormalConnects = false;
+		};
 
-		meshObj->mesh.vHandles.assign(meshJSON.vertices.size(), zVertexHandle());
-		meshObj->mesh.eHandles.assign(numE, zEdgeHandle());
-		meshObj->mesh.heHandles.assign(meshJSON.halfedges.size(), zHalfEdgeHandle());
-		meshObj->mesh.fHandles.assign(meshJSON.faces.size(), zFaceHandle());
+		int numChunks = (int)(std::min)((size_t)zUtilsParallel::getNumThreads(), objFile.getSize() / (1 << 20) + 1);
 
-		// set IDs
-		for (int i = 0; i < meshJSON.vertices.size(); i++) meshObj->mesh.vertices[i].setId(i);
-		for (int i = 0; i < meshJSON.halfedges.size(); i++) meshObj->mesh.halfEdges[i].setId(i);
-		for (int i = 0; i < meshJSON.faces.size(); i++) meshObj->mesh.faces[i].setId(i);
+		vector<pair<size_t, size_t>> chunkRanges;
+		objFile.getLineChunks(numChunks, chunkRanges);
+		numChunks = (int)chunkRanges.size();
 
-		//printf("\n nV %i | nHE %i | nP %i ", meshJSON.vertices.size(), meshJSON.halfedges.size(), meshJSON.faces.size());
+		vector<zOBJChunk> chunks(numChunks);
 
-		// set Pointers
-		int n_v = 0;
-		for (zItMeshVertex v(*meshObj); !v.end(); v++)
+		zUtilsParallel::forEach(0, numChunks, [&](int c)
 		{
-			v.setId(n_v);
+			zOBJChunk &chunk = chunks[c];
+			zUtilsTextCursor cursor(objFile.getData() + chunkRanges[c].first, objFile.getData() + chunkRanges[c].second);
 
-			if (meshJSON.vertices[n_v] != -1)
+			while (!cursor.atEnd())
 			{
-				zItMeshHalfEdge he(*meshObj, meshJSON.vertices[n_v]);;
-				v.setHalfEdge(he);
+				cursor.skipSpaces();
 
-				meshObj->mesh.vHandles[n_v].id = n_v;
-				meshObj->mesh.vHandles[n_v].he = meshJSON.vertices[n_v];
+				const char* token;
+				size_t length;
+				if (!cursor.readToken(token, length))
+				{
+					cursor.skipLine();
+					continue;
+				}
+
+				// vertex
+				if (length == 1 && token[0] == 'v')
+				{
+					zVector pos;
+					if (cursor.readFloat(pos.x) && cursor.readFloat(pos.y) && cursor.readFloat(pos.z)) chunk.positions.push_back(pos);
+				}
+
+				// vertex normal
+				else if (length == 2 && token[0] == 'v' && token[1] == 'n')
+				{
+					zVector norm;
+					if (cursor.readFloat(norm.x) && cursor.readFloat(norm.y) && cursor.readFloat(norm.z)) chunk.normals.push_back(norm);
+				}
+
+				// face - v, v/vt, v//vn or v/vt/vn per corner
+				else if (length == 1 && token[0] == 'f')
+				{
+					int numCorners = 0;
+
+					while (!cursor.atLineEnd())
+					{
+						int id;
+						if (!cursor.readInt(id)) break;
+
+						if (id < 0)
+						{
+							chunk.relativeConnects.push_back((int)chunk.polyConnects.size());
+							id = (int)chunk.positions.size() + id;
+						}
+						else id -= 1;
+
+						chunk.polyConnects.push_back(id);
+
+						int normId = -1;
+						if (cursor.skipChar('/'))
+						{
+							int texId;
+							cursor.readInt(texId);
+
+							if (cursor.skipChar('/') && cursor.readInt(normId))
+							{
+								if (normId < 0)
+								{
+									chunk.relativeNormals.push_back((int)chunk.normalConnects.size());
+									normId = (int)chunk.normals.size() + normId;
+								}
+								else normId -= 1;
+
+								chunk.hasNormalConnects = true;
+							}
+						}
+
+						chunk.normalConnects.push_back(normId);
+						numCorners++;
+
+						// skip any trailing characters of a malformed corner
+						cursor.skipToken();
+					}
+
+					chunk.polyCounts.push_back(numCorners);
+				}
+
+				cursor.skipLine();
 			}
+		});
 
-			n_v++;
+		objFile.close();
+
+		// chunk offsets
+		zIntArray vOffsets(numChunks + 1, 0), nOffsets(numChunks + 1, 0), fOffsets(numChunks + 1, 0), cOffsets(numChunks + 1, 0);
+		bool hasNormalConnects = false;
+
+		for (int c = 0; c < numChunks; c++)
+		{
+			vOffsets[c + 1] = vOffsets[c] + (int)chunks[c].positions.size();
+			nOffsets[c + 1] = nOffsets[c] + (int)chunks[c].normals.size();
+			fOffsets[c + 1] = fOffsets[c] + (int)chunks[c].polyCounts.size();
+			cOffsets[c + 1] = cOffsets[c] + (int)chunks[c].polyConnects.size();
+
+			hasNormalConnects = hasNormalConnects || chunks[c].hasNormalConnects;
 		}
-		meshObj->mesh.setNumVertices(n_v);
 
-		int n_he = 0;
-		int n_e = 0;
+		// stitch the chunks into the flat arrays of the mesh builder
+		zPointArray positions;
+		zIntArray polyConnects;
+		zIntArray polyCounts;
 
-		for (zItMeshHalfEdge he(*meshObj); !he.end(); he++)
+		zVectorArray vertexNormals;
+		zVectorArray faceNormals;
+
+		positions.resize(vOffsets[numChunks]);
+		vertexNormals.resize(nOffsets[numChunks]);
+		polyCounts.resize(fOffsets[numChunks]);
+		polyConnects.resize(cOffsets[numChunks]);
+
+		zUtilsParallel::forEach(0, numChunks, [&](int c)
 		{
-			// Half Edge
-			he.setId(n_he);
-			meshObj->mesh.heHandles[n_he].id = n_he;
+			zOBJChunk &chunk = chunks[c];
 
-			if (meshJSON.halfedges[n_he][0] != -1)
-			{
-				zItMeshHalfEdge hePrev(*meshObj, meshJSON.halfedges[n_he][0]);
-				he.setPrev(hePrev);
+			// positive ids are file absolute, relative ids need the number of vertices in the preceding chunks
+			for (int i : chunk.relativeConnects) chunk.polyConnects[i] += vOffsets[c];
+			for (int i : chunk.relativeNormals) chunk.normalConnects[i] += nOffsets[c];
 
-				meshObj->mesh.heHandles[n_he].p = meshJSON.halfedges[n_he][0];
-			}
+			std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + vOffsets[c]);
+			std::copy(chunk.normals.begin(), chunk.normals.end(), vertexNormals.begin() + nOffsets[c]);
+			std::copy(chunk.polyCounts.begin(), chunk.polyCounts.end(), polyCounts.begin() + fOffsets[c]);
+			std::copy(chunk.polyConnects.begin(), chunk.polyConnects.end(), polyConnects.begin() + cOffsets[c]);
 
-			if (meshJSON.halfedges[n_he][1] != -1)
-			{				
-				zItMeshHalfEdge heNext(*meshObj, meshJSON.halfedges[n_he][1]);
-				he.setNext(heNext);
+			zPointArray().swap(chunk.positions);
+			zVectorArray().swap(chunk.normals);
+			zIntArray().swap(chunk.polyConnects);
+		});
 
-				meshObj->mesh.heHandles[n_he].n = meshJSON.halfedges[n_he][1];
-			}
+		bool validIds = true;
+		for (int i = 0; i < (int)polyConnects.size() && validIds; i++) validIds = (polyConnects[i] >= 0 && polyConnects[i] < (int)positions.size());
 
-			if (meshJSON.halfedges[n_he][2] != -1)
-			{
-				zItMeshVertex v(*meshObj, meshJSON.halfedges[n_he][2]);
-				he.setVertex(v);								
+		if (!validIds)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : face vertex index out of range." << endl;
+			return false;
+		}
 
-				meshObj->mesh.heHandles[n_he].v = meshJSON.halfedges[n_he][2];
-			}
+		// face normals as the average of the corner normals
+		bool validNormals = hasNormalConnects;
 
-			if (meshJSON.halfedges[n_he][3] != -1)
+		if (hasNormalConnects)
+		{
+			faceNormals.resize(polyCounts.size());
+			vector<char> faceValid(numChunks, 1);
+
+			zUtilsParallel::forEach(0, numChunks, [&](int c)
 			{
-				zItMeshFace f(*meshObj, meshJSON.halfedges[n_he][3]);
-				he.setFace(f);
+				zOBJChunk &chunk = chunks[c];
 
-				meshObj->mesh.heHandles[n_he].f = meshJSON.halfedges[n_he][3];
-			}
+				int corner = 0;
+				for (int f = 0; f < (int)chunk.polyCounts.size(); f++)
+				{
+					zVector norm;
 
-			// symmetry half edges && Edge
-			if (n_he % 2 == 1)
-			{
-				zItMeshHalfEdge heSym(*meshObj, n_he - 1);
-				he.setSym(heSym);
+					for (int k = 0; k < chunk.polyCounts[f]; k++, corner++)
+					{
+						int normId = chunk.normalConnects[corner];
 
-				zItMeshEdge e(*meshObj, n_e);
-				e.setId(n_e);
+						if (normId < 0 || normId >= (int)vertexNormals.size()) faceValid[c] = 0;
+						else norm += vertexNormals[normId];
+					}
 
-				e.setHalfEdge(heSym, 0);
-				e.setHalfEdge(he, 1);
+					if (chunk.polyCounts[f] > 0) norm /= chunk.polyCounts[f];
+					norm.normalize();
+					faceNormals[fOffsets[c] + f] = norm;
+				}
+			});
 
-				he.setEdge(e);
-				heSym.setEdge(e);
+			for (int c = 0; c < numChunks; c++) validNormals = validNormals && faceValid[c];
+		}
 
-				meshObj->mesh.heHandles[n_he].e = n_e;
-				meshObj->mesh.heHandles[n_he - 1].e = n_e;
+		chunks.clear();
 
-				meshObj->mesh.eHandles[n_e].id = n_e;
-				meshObj->mesh.eHandles[n_e].he0 = n_he - 1;
-				meshObj->mesh.eHandles[n_e].he1 = n_he;
+		meshObj->mesh.create(positions, polyCounts, polyConnects);;
+		printf("\n mesh: %i %i %i", numVertices(), numEdges(), numPolygons());
 
-				n_e++;
-			}
+		if (validNormals) setFaceNormals(faceNormals);
+		else computeMeshNormals();
 
-			n_he++;
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnMesh::fromJSON(string infilename)
+	{
+		zUtilsJsonHEReader reader;
+
+		if (!reader.read(infilename))
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : " << reader.getError() << endl;
+			return false;
 		}
 
-		meshObj->mesh.setNumEdges(n_e);
+		const int grain = 1 << 14;
 
-		int n_f = 0;
+		int nV = (int)reader.vertices.size();
+		int nF = (int)reader.faces.size();
+		int nHE = (reader.halfedgeStride == 4) ? (int)reader.halfedges.size() / 4 : 0;
 
-		for (zItMeshFace f(*meshObj); !f.end(); f++)
-		{
-			f.setId(n_f);
+		// vertex rows hold position and normal, followed by color (9), thickness data (8) or color and thickness data (15)
+		int vStride = reader.vertexAttributeStride;
 
-			if (meshJSON.vertices[n_f] != -1)
-			{
-				zItMeshHalfEdge he(*meshObj, meshJSON.faces[n_f]);
-				f.setHalfEdge(he);
+		bool valid = (reader.halfedgeStride == 4 || reader.halfedges.empty());
+		valid = valid && (vStride == 6 || vStride == 8 || vStride == 9 || vStride == 15 || nV == 0);
+		valid = valid && (nV == 0 || (int)reader.vertexAttributes.size() == nV * vStride);
 
-				meshObj->mesh.fHandles[n_f].id = n_f;
-				meshObj->mesh.fHandles[n_f].he = meshJSON.faces[n_f];
-			}
+		if (valid) valid = setHalfEdgeTopology(reader.vertices.data(), nV, reader.halfedges.data(), nHE, reader.faces.data(), nF);
 
-			n_f++;
+		if (!valid)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete mesh data." << endl;
+			return false;
 		}
-		meshObj->mesh.setNumPolygons(n_f);
 
-		//// Vertex Attributes
-		meshJSON.vertexAttributes = j["VertexAttributes"].get<vector<vector<double>>>();
-		//printf("\n vertexAttributes: %zi %zi", vertexAttributes.size(), vertexAttributes[0].size());
+		int nE = nHE / 2;
 
-		meshObj->mesh.vertexPositions.clear();
-		meshObj->mesh.vertexNormals.clear();
-		meshObj->mesh.vertexColors.clear();
-		meshObj->mesh.vertexWeights.clear();
-		for (int i = 0; i < meshJSON.vertexAttributes.size(); i++)
+		// vertex attributes
+		const double* vData = reader.vertexAttributes.data();
+		bool vColors = (vStride == 9 || vStride == 15);
+
+		meshObj->mesh.vertexPositions.resize(nV);
+		meshObj->mesh.vertexNormals.resize(nV);
+		meshObj->mesh.vertexColors.resize(nV);
+		meshObj->mesh.vertexWeights.assign(nV, 2.0);
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
 		{
-			for (int k = 0; k < meshJSON.vertexAttributes[i].size(); k++)
-			{
-				// position, normal and color
+			const double* row = vData + (size_t)i * vStride;
 
-				if (meshJSON.vertexAttributes[i].size() == 9)
-				{
-					zVector pos(meshJSON.vertexAttributes[i][k], meshJSON.vertexAttributes[i][k + 1], meshJSON.vertexAttributes[i][k + 2]);
-					meshObj->mesh.vertexPositions.push_back(pos);
+			meshObj->mesh.vertexPositions[i] = zVector(row[0], row[1], row[2]);
+			meshObj->mesh.vertexNormals[i] = zVector(row[3], row[4], row[5]);
+			meshObj->mesh.vertexColors[i] = (vColors) ? zColor(row[6], row[7], row[8], 1) : zColor(1, 0, 0, 1);
+		}, grain);
 
-					zVector normal(meshJSON.vertexAttributes[i][k + 3], meshJSON.vertexAttributes[i][k + 4], meshJSON.vertexAttributes[i][k + 5]);
-					meshObj->mesh.vertexNormals.push_back(normal);
+		// edge attributes, the half edge attributes are not read
+		meshObj->mesh.edgeColors.assign(nE, zColor());
+		meshObj->mesh.edgeWeights.assign(nE, 1.0);
 
-					zColor col(meshJSON.vertexAttributes[i][k + 6], meshJSON.vertexAttributes[i][k + 7], meshJSON.vertexAttributes[i][k + 8], 1);
-					meshObj->mesh.vertexColors.push_back(col);
+		// face attributes
+		int fStride = reader.faceAttributeStride;
 
-					meshObj->mesh.vertexWeights.push_back(2.0);
+		if (nF > 0 && (fStride == 3 || fStride == 6) && (int)reader.faceAttributes.size() == nF * fStride)
+		{
+			const double* fData = reader.faceAttributes.data();
 
-					k += 8;
-				}				
+			meshObj->mesh.faceNormals.resize(nF);
+			meshObj->mesh.faceColors.resize(nF);
 
-				// position, normal
-				if (meshJSON.vertexAttributes[i].size() == 6)
-				{
-					zVector pos(meshJSON.vertexAttributes[i][k], meshJSON.vertexAttributes[i][k + 1], meshJSON.vertexAttributes[i][k + 2]);
-					meshObj->mesh.vertexPositions.push_back(pos);
+			zUtilsParallel::forEach(0, nF, [&](int i)
+			{
+				const double* row = fData + (size_t)i * fStride;
 
-					zVector normal(meshJSON.vertexAttributes[i][k + 3], meshJSON.vertexAttributes[i][k + 4], meshJSON.vertexAttributes[i][k + 5]);
-					meshObj->mesh.vertexNormals.push_back(normal);
+				meshObj->mesh.faceNormals[i] = zVector(row[0], row[1], row[2]);
+				meshObj->mesh.faceColors[i] = (fStride == 6) ? zColor(row[3], row[4], row[5], 1) : zColor(0.5, 0.5, 0.5, 1);
+			}, grain);
+		}
+		else
+		{
+			computeMeshNormals();
+			setFaceColor(zColor(0.5, 0.5, 0.5, 1));
+		}
 
-					meshObj->mesh.vertexColors.push_back(zColor(1,0,0,1));
+		reader.clear();
 
-					meshObj->mesh.vertexWeights.push_back(2.0);
+		// add to maps 
+		meshObj->mesh.positionVertex.reserve(nV);
+		meshObj->mesh.existingHalfEdges.reserve(nHE);
 
-					k += 5;
-				}
+		for (int i = 0; i < (int)meshObj->mesh.vertexPositions.size(); i++)
+		{
+			meshObj->mesh.addToPositionMap(meshObj->mesh.vertexPositions[i], i);
+		}
 
-				// BRG position, normal and color, thickness
-				if (meshJSON.vertexAttributes[i].size() == 15)
-				{
-					zVector pos(meshJSON.vertexAttributes[i][k], meshJSON.vertexAttributes[i][k + 1], meshJSON.vertexAttributes[i][k + 2]);
-					meshObj->mesh.vertexPositions.push_back(pos);
+		for (zItMeshEdge e(*meshObj); !e.end(); e++)
+		{
+			int v1 = e.getHalfEdge(0).getVertex().getId();
+			int v2 = e.getHalfEdge(1).getVertex().getId();
 
-					zVector normal(meshJSON.vertexAttributes[i][k + 3], meshJSON.vertexAttributes[i][k + 4], meshJSON.vertexAttributes[i][k + 5]);
-					meshObj->mesh.vertexNormals.push_back(normal);
+			meshObj->mesh.addToHalfEdgesMap(v1, v2, e.getHalfEdge(0).getId());
+		}
 
-					zColor col(meshJSON.vertexAttributes[i][k + 6], meshJSON.vertexAttributes[i][k + 7], meshJSON.vertexAttributes[i][k + 8], 1);
-					meshObj->mesh.vertexColors.push_back(col);
+		printf("\n mesh: %i %i %i ", numVertices(), numEdges(), numPolygons());
 
-					meshObj->mesh.vertexWeights.push_back(2.0);
+		return true;
+	}
 
-					k += 14;
-				}
+	ZSPACE_INLINE bool zFnMesh::fromMESH(string infilename)
+	{
+		zUtilsBinaryReader reader;
 
+		if (!reader.open(infilename, "ZMSH", 1))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
 
-				// position, normal
-				if (meshJSON.vertexAttributes[i].size() == 8)
-				{
-					zVector pos(meshJSON.vertexAttributes[i][k], meshJSON.vertexAttributes[i][k + 1], meshJSON.vertexAttributes[i][k + 2]);
-					meshObj->mesh.vertexPositions.push_back(pos);
+		return readMESH(reader, infilename);
+	}
 
-					zVector normal(meshJSON.vertexAttributes[i][k + 3], meshJSON.vertexAttributes[i][k + 4], meshJSON.vertexAttributes[i][k + 5]);
-					meshObj->mesh.vertexNormals.push_back(normal);
+	ZSPACE_INLINE bool zFnMesh::readMESH(zUtilsBinaryReader &reader, string infilename)
+	{
+		const int grain = 1 << 14;
 
-					meshObj->mesh.vertexColors.push_back(zColor(1, 0, 0, 1));
+		// topology
+		size_t nV = 0, nHE = 0, nF = 0;
+		const int* vertexData = (const int*)reader.getBlock(zBinVertices, sizeof(int), nV);
+		const int* halfEdgeData = (const int*)reader.getBlock(zBinHalfEdges, 4 * sizeof(int), nHE);
+		const int* faceData = (const int*)reader.getBlock(zBinFaces, sizeof(int), nF);
 
-					meshObj->mesh.vertexWeights.push_back(2.0);
+		// positions
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
 
-					k += 7;
-				}
-								
-			}
+		size_t nP = 0, nD = 0;
+		const float* positionData = (const float*)reader.getBlock(zBinVertexPositions, sizeof(zVector), nP);
+		const uint16_t* quantizedData = nullptr;
+		const float* positionDomain = nullptr;
+
+		if (positionData == nullptr)
+		{
+			quantizedData = (const uint16_t*)reader.getBlock(zBinVertexPositionsQuantized, 3 * sizeof(uint16_t), nP);
+			positionDomain = (const float*)reader.getBlock(zBinPositionDomain, 6 * sizeof(float), nD);
 		}
 
-		// Edge Attributes
-		//meshJSON.halfedgeAttributes = j["HalfedgeAttributes"].get<vector<vector<double>>>();
+		bool valid = vertexData != nullptr && halfEdgeData != nullptr && faceData != nullptr && nHE % 2 == 0 && nP == nV;
+		valid = valid && (positionData != nullptr || (quantizedData != nullptr && positionDomain != nullptr && nD == 1));
 
-		meshObj->mesh.edgeColors.clear();
-		meshObj->mesh.edgeWeights.clear();
-		if (meshJSON.halfedgeAttributes.size() == 0)
+		if (valid) valid = setHalfEdgeTopology(vertexData, nV, halfEdgeData, nHE, faceData, nF);
+
+		if (!valid)
 		{
-			for (int i = 0; i < meshObj->mesh.n_e; i++)
-			{
-				meshObj->mesh.edgeColors.push_back(zColor());
-				meshObj->mesh.edgeWeights.push_back(1.0);
-			}
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete mesh data." << endl;
+			return false;
+		}
+
+		int nE = nHE / 2;
+
+		// vertex attributes
+		meshObj->mesh.vertexPositions.resize(nV);
+
+		if (positionData != nullptr)
+		{
+			if (nV > 0) memcpy(&meshObj->mesh.vertexPositions[0].x, positionData, nV * sizeof(zVector));
 		}
 		else
 		{
-
-			/*for (int i = 0; i < meshObj->mesh.n_e; i++)
+			zUtilsParallel::forEach(0, nV, [&](int i)
 			{
-				meshObj->mesh.edgeColors.push_back(zColor());
-				meshObj->mesh.edgeWeights.push_back(1.0);
-			}*/
+				float* pos = &meshObj->mesh.vertexPositions[i].x;
 
-			for (int i = 0; i < meshJSON.halfedgeAttributes.size(); i += 2)
-			{
-				// color
-				if (meshJSON.halfedgeAttributes[i].size() == 3)
+				for (int k = 0; k < 3; k++)
 				{
-					zColor col(meshJSON.halfedgeAttributes[i][0], meshJSON.halfedgeAttributes[i][1], meshJSON.halfedgeAttributes[i][2], 1);
+					pos[k] = positionDomain[k] + (positionDomain[k + 3] - positionDomain[k]) * (quantizedData[i * 3 + k] / 65535.0f);
+				}
+			}, grain);
+		}
 
-					meshObj->mesh.edgeColors.push_back(col);
-					meshObj->mesh.edgeWeights.push_back(1.0);
+		auto unpackColors = [&](int type, size_t n, zColorArray &colors, zColor defaultColor)
+		{
+			size_t count = 0;
+			const float* colorData = (const float*)reader.getBlock(type, 4 * sizeof(float), count);
 
-				}				
+			if (colorData == nullptr || count != n)
+			{
+				colors.assign(n, defaultColor);
+				return;
 			}
-		}
 
-		// face Attributes
-		meshJSON.faceAttributes = j["FaceAttributes"].get<vector<vector<double>>>();
+			colors.resize(n);
 
-		meshObj->mesh.faceColors.clear();
-		meshObj->mesh.faceNormals.clear();
-		for (int i = 0; i < meshJSON.faceAttributes.size(); i++)
-		{
-			for (int k = 0; k < meshJSON.faceAttributes[i].size(); k++)
+			zUtilsParallel::forEach(0, n, [&](int i)
 			{
-				// normal and color
-				if (meshJSON.faceAttributes[i].size() == 6)
-				{
-					zColor col(meshJSON.faceAttributes[i][k + 3], meshJSON.faceAttributes[i][k + 4], meshJSON.faceAttributes[i][k + 5], 1);
-					meshObj->mesh.faceColors.push_back(col);
+				colors[i] = zColor(colorData[i * 4 + 0], colorData[i * 4 + 1], colorData[i * 4 + 2], colorData[i * 4 + 3]);
+			}, grain);
+		};
 
-					zVector normal(meshJSON.faceAttributes[i][k], meshJSON.faceAttributes[i][k + 1], meshJSON.faceAttributes[i][k + 2]);
-					meshObj->mesh.faceNormals.push_back(normal);
+		auto copyWeights = [&](int type, size_t n, zDoubleArray &weights, double defaultWeight)
+		{
+			size_t count = 0;
+			const double* weightData = (const double*)reader.getBlock(type, sizeof(double), count);
 
-					k += 5;
-				}
+			if (weightData != nullptr && count == n) weights.assign(weightData, weightData + n);
+			else weights.assign(n, defaultWeight);
+		};
 
-				if (meshJSON.faceAttributes[i].size() == 3)
-				{
-					zVector normal(meshJSON.faceAttributes[i][k], meshJSON.faceAttributes[i][k + 1], meshJSON.faceAttributes[i][k + 2]);
-					meshObj->mesh.faceNormals.push_back(normal);
+		auto copyVectors = [&](int type, size_t n, zVectorArray &vectors)
+		{
+			size_t count = 0;
+			const zVector* vectorData = (const zVector*)reader.getBlock(type, sizeof(zVector), count);
 
-					meshObj->mesh.faceColors.push_back(zColor(0.5, 0.5, 0.5, 1));
+			if (vectorData == nullptr || count != n) return false;
 
-					k += 2;
-				}
-			}
-		}
+			vectors.resize(n);
+			if (n > 0) memcpy(&vectors[0].x, vectorData, n * sizeof(zVector));
 
-		if (meshJSON.faceAttributes.size() == 0)
-		{
-			computeMeshNormals();
-			setFaceColor(zColor(0.5, 0.5, 0.5, 1));
-		}
+			return true;
+		};
+
+		bool validNormals = copyVectors(zBinVertexNormals, nV, meshObj->mesh.vertexNormals);
+		unpackColors(zBinVertexColors, nV, meshObj->mesh.vertexColors, zColor(1, 0, 0, 1));
+		copyWeights(zBinVertexWeights, nV, meshObj->mesh.vertexWeights, 2.0);
+
+		// edge attributes
+		unpackColors(zBinEdgeColors, nE, meshObj->mesh.edgeColors, zColor());
+		copyWeights(zBinEdgeWeights, nE, meshObj->mesh.edgeWeights, 1.0);
+
+		// face attributes
+		validNormals = copyVectors(zBinFaceNormals, nF, meshObj->mesh.faceNormals) && validNormals;
+		unpackColors(zBinFaceColors, nF, meshObj->mesh.faceColors, zColor(0.5, 0.5, 0.5, 1));
+
+		reader.close();
+
+		if (!validNormals) computeMeshNormals();
 
 		// add to maps 
+		meshObj->mesh.positionVertex.reserve(nV);
+		meshObj->mesh.existingHalfEdges.reserve(nHE);
+
 		for (int i = 0; i < meshObj->mesh.vertexPositions.size(); i++)
 		{
 			meshObj->mesh.addToPositionMap(meshObj->mesh.vertexPositions[i], i);
@@ -5517,6 +5824,203 @@ namespace zSpace
 		return true;
 	}
 
+	ZSPACE_INLINE bool zFnMesh::fromPLY(string infilename)
+	{
+		zUtilsPlyReader reader;
+
+		if (!reader.open(infilename))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		zUtilsPlyElement* vertex = reader.getElement("vertex");
+		zUtilsPlyElement* face = reader.getElement("face");
+
+		if (vertex == nullptr)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : no vertex element." << endl;
+			return false;
+		}
+
+		const int grain = 1 << 14;
+		const size_t vStride = sizeof(zVector) / sizeof(float);
+		const size_t cStride = sizeof(zColor) / sizeof(float);
+
+		int nV = (int)vertex->count;
+
+		// positions
+		zPointArray positions;
+		positions.resize(nV);
+
+		bool valid = true;
+
+		if (nV > 0)
+		{
+			valid = reader.readProperty(*vertex, "x", &positions[0].x, vStride);
+			valid = valid && reader.readProperty(*vertex, "y", &positions[0].y, vStride);
+			valid = valid && reader.readProperty(*vertex, "z", &positions[0].z, vStride);
+		}
+
+		// faces
+		zIntArray polyCounts, polyConnects;
+
+		if (valid && face != nullptr)
+		{
+			valid = reader.readList(*face, "vertex_indices", polyCounts, polyConnects) || reader.readList(*face, "vertex_index", polyCounts, polyConnects);
+		}
+
+		bool validIds = true;
+		for (int i = 0; i < (int)polyConnects.size() && validIds; i++) validIds = (polyConnects[i] >= 0 && polyConnects[i] < nV);
+
+		if (!valid || !validIds)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete mesh data." << endl;
+			return false;
+		}
+
+		meshObj->mesh.create(positions, polyCounts, polyConnects);
+		printf("\n mesh: %i %i %i", numVertices(), numEdges(), numPolygons());
+
+		computeMeshNormals();
+
+		if (nV == 0 || numVertices() != nV) return true;
+
+		// vertex normals
+		if (reader.hasProperty(*vertex, "nx") && reader.hasProperty(*vertex, "ny") && reader.hasProperty(*vertex, "nz"))
+		{
+			meshObj->mesh.vertexNormals.resize(nV);
+
+			reader.readProperty(*vertex, "nx", &meshObj->mesh.vertexNormals[0].x, vStride);
+			reader.readProperty(*vertex, "ny", &meshObj->mesh.vertexNormals[0].y, vStride);
+			reader.readProperty(*vertex, "nz", &meshObj->mesh.vertexNormals[0].z, vStride);
+		}
+
+		// vertex colors
+		if (reader.hasProperty(*vertex, "red") && reader.hasProperty(*vertex, "green") && reader.hasProperty(*vertex, "blue"))
+		{
+			meshObj->mesh.vertexColors.assign(nV, zColor(0, 0, 0, 1));
+
+			reader.readProperty(*vertex, "red", &meshObj->mesh.vertexColors[0].r, cStride, true);
+			reader.readProperty(*vertex, "green", &meshObj->mesh.vertexColors[0].g, cStride, true);
+			reader.readProperty(*vertex, "blue", &meshObj->mesh.vertexColors[0].b, cStride, true);
+			reader.readProperty(*vertex, "alpha", &meshObj->mesh.vertexColors[0].a, cStride, true);
+
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				meshObj->mesh.vertexColors[i].toHSV();
+			}, grain);
+		}
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnMesh::setHalfEdgeTopology(const int* vertexData, int nV, const int* halfEdgeData, int nHE, const int* faceData, int nF)
+	{
+		if (nV < 0 || nHE < 0 || nF < 0 || nHE % 2 != 0) return false;
+
+		const int grain = 1 << 14;
+
+		// indicies need to be in range, as they are used unchecked by the iterators
+		vector<char> rangeValid(zUtilsParallel::getNumThreads(), 1);
+
+		auto inRange = [](int id, int n) { return id >= -1 && id < n; };
+
+		zUtilsParallel::forRange(0, nHE, [&](int start, int end, int threadId)
+		{
+			for (int i = start; i < end; i++)
+			{
+				if (!inRange(halfEdgeData[i * 4 + 0], nHE) || !inRange(halfEdgeData[i * 4 + 1], nHE) || !inRange(halfEdgeData[i * 4 + 2], nV) || !inRange(halfEdgeData[i * 4 + 3], nF)) rangeValid[threadId] = 0;
+			}
+		}, grain);
+
+		bool valid = true;
+		for (int i = 0; i < nV; i++) valid = valid && inRange(vertexData[i], nHE);
+		for (int i = 0; i < nF; i++) valid = valid && inRange(faceData[i], nHE);
+		for (char c : rangeValid) valid = valid && c;
+
+		if (!valid) return false;
+
+		int nE = nHE / 2;
+
+		// update mesh
+		meshObj->mesh.clear();
+
+		meshObj->mesh.vertices.assign(nV, zVertex());
+		meshObj->mesh.halfEdges.assign(nHE, zHalfEdge());
+		meshObj->mesh.edges.assign(nE, zEdge());
+		meshObj->mesh.faces.assign(nF, zFace());
+
+		meshObj->mesh.vHandles.assign(nV, zVertexHandle());
+		meshObj->mesh.eHandles.assign(nE, zEdgeHandle());
+		meshObj->mesh.heHandles.assign(nHE, zHalfEdgeHandle());
+		meshObj->mesh.fHandles.assign(nF, zFaceHandle());
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
+		{
+			meshObj->mesh.vertices[i].setId(i);
+
+			if (vertexData[i] != -1)
+			{
+				meshObj->mesh.vertices[i].setHalfEdge(vertexData[i]);
+
+				meshObj->mesh.vHandles[i].id = i;
+				meshObj->mesh.vHandles[i].he = vertexData[i];
+			}
+		}, grain);
+
+		zUtilsParallel::forEach(0, nHE, [&](int i)
+		{
+			zHalfEdge &he = meshObj->mesh.halfEdges[i];
+			zHalfEdgeHandle &heHandle = meshObj->mesh.heHandles[i];
+
+			he.setId(i);
+			he.setPrev(halfEdgeData[i * 4 + 0]);
+			he.setNext(halfEdgeData[i * 4 + 1]);
+			he.setVertex(halfEdgeData[i * 4 + 2]);
+			he.setFace(halfEdgeData[i * 4 + 3]);
+			he.setSym(i ^ 1);
+			he.setEdge(i / 2);
+
+			heHandle.id = i;
+			heHandle.p = halfEdgeData[i * 4 + 0];
+			heHandle.n = halfEdgeData[i * 4 + 1];
+			heHandle.v = halfEdgeData[i * 4 + 2];
+			heHandle.f = halfEdgeData[i * 4 + 3];
+			heHandle.e = i / 2;
+		}, grain);
+
+		zUtilsParallel::forEach(0, nE, [&](int i)
+		{
+			meshObj->mesh.edges[i].setId(i);
+			meshObj->mesh.edges[i].setHalfEdge(i * 2, 0);
+			meshObj->mesh.edges[i].setHalfEdge(i * 2 + 1, 1);
+
+			meshObj->mesh.eHandles[i].id = i;
+			meshObj->mesh.eHandles[i].he0 = i * 2;
+			meshObj->mesh.eHandles[i].he1 = i * 2 + 1;
+		}, grain);
+
+		zUtilsParallel::forEach(0, nF, [&](int i)
+		{
+			meshObj->mesh.faces[i].setId(i);
+
+			if (faceData[i] != -1)
+			{
+				meshObj->mesh.faces[i].setHalfEdge(faceData[i]);
+
+				meshObj->mesh.fHandles[i].id = i;
+				meshObj->mesh.fHandles[i].he = faceData[i];
+			}
+		}, grain);
+
+		meshObj->mesh.setNumVertices(nV);
+		meshObj->mesh.setNumEdges(nE);
+		meshObj->mesh.setNumPolygons(nF);
+
+		return true;
+	}
+
 	//---- PROTECTED CONTOUR METHODS
 
 	ZSPACE_INLINE int zFnMesh::getIsolineCase_triangle(bool vertexBinary[3])
@@ -48,6 +48,7 @@ namespace zSpace
 	{
 		if (type == zOBJ) fromOBJ(path);
 		else if (type == zJSON) fromJSON(path);
+		else if (type == zMESH) fromMESH(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -56,6 +57,7 @@ namespace zSpace
 	{
 		if (type == zOBJ) toOBJ(path);
 		else if (type == zJSON) toJSON(path);
+		else if (type == zMESH) toMESH(path);
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -276,6 +278,10 @@ namespace zSpace
 		zUtilsCore core;
 		zPoint* vPositions = getRawVertexPositions();
 
+		// face vertex indicies are drawn from the thread scratch arena and reused across faces
+		zScratchScope scratch;
+		zScratchIntArray fVerts;
+
 		if (planarityDeviations.size() != numPolygons())
 		{
 			planarityDeviations.clear();
@@ -293,7 +299,6 @@ namespace zSpace
 
 				int fID = f.getId();				
 
-				zIntArray fVerts;
 				f.getVertices(fVerts);
 
 				if (fVerts.size() == 3) planarityDeviations[fID] = 0;
@@ -352,7 +357,6 @@ namespace zSpace
 			{
 				int fID = f.getId();
 
-				zIntArray fVerts;
 				f.getVertices(fVerts);
 
 				zIntArray fTris;
@@ -931,4 +935,70 @@ namespace zSpace
 		computeMeshNormals();
 	}
 
+	//---- CACHE METHODS 
+
+	ZSPACE_INLINE bool zFnMeshDynamics::openCache(zUtilsVertexCacheWriter &writer, string path, double quantization, int keyFrameInterval)
+	{
+		zIntArray polyConnects, polyCounts;
+		getPolygonData(polyConnects, polyCounts);
+
+		zUtilsVertexCacheHeader header;
+		memset(&header, 0, sizeof(header));
+
+		header.topology = zUtilsVertexCacheHeader::meshTopology;
+		header.numVertices = numVertices();
+		header.keyFrameInterval = (keyFrameInterval > 0) ? keyFrameInterval : 1;
+		header.quantization = quantization;
+
+		return writer.open(path, header, polyCounts, polyConnects);
+	}
+
+	ZSPACE_INLINE bool zFnMeshDynamics::writeCacheFrame(zUtilsVertexCacheWriter &writer, double time)
+	{
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		if (!writer.isOpen() || (int)writer.getHeader().numVertices != numVertices())
+		{
+			cout << " error: mesh does not match the vertex cache writer." << endl;
+			return false;
+		}
+
+		return writer.addFrame((const float*)meshObj->mesh.vertexPositions.data(), time);
+	}
+
+	ZSPACE_INLINE bool zFnMeshDynamics::readCacheFrame(zUtilsVertexCacheReader &reader, int frame)
+	{
+		if (!reader.isOpen() || frame < 0 || frame >= reader.numFrames()) return false;
+
+		const zUtilsVertexCacheHeader &header = reader.getHeader();
+
+		if (header.topology != zUtilsVertexCacheHeader::meshTopology)
+		{
+			cout << " error: vertex cache does not hold a mesh." << endl;
+			return false;
+		}
+
+		if ((int)header.numVertices == numVertices())
+		{
+			if (!reader.getFrame(frame, (float*)meshObj->mesh.vertexPositions.data())) return false;
+		}
+		else
+		{
+			zIntArray polyCounts, polyConnects;
+			reader.getTopology(polyCounts, polyConnects);
+
+			zPointArray positions(header.numVertices);
+			if (!reader.getFrame(frame, (float*)positions.data())) return false;
+
+			// the particles point to the positions of the previous mesh
+			particlesObj.clear();
+
+			zFnMesh::create(positions, polyCounts, polyConnects);
+		}
+
+		computeMeshNormals();
+
+		return true;
+	}
+
 }
\ No newline at end of file
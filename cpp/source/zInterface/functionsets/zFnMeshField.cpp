@@ -63,6 +63,11 @@ namespace zSpace
 
 		else if (type == zOBJ) fnMesh.from(path, type, true);
 		else if (type == zJSON) fnMesh.from(path, type, true);
+		else if (type == zFIELD)
+		{
+			zUtilsFieldReader reader;
+			if (reader.open(path) && readFieldValues(reader, 0)) updateColors();
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 
@@ -78,6 +83,11 @@ namespace zSpace
 
 		if (type == zOBJ) fnMesh.from(path, type, true);
 		else if (type == zJSON) fnMesh.from(path, type, true);
+		else if (type == zFIELD)
+		{
+			zUtilsFieldReader reader;
+			if (reader.open(path)) readFieldValues(reader, 0);
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 
@@ -91,6 +101,11 @@ namespace zSpace
 		if (type == zBMP) toBMP(path);
 		else if (type == zOBJ) fnMesh.to(path, type);
 		else if (type == zJSON) fnMesh.to(path, type);
+		else if (type == zFIELD)
+		{
+			zUtilsFieldWriter writer;
+			if (openFieldWriter(writer, path)) writeFieldFrame(writer);
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
@@ -100,10 +115,52 @@ namespace zSpace
 	{
 		if (type == zOBJ) fnMesh.to(path, type);
 		else if (type == zJSON) fnMesh.to(path, type);
+		else if (type == zFIELD)
+		{
+			zUtilsFieldWriter writer;
+			if (openFieldWriter(writer, path)) writeFieldFrame(writer);
+		}
 
 		else throw std::invalid_argument(" error: invalid zFileTpye type");
 	}
 
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::to(string path, zFileTpye type, zUtilsImageWriter &writer)
+	{
+		int resX = fieldObj->field.n_X;
+		int resY = fieldObj->field.n_Y;
+
+		zColor *col;
+		if (setValuesperVertex) col = fnMesh.getRawVertexColors();
+		else col = fnMesh.getRawFaceColors();
+
+		// same pixel layout as toBMP
+		vector<unsigned char> pixels((size_t)resX * resY * 4);
+
+		zUtilsParallel::forEach(0, resY, [&](int y)
+		{
+			for (int x = 0; x < resX; x++)
+			{
+				zItMeshScalarField s(*fieldObj, x, y);
+				zColor &c = col[s.getId()];
+
+				unsigned char* pixel = &pixels[4 * ((size_t)y * resX + x)];
+				pixel[0] = (unsigned char)(c.r * 255);
+				pixel[1] = (unsigned char)(c.g * 255);
+				pixel[2] = (unsigned char)(c.b * 255);
+				pixel[3] = (unsigned char)(c.a * 255);
+			}
+		}, 16);
+
+		writer.submit(pixels, resX, resY, path, type);
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zVector>::to(string, zFileTpye, zUtilsImageWriter &)
+	{
+		throw std::invalid_argument(" error: image export works only with scalar fields");
+	}
+
 	template<typename T>
 	ZSPACE_INLINE void zFnMeshField<T>::getBounds(zPoint &minBB, zPoint &maxBB)
 	{
@@ -117,6 +174,7 @@ namespace zSpace
 		ringNeighbours.clear();
 		adjacentNeighbours.clear();
 		fieldObj->field.fieldValues.clear();
+		fieldObj->kdTree.clear();
 		fnMesh.clear();
 	}
 
@@ -283,6 +341,18 @@ namespace zSpace
 		setFieldValues(gradients);
 	}
 
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeKDTree()
+	{
+		// field values are at the mesh vertices or face centers
+		zPointArray positions;
+
+		if (fieldObj->field.valuesperVertex) fnMesh.getVertexPositions(positions);
+		else fnMesh.getCenters(zFaceData, positions);
+
+		fieldObj->kdTree.create(positions);
+	}
+
 	//---- QUERIES
 
 	//---- zScalar &  zVector specilization for getNeighbour_Contained
@@ -1064,6 +1134,108 @@ namespace zSpace
 		return true;
 	}
 
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValues_Bilinear(zPointArray &samplePositions, vector<T> &fieldValues, zBoolArray &inBounds)
+	{
+		if (fieldObj->field.n_X * fieldObj->field.n_Y != numFieldValues() || numFieldValues() == 0) throw std::invalid_argument(" error: field values dont match the field resolution.");
+
+		int numSamples = samplePositions.size();
+
+		fieldValues.assign(numSamples, T());
+		vector<char> sampleInBounds(numSamples, 0);
+
+		int n_Y = fieldObj->field.n_Y;
+		int strideX = (fieldObj->field.n_X > 1) ? n_Y : 0;
+		int strideY = (n_Y > 1) ? 1 : 0;
+
+		T *values = fieldObj->field.fieldValues.data();
+
+		const int batchSize = 256;
+
+		zUtilsParallel::forRange(0, numSamples, [&](int start, int end, int)
+		{
+			int ids[batchSize];
+			float tX[batchSize], tY[batchSize];
+
+			for (int batchStart = start; batchStart < end; batchStart += batchSize)
+			{
+				int n = (std::min)(batchSize, end - batchStart);
+
+				getSampleCells_Bilinear(&samplePositions[batchStart], n, ids, tX, tY, &sampleInBounds[batchStart]);
+
+				for (int i = 0; i < n; i++)
+				{
+					int id = ids[i];
+
+					T v0 = values[id] * (1 - tX[i]) + values[id + strideX] * tX[i];
+					T v1 = values[id + strideY] * (1 - tX[i]) + values[id + strideX + strideY] * tX[i];
+
+					fieldValues[batchStart + i] = v0 * (1 - tY[i]) + v1 * tY[i];
+				}
+			}
+		}, batchSize);
+
+		inBounds.assign(sampleInBounds.begin(), sampleInBounds.end());
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getFieldValues_Bilinear(zPointArray &samplePositions, zScalarArray &fieldValues, zVectorArray &gradients, zBoolArray &inBounds)
+	{
+		if (fieldObj->field.n_X * fieldObj->field.n_Y != numFieldValues() || numFieldValues() == 0) throw std::invalid_argument(" error: field values dont match the field resolution.");
+
+		int numSamples = samplePositions.size();
+
+		fieldValues.assign(numSamples, 0);
+		gradients.assign(numSamples, zVector());
+		vector<char> sampleInBounds(numSamples, 0);
+
+		int n_Y = fieldObj->field.n_Y;
+		int strideX = (fieldObj->field.n_X > 1) ? n_Y : 0;
+		int strideY = (n_Y > 1) ? 1 : 0;
+
+		// derivatives are zero along axes with a single field value
+		float invUnitX = (strideX > 0) ? 1.0 / fieldObj->field.unit_X : 0.0;
+		float invUnitY = (strideY > 0) ? 1.0 / fieldObj->field.unit_Y : 0.0;
+
+		zScalar *values = fieldObj->field.fieldValues.data();
+
+		const int batchSize = 256;
+
+		zUtilsParallel::forRange(0, numSamples, [&](int start, int end, int)
+		{
+			int ids[batchSize];
+			float tX[batchSize], tY[batchSize];
+
+			for (int batchStart = start; batchStart < end; batchStart += batchSize)
+			{
+				int n = (std::min)(batchSize, end - batchStart);
+
+				getSampleCells_Bilinear(&samplePositions[batchStart], n, ids, tX, tY, &sampleInBounds[batchStart]);
+
+				for (int i = 0; i < n; i++)
+				{
+					int id = ids[i];
+
+					float v00 = values[id];
+					float v10 = values[id + strideX];
+					float v01 = values[id + strideY];
+					float v11 = values[id + strideX + strideY];
+
+					float v0 = v00 * (1 - tX[i]) + v10 * tX[i];
+					float v1 = v01 * (1 - tX[i]) + v11 * tX[i];
+
+					fieldValues[batchStart + i] = v0 * (1 - tY[i]) + v1 * tY[i];
+
+					zVector &g = gradients[batchStart + i];
+					g.x = ((v10 - v00) * (1 - tY[i]) + (v11 - v01) * tY[i]) * invUnitX;
+					g.y = (v1 - v0) * invUnitY;
+				}
+			}
+		}, batchSize);
+
+		inBounds.assign(sampleInBounds.begin(), sampleInBounds.end());
+	}
+
 	template<typename T>
 	ZSPACE_INLINE void zFnMeshField<T>::getFieldValues(vector<T>& fieldValues)
 	{
@@ -1202,43 +1374,11 @@ namespace zSpace
 	//----  2D IDW FIELD METHODS
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = meshValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), nullptr, meshValue, nullptr, influence, power, true, cutoff);
 
 		if (normalise)
 		{
@@ -1248,45 +1388,11 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise )
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
-
 		zFnGraph inFngraph(inGraphObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFngraph.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFngraph.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = graphValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-
-
-		}
+		computeFieldValues_IDW(fieldValues, inFngraph.getRawVertexPositions(), inFngraph.numVertices(), nullptr, graphValue, nullptr, influence, power, true, cutoff);
 
 		if (normalise)
 		{
@@ -1297,168 +1403,49 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise, double cutoff)
 	{
-
-		fieldValues.clear();
 		zFnPointCloud fnPoints(inPointsObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, fnPoints.getRawVertexPositions(), fnPoints.numVertices(), nullptr, value, nullptr, influence, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
 		zFnPointCloud fnPoints(inPointsObj);
 
 		if (fnPoints.numVertices() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (fnPoints.numVertices() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, fnPoints.getRawVertexPositions(), fnPoints.numVertices(), values.data(), T(), influences.data(), 0.0, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise, double cutoff)
 	{
-
-		fieldValues.clear();
-
-
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inPositions.data(), inPositions.size(), nullptr, value, nullptr, influence, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 	
 	template<typename T>
-	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, zDoubleArray& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, zDoubleArray& influences, double power, bool normalise, double cutoff)
 	{
 		if (inPositions.size() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inPositions.size() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)	d /= wSum;			
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inPositions.data(), inPositions.size(), values.data(), T(), influences.data(), 0.0, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 
 	//----  2D SCALAR FIELD METHODS
@@ -1466,49 +1453,18 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zPointArray &inPositions, bool normalise)
 	{
-		scalars.clear();;
+		zIntArray inEdges;
+		zDoubleArray distances;
+		computeDistances_EDT(distances, inPositions, inEdges);
 
-		vector<float> distVals;
-		float dMin = 100000;
-		float dMax = 0;;
+		// squared distances
+		scalars.assign(distances.size(), 0);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
+		for (int i = 0; i < (int)distances.size(); i++)
 		{
-			distVals.push_back(100000000);
+			scalars[i] = (distances[i] < 10000) ? distances[i] * distances[i] : 100000000;
 		}
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-
-
-				double dist = meshPositions[i].squareDistanceTo(inPositions[j]);
-
-
-
-				if (dist < distVals[i])
-				{
-					distVals[i] = dist;
-				}
-			}
-		}
-
-		scalars = distVals;
-		/*dMin = coreUtils.zMin(distVals);
-		dMax = coreUtils.zMax(distVals);
-
-
-		for (int j = 0; j < fnMesh.numVertices(); j++)
-		{
-			double val = coreUtils.ofMap(distVals[j], dMin, dMax, 0.0, 1.0);
-			scalars.push_back(val);
-		}*/
-
-
 		if (normalise)
 		{
 			normliseValues(scalars);
@@ -1520,32 +1476,11 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zPointArray &inPositions, float offset, bool normalise)
 	{
-		scalars.clear();;
-
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
+		zIntArray inEdges;
+		zDoubleArray distances;
+		computeDistances_EDT(distances, inPositions, inEdges);
 
-			scalars.push_back(d);
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1558,47 +1493,32 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, bool normalise)
 	{
-		scalars.clear();;
-
 		zFnPointCloud fnPoints(inPointsObj);
 
-		vector<double> distVals;
-		double dMin = 100000;
-		double dMax = 0;;
-
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			distVals.push_back(10000);
-		}
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-
+		zPointArray inPositions;
+		fnPoints.getVertexPositions(inPositions);
 
-				double dist = meshPositions[i].squareDistanceTo(inPositions[j]);
+		zIntArray inEdges;
+		zDoubleArray distVals;
+		computeDistances_EDT(distVals, inPositions, inEdges);
 
-				if (dist < distVals[j])
-				{
-					distVals[j] = dist;
-				}
-			}
-		}
+		double dMin = 100000;
+		double dMax = 0;;
 
+		// squared distances
 		for (int i = 0; i < distVals.size(); i++)
 		{
+			distVals[i] = (distVals[i] < 100) ? distVals[i] * distVals[i] : 10000;
+
 			dMin = coreUtils.zMin(dMin, distVals[i]);
 			dMax = coreUtils.zMax(dMax, distVals[i]);
 		}
 
-		for (int j = 0; j < fnMesh.numVertices(); j++)
+		scalars.assign(distVals.size(), 0);
+
+		for (int j = 0; j < (int)distVals.size(); j++)
 		{
-			double val = coreUtils.ofMap(distVals[j], dMin, dMax, 0.0, 1.0);
-			scalars.push_back(val);
+			scalars[j] = coreUtils.ofMap(distVals[j], dMin, dMax, 0.0, 1.0);
 		}
 
 
@@ -1613,35 +1533,16 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjPointCloud &inPointsObj, float offset,  bool normalise)
 	{
-		scalars.clear();;
-
 		zFnPointCloud fnPoints(inPointsObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < fnPoints.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
+		zPointArray inPositions;
+		fnPoints.getVertexPositions(inPositions);
 
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
+		zIntArray inEdges;
+		zDoubleArray distances;
+		computeDistances_EDT(distances, inPositions, inEdges);
 
-			}
-
-			scalars.push_back(d);
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1654,36 +1555,16 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjMesh &inMeshObj, float offset,  bool normalise)
 	{
-		scalars.clear();
-
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
+		zPointArray inPositions;
+		inFnMesh.getVertexPositions(inPositions);
 
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
+		zIntArray inEdges;
+		zDoubleArray distances;
+		computeDistances_EDT(distances, inPositions, inEdges);
 
-				r = r - offset;
-
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-
-			}
-
-			scalars.push_back(d);
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1696,36 +1577,16 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsVertexDistance(zScalarArray &scalars, zObjGraph &inGraphObj, float offset, bool normalise)
 	{
-		scalars.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-
-		// update values from meta balls
-
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnGraph.numVertices(); j++)
-			{
-				double r = meshPositions[i].distanceTo(inPositions[j]);
-
-				r = r - offset;
+		zPointArray inPositions;
+		inFnGraph.getVertexPositions(inPositions);
 
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
+		zIntArray inEdges;
+		zDoubleArray distances;
+		computeDistances_EDT(distances, inPositions, inEdges);
 
-			}
-
-			scalars.push_back(d);
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1737,41 +1598,24 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjMesh &inMeshObj,float offset, bool normalise)
 	{
-		scalars.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnMesh.getRawVertexPositions();
-
-		// update values from edge distance
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (zItMeshEdge e(inMeshObj); !e.end(); e++)
-			{
-
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
+		zPointArray inPositions;
+		inFnMesh.getVertexPositions(inPositions);
 
-				zVector closestPt;
+		zIntArray inEdges;
 
-				float r = coreUtils.minDist_Edge_Point(meshPositions[i], inPositions[e0], inPositions[e1], closestPt);
+		for (zItMeshEdge e(inMeshObj); !e.end(); e++)
+		{
+			inEdges.push_back(e.getHalfEdge(0).getVertex().getId());
+			inEdges.push_back(e.getHalfEdge(0).getStartVertex().getId());
+		}
 
-				r = r - offset;
+		zDoubleArray distances;
+		if (inEdges.size() > 0) computeDistances_EDT(distances, inPositions, inEdges);
+		else distances.assign(fnMesh.numVertices(), std::numeric_limits<double>::max());
 
-				if (r < tempDist)
-				{
-					d = r;
-					//d = F_of_r(r, a, b);
-					tempDist = r;
-				}
-			}
-
-			scalars.push_back(d);
-
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1785,42 +1629,26 @@ namespace zSpace
 	template<>
 	ZSPACE_INLINE 	void zFnMeshField<zScalar>::getScalarsAsEdgeDistance(zScalarArray &scalars, zObjGraph &inGraphObj, float offset, bool normalise)
 	{
-		scalars.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector *meshPositions = fnMesh.getRawVertexPositions();
-		zVector *inPositions = inFnGraph.getRawVertexPositions();
-				
-		// update values from edge distance
-		for (int i = 0; i < fnMesh.numVertices(); i++)
-		{
-			double d = 0.0;
-			double tempDist = 10000;
-
-			for (zItGraphEdge e(inGraphObj); !e.end(); e++)
-			{
-
-				int e0 = e.getHalfEdge(0).getVertex().getId();
-				int e1 = e.getHalfEdge(0).getStartVertex().getId();
-
-				if (e.getLength() < EPS) continue;
-
-				zVector closestPt;
+		zPointArray inPositions;
+		inFnGraph.getVertexPositions(inPositions);
 
-				double r = coreUtils.minDist_Edge_Point(meshPositions[i], inPositions[e0], inPositions[e1], closestPt);
+		zIntArray inEdges;
 
-				r = r - offset;
+		for (zItGraphEdge e(inGraphObj); !e.end(); e++)
+		{
+			if (e.getLength() < EPS) continue;
 
-				if (r < tempDist)
-				{
-					d = r;					
-					tempDist = r;
-				}
-			}
+			inEdges.push_back(e.getHalfEdge(0).getVertex().getId());
+			inEdges.push_back(e.getHalfEdge(0).getStartVertex().getId());
+		}
 
-			scalars.push_back(d);
+		zDoubleArray distances;
+		if (inEdges.size() > 0) computeDistances_EDT(distances, inPositions, inEdges);
+		else distances.assign(fnMesh.numVertices(), std::numeric_limits<double>::max());
 
-		}
+		setOffsetDistances(scalars, distances, offset);
 
 		if (normalise)
 		{
@@ -1969,6 +1797,14 @@ namespace zSpace
 		if (normalise) normliseValues(scalars);
 	}
 
+	template<>
+	ZSPACE_INLINE void zFnMeshField<zScalar>::getScalars_Expression(zScalarArray &scalars, zFieldExpression &expression, int nodeId, bool normalise)
+	{
+		expression.getValues(fnMesh.getRawVertexPositions(), fnMesh.numVertices(), scalars, nodeId);
+
+		if (normalise) normliseValues(scalars);
+	}
+
 	//--- COMPUTE METHODS 
 	
 	template<typename T>
@@ -2042,59 +1878,68 @@ namespace zSpace
 	//---- zScalar specilization for smoothField
 
 	template<>
-	ZSPACE_INLINE void zFnMeshField<zScalar>::smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp, zDiffusionType type)
+	ZSPACE_INLINE void zFnMeshField<zScalar>::smoothField(zScalarArray& scalars, int numSmooth, double diffuseDamp, zDiffusionType type, int blockSteps)
 	{
-		for (int k = 0; k < numSmooth; k++)
+		if ((int)scalars.size() != numFieldValues()) throw std::invalid_argument(" error: scalars and field value size dont match.");
+		if (numSmooth <= 0) return;
+
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+
+		blockSteps = (std::max)(1, (std::min)(blockSteps, numSmooth));
+
+		// the buffers are swapped after every pass
+		zScalarArray buffer(scalars.size());
+
+		zScalar *inValues = scalars.data();
+		zScalar *outValues = buffer.data();
+
+		// rows per tile, so a tile and its halo stay in cache
+		int tileRows = (std::max)(1, 16384 / n_Y);
+
+		for (int k = 0; k < numSmooth; k += blockSteps)
 		{
-			zScalarArray tempValues;
+			int steps = (std::min)(blockSteps, numSmooth - k);
 
-			for( zItMeshScalarField s(*fieldObj); !s.end(); s++)			
+			zUtilsParallel::forRange(0, n_X, [&](int start, int end, int)
 			{
-				float lapA = 0;
-
-				vector<zItMeshScalarField> ringNeigbours;
-				s.getNeighbour_Ring( 1, ringNeigbours);
+				zScalarArray tile0, tile1;
 
-				for (int j = 0; j < ringNeigbours.size(); j++)
+				for (int tileStart = start; tileStart < end; tileStart += tileRows)
 				{
-					int id = ringNeigbours[j].getId();
-					zScalar val = scalars[id]/*ringNeigbours[j].getValue()*/;
-					
-					if (type == zLaplacian)
-					{
-						if (id != s.getId()) lapA += (val * 1);
-						else lapA += (val * -8);
-					}
-					else if (type == zAverage)
+					int tileEnd = (std::min)(tileStart + tileRows, end);
+
+					if (steps == 1)
 					{
-						lapA += (val * 1);
+						computeSmoothRows(inValues, outValues, 0, tileStart, tileEnd, diffuseDamp, type);
+						continue;
 					}
-				}
 
+					// every step the valid rows of the halo shrink by one row on either side, except at the field boundary
+					int haloStart = (std::max)(0, tileStart - steps);
+					int haloEnd = (std::min)(n_X, tileEnd + steps);
 
+					tile0.assign(inValues + haloStart * n_Y, inValues + haloEnd * n_Y);
+					tile1.resize(tile0.size());
 
-				if (type == zLaplacian)
-				{
-					float val1 = scalars[s.getId()]/*s.getValue()*/;
-					
-					float newA = val1 + (lapA * diffuseDamp);
-					tempValues.push_back(newA);
-				}
-				else if (type == zAverage)
-				{
-					if (lapA != 0) lapA /= (ringNeigbours.size());
-
-					tempValues.push_back(lapA);
-				}
-
-			}
+					for (int s = 1; s <= steps; s++)
+					{
+						int rowStart = (haloStart == 0) ? 0 : haloStart + s;
+						int rowEnd = (haloEnd == n_X) ? n_X : haloEnd - s;
 
-			//setFieldValues(tempValues);
+						computeSmoothRows(tile0.data(), tile1.data(), haloStart, rowStart, rowEnd, diffuseDamp, type);
+						tile0.swap(tile1);
+					}
 
-			scalars = tempValues;
+					std::copy(tile0.begin() + (tileStart - haloStart) * n_Y, tile0.begin() + (tileEnd - haloStart) * n_Y, outValues + tileStart * n_Y);
+				}
+			}, tileRows);
 
+			std::swap(inValues, outValues);
 		}
 
+		if (inValues != scalars.data()) scalars.swap(buffer);
+
 		//updateColors();
 	}
 
@@ -2475,6 +2320,123 @@ namespace zSpace
 
 	}
 
+	//---- FIELD FRAME METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::openFieldWriter(zUtilsFieldWriter &writer, string path, zFieldPrecision precision, bool compress, int keyFrameInterval)
+	{
+		zUtilsFieldHeader header;
+		getFieldHeader(header);
+
+		header.precision = precision;
+		header.compression = (compress) ? 1 : 0;
+		header.keyFrameInterval = (keyFrameInterval > 0) ? keyFrameInterval : 1;
+
+		return writer.open(path, header);
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::writeFieldFrame(zUtilsFieldWriter &writer, double time)
+	{
+		const zUtilsFieldHeader &header = writer.getHeader();
+
+		if (!writer.isOpen() || header.numValues != fieldObj->field.fieldValues.size() || header.numComponents != sizeof(T) / sizeof(float))
+		{
+			cout << " error: field does not match the field file writer." << endl;
+			return false;
+		}
+
+		return writer.addFrame((const float*)fieldObj->field.fieldValues.data(), time);
+	}
+
+	//---- zScalar &  zVector specilization for readFieldFrame
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::readFieldFrame(zUtilsFieldReader &reader, int frame)
+	{
+		if (!readFieldValues(reader, frame)) return false;
+
+		updateColors();
+		return true;
+	}
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zVector>::readFieldFrame(zUtilsFieldReader &reader, int frame)
+	{
+		return readFieldValues(reader, frame);
+	}
+
+	//---- DATABASE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::to(zDatabase &database, string tableName, int64_t id)
+	{
+		zUtilsFieldHeader header;
+		getFieldHeader(header);
+
+		memcpy(header.magic, "ZFLD", 4);
+		header.version = 1;
+		header.byteOrder = 0x01020304;
+		header.numFrames = 1;
+
+		// values follow the header, as stored in memory
+		vector<unsigned char> data(sizeof(header) + header.numValues * sizeof(T));
+		memcpy(data.data(), &header, sizeof(header));
+		if (header.numValues > 0) memcpy(data.data() + sizeof(header), fieldObj->field.fieldValues.data(), header.numValues * sizeof(T));
+
+		zPoint minBB(header.minBB[0], header.minBB[1], header.minBB[2]);
+		zPoint maxBB(header.maxBB[0], header.maxBB[1], header.maxBB[2]);
+
+		if (!database.geometryTableCreate(tableName)) return false;
+
+		if (!database.geometryInsert(tableName, id, zFIELD, minBB, maxBB, data.data(), data.size()))
+		{
+			cout << " error in writing geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::getFieldValues(zDatabase &database, string tableName, int64_t id, int startIndex, int numValues, vector<T> &values)
+	{
+		zUtilsFieldHeader header;
+
+		bool valid = database.geometryRead(tableName, id, 0, &header, sizeof(header));
+		valid = valid && memcmp(header.magic, "ZFLD", 4) == 0 && header.byteOrder == 0x01020304 && header.precision == zFieldFloat32;
+		valid = valid && header.numComponents == sizeof(T) / sizeof(float);
+		valid = valid && startIndex >= 0 && numValues >= 0 && (uint64_t)startIndex + numValues <= header.numValues;
+
+		if (!valid)
+		{
+			cout << " error in reading geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
+		}
+
+		values.resize(numValues);
+		if (numValues == 0) return true;
+
+		return database.geometryRead(tableName, id, sizeof(header) + (int64_t)startIndex * sizeof(T), values.data(), (int64_t)numValues * sizeof(T));
+	}
+
+	//---- zScalar &  zVector specilization for from database
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zScalar>::from(zDatabase &database, string tableName, int64_t id)
+	{
+		if (!readFieldValues(database, tableName, id)) return false;
+
+		updateColors();
+		return true;
+	}
+
+	template<>
+	ZSPACE_INLINE bool zFnMeshField<zVector>::from(zDatabase &database, string tableName, int64_t id)
+	{
+		return readFieldValues(database, tableName, id);
+	}
+
 	//---- CONTOUR METHODS
 	
 	template<>
@@ -2717,12 +2679,97 @@ namespace zSpace
 				zItMeshScalarField s(*fieldObj, x, y);
 				s.setValue(r);
 
-				
+				
+
+			}
+		}
+
+		updateColors();
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::readFieldValues(zUtilsFieldReader &reader, int frame)
+	{
+		if (!reader.isOpen() || frame < 0 || frame >= reader.numFrames()) return false;
+
+		if (!setFieldHeader(reader.getHeader())) return false;
+
+		return reader.getFrame(frame, (float*)fieldObj->field.fieldValues.data());
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::getFieldHeader(zUtilsFieldHeader &header)
+	{
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		memset(&header, 0, sizeof(header));
+
+		header.numComponents = sizeof(T) / sizeof(float);
+		header.precision = zFieldFloat32;
+
+		header.n_X = fieldObj->field.n_X;
+		header.n_Y = fieldObj->field.n_Y;
+		header.n_Z = 1;
+
+		header.unit_X = fieldObj->field.unit_X;
+		header.unit_Y = fieldObj->field.unit_Y;
+		header.unit_Z = 0;
+
+		zPoint minBB, maxBB;
+		getBounds(minBB, maxBB);
+
+		header.minBB[0] = minBB.x; header.minBB[1] = minBB.y; header.minBB[2] = minBB.z;
+		header.maxBB[0] = maxBB.x; header.maxBB[1] = maxBB.y; header.maxBB[2] = maxBB.z;
+
+		header.numValues = fieldObj->field.fieldValues.size();
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::setFieldHeader(const zUtilsFieldHeader &header)
+	{
+		if (header.numComponents != sizeof(T) / sizeof(float) || header.n_Z != 1)
+		{
+			cout << " error: zFIELD data is not a 2D " << ((sizeof(T) == sizeof(float)) ? "scalar" : "vector") << " field." << endl;
+			return false;
+		}
+
+		if (header.n_X != fieldObj->field.n_X || header.n_Y != fieldObj->field.n_Y || header.numValues != fieldObj->field.fieldValues.size())
+		{
+			zPoint minBB(header.minBB[0], header.minBB[1], header.minBB[2]);
+			zPoint maxBB(header.maxBB[0], header.maxBB[1], header.maxBB[2]);
+
+			create(minBB, maxBB, header.n_X, header.n_Y, 1, setValuesperVertex, triMesh);
+
+			if (header.numValues != fieldObj->field.fieldValues.size())
+			{
+				cout << " error: zFIELD data values do not match the field " << ((setValuesperVertex) ? "vertices." : "faces.") << endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnMeshField<T>::readFieldValues(zDatabase &database, string tableName, int64_t id)
+	{
+		zUtilsFieldHeader header;
+
+		bool valid = database.geometryRead(tableName, id, 0, &header, sizeof(header));
+		valid = valid && memcmp(header.magic, "ZFLD", 4) == 0 && header.byteOrder == 0x01020304 && header.precision == zFieldFloat32;
 
-			}
+		if (!valid)
+		{
+			cout << " error in reading geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
 		}
 
-		updateColors();
+		if (!setFieldHeader(header)) return false;
+
+		if (header.numValues == 0) return true;
+
+		// straight in to the field values, without a copy of the blob
+		return database.geometryRead(tableName, id, sizeof(header), fieldObj->field.fieldValues.data(), (int64_t)header.numValues * sizeof(T));
 	}
 
 	template<typename T>
@@ -2808,6 +2855,8 @@ namespace zSpace
 
 		fnMesh.create(positions, polyCounts, polyConnects, true);
 
+		computeKDTree();
+
 		printf("\n fieldmesh: v %i e %i f %i", fnMesh.numVertices(), fnMesh.numEdges(), fnMesh.numPolygons());
 	}
 
@@ -4649,6 +4698,542 @@ namespace zSpace
 	}
 
 
+	//---- PROTECTED IDW METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeFieldValues_IDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T *values, T value, double *influences, double influence, double power, bool closestOnly, double cutoff)
+	{
+		zVector *meshPositions = fnMesh.getRawVertexPositions();
+		int numPositions = fnMesh.numVertices();
+
+		fieldValues.assign(numPositions, T());
+
+		// truncated IDW, only the input positions within the cutoff radius are gathered from the tree
+		zKDTree tree;
+		if (cutoff >= 0) tree.create(zPointArray(inPositions, inPositions + numInPositions));
+
+		// the field vertices are processed in tiles, so the accumulators of a tile stay in cache while the input positions stream past
+		const int tileSize = 256;
+
+		zUtilsParallel::forRange(0, numPositions, [&](int start, int end, int)
+		{
+			vector<T> d(tileSize);
+			zDoubleArray wSum(tileSize);
+			zDoubleArray tempDist(tileSize);
+
+			zIntArray neighbours;
+			zDoubleArray distancesSquared;
+
+			for (int tileStart = start; tileStart < end; tileStart += tileSize)
+			{
+				int tileEnd = (std::min)(tileStart + tileSize, end);
+
+				std::fill(d.begin(), d.end(), T());
+				std::fill(wSum.begin(), wSum.end(), 0.0);
+				std::fill(tempDist.begin(), tempDist.end(), 10000.0);
+
+				// same arithmetic and input order per field vertex as the serial IDW
+				auto addInput = [&](int i, int j)
+				{
+					int k = i - tileStart;
+					double r = meshPositions[i].distanceTo(inPositions[j]);
+
+					if (closestOnly && r >= tempDist[k]) return;
+
+					double w = (power == 2.0) ? r * r : pow(r, power);
+					wSum[k] += w;
+
+					double val = (w > 0.0) ? ((r * ((influences) ? influences[j] : influence)) / (w)) : 0.0;
+
+					if (closestOnly)
+					{
+						d[k] = ((values) ? values[j] : value) * val;
+						tempDist[k] = r;
+					}
+					else d[k] += (((values) ? values[j] : value) * val);
+				};
+
+				if (cutoff >= 0)
+				{
+					for (int i = tileStart; i < tileEnd; i++)
+					{
+						tree.getInRadius(meshPositions[i], cutoff, neighbours, distancesSquared);
+
+						std::sort(neighbours.begin(), neighbours.end());
+						for (auto &j : neighbours) addInput(i, j);
+					}
+				}
+				else
+				{
+					for (int j = 0; j < numInPositions; j++)
+					{
+						for (int i = tileStart; i < tileEnd; i++) addInput(i, j);
+					}
+				}
+
+				for (int i = tileStart; i < tileEnd; i++)
+				{
+					int k = i - tileStart;
+
+					if (wSum[k] > 0) d[k] /= wSum[k];
+					else d[k] = T();
+
+					fieldValues[i] = d[k];
+				}
+			}
+		}, tileSize);
+	}
+
+	//---- PROTECTED DISTANCE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeDistances_EDT(zDoubleArray &distances, zPointArray &inPositions, zIntArray &inEdges)
+	{
+		zVector *meshPositions = fnMesh.getRawVertexPositions();
+		int numVertices = fnMesh.numVertices();
+
+		const double INF = std::numeric_limits<double>::max();
+		distances.assign(numVertices, INF);
+
+		bool segments = (inEdges.size() > 0);
+		int numSources = (segments) ? inEdges.size() / 2 : inPositions.size();
+
+		if (numSources == 0 || numVertices == 0) return;
+
+		auto getSourceDistance = [&](int vId, int sId) -> double
+		{
+			if (!segments) return meshPositions[vId].distanceTo(inPositions[sId]);
+
+			zVector closestPt;
+			return coreUtils.minDist_Edge_Point(meshPositions[vId], inPositions[inEdges[sId * 2]], inPositions[inEdges[sId * 2 + 1]], closestPt);
+		};
+
+		// grid of the field mesh vertices, as laid out by createFieldMesh
+		double unit_X, unit_Y;
+		int resX, resY;
+
+		getUnitDistances(unit_X, unit_Y);
+		getResolution(resX, resY);
+
+		if (!setValuesperVertex)
+		{
+			resX++;
+			resY++;
+		}
+
+		zPoint origin = meshPositions[0];
+		double tolerance = 0.01 * (std::min)(unit_X, unit_Y);
+
+		bool regular = (resX * resY == numVertices && unit_X > 0 && unit_Y > 0);
+
+		for (int i = 0; regular && i < resX; i++)
+		{
+			for (int j = 0; j < resY; j++)
+			{
+				zPoint &p = meshPositions[i * resY + j];
+
+				if (fabs(p.x - (origin.x + i * unit_X)) > tolerance || fabs(p.y - (origin.y + j * unit_Y)) > tolerance || fabs(p.z - origin.z) > tolerance)
+				{
+					regular = false;
+					break;
+				}
+			}
+		}
+
+		// transformed field meshes are not on the grid, so every source is checked
+		if (!regular)
+		{
+			zUtilsParallel::forEach(0, numVertices, [&](int i)
+			{
+				for (int j = 0; j < numSources; j++) distances[i] = (std::min)(distances[i], getSourceDistance(i, j));
+			}, 64);
+
+			return;
+		}
+
+		// sample the sources, segments at half a cell
+		double step = 0.5 * (std::min)(unit_X, unit_Y);
+
+		vector<zPoint> samples;
+		zIntArray sampleSources;
+
+		for (int s = 0; s < numSources; s++)
+		{
+			if (!segments)
+			{
+				samples.push_back(inPositions[s]);
+				sampleSources.push_back(s);
+				continue;
+			}
+
+			zPoint &p0 = inPositions[inEdges[s * 2]];
+			zPoint &p1 = inPositions[inEdges[s * 2 + 1]];
+
+			double dx = p1.x - p0.x;
+			double dy = p1.y - p0.y;
+			int numSteps = (std::max)(1, (int)ceil(sqrt(dx * dx + dy * dy) / step));
+
+			for (int k = 0; k <= numSteps; k++)
+			{
+				samples.push_back(p0 + (p1 - p0) * ((double)k / numSteps));
+				sampleSources.push_back(s);
+			}
+		}
+
+		// the raster extends the field grid over the samples up to a margin, sources further out are checked for every vertex
+		int margin = (std::max)(resX, resY);
+
+		int iMin = 0, iMax = resX - 1;
+		int jMin = 0, jMax = resY - 1;
+
+		zIntArray sampleI(samples.size()), sampleJ(samples.size());
+		zIntArray farSources;
+
+		for (int k = 0; k < (int)samples.size(); k++)
+		{
+			double x = floor((samples[k].x - origin.x) / unit_X + 0.5);
+			double y = floor((samples[k].y - origin.y) / unit_Y + 0.5);
+
+			if (x < -margin || x > resX - 1 + margin || y < -margin || y > resY - 1 + margin)
+			{
+				if (farSources.size() == 0 || farSources.back() != sampleSources[k]) farSources.push_back(sampleSources[k]);
+
+				sampleI[k] = INT_MIN;
+				continue;
+			}
+
+			sampleI[k] = (int)x;
+			sampleJ[k] = (int)y;
+
+			iMin = (std::min)(iMin, sampleI[k]);
+			iMax = (std::max)(iMax, sampleI[k]);
+			jMin = (std::min)(jMin, sampleJ[k]);
+			jMax = (std::max)(jMax, sampleJ[k]);
+		}
+
+		std::sort(farSources.begin(), farSources.end());
+		farSources.erase(std::unique(farSources.begin(), farSources.end()), farSources.end());
+
+		int rasterX = iMax - iMin + 1;
+		int rasterY = jMax - jMin + 1;
+		int numNodes = rasterX * rasterY;
+
+		// squared out of plane distance of the closest sample per raster vertex, and the sources stored at each raster vertex
+		zDoubleArray f(numNodes, INF);
+		zIntPairArray nodeSources;
+
+		double rasterDistance = 0;
+
+		for (int k = 0; k < (int)samples.size(); k++)
+		{
+			if (sampleI[k] == INT_MIN) continue;
+
+			int node = (sampleI[k] - iMin) * rasterY + (sampleJ[k] - jMin);
+
+			double dx = samples[k].x - (origin.x + sampleI[k] * unit_X);
+			double dy = samples[k].y - (origin.y + sampleJ[k] * unit_Y);
+			double dz = samples[k].z - origin.z;
+
+			rasterDistance = (std::max)(rasterDistance, sqrt(dx * dx + dy * dy));
+			f[node] = (std::min)(f[node], dz * dz);
+
+			if (nodeSources.size() == 0 || nodeSources.back() != zIntPair(node, sampleSources[k])) nodeSources.push_back(zIntPair(node, sampleSources[k]));
+		}
+
+		// maximum distance in plane from a source to the raster vertex it is stored at
+		rasterDistance += tolerance;
+		if (segments) rasterDistance += 0.5 * step;
+
+		std::sort(nodeSources.begin(), nodeSources.end());
+		nodeSources.erase(std::unique(nodeSources.begin(), nodeSources.end()), nodeSources.end());
+
+		zIntArray sourceOffsets(numNodes + 1, 0);
+		zIntArray sourceIds(nodeSources.size());
+
+		for (int k = 0; k < (int)nodeSources.size(); k++)
+		{
+			sourceOffsets[nodeSources[k].first + 1]++;
+			sourceIds[k] = nodeSources[k].second;
+		}
+
+		for (int k = 0; k < numNodes; k++) sourceOffsets[k + 1] += sourceOffsets[k];
+
+		// separable squared distance transform to the closest raster vertex with sources, columns then rows
+		zDoubleArray columnDistances(numNodes);
+		zIntArray columnNearest(numNodes);
+
+		zUtilsParallel::forRange(0, rasterX, [&](int start, int end, int)
+		{
+			zIntArray v(rasterY);
+			zDoubleArray z(rasterY + 1);
+
+			for (int i = start; i < end; i++)
+			{
+				getDistanceTransform_1D(&f[i * rasterY], rasterY, unit_Y * unit_Y, &columnDistances[i * rasterY], &columnNearest[i * rasterY], v.data(), z.data());
+			}
+		}, 16);
+
+		// only the rows and columns of the field grid are needed from here on
+		zIntArray nearestNode(numVertices, -1);
+
+		zUtilsParallel::forRange(0, resY, [&](int start, int end, int)
+		{
+			zDoubleArray line(rasterX), d(rasterX);
+			zIntArray nearest(rasterX);
+			zIntArray v(rasterX);
+			zDoubleArray z(rasterX + 1);
+
+			for (int j = start; j < end; j++)
+			{
+				int rj = j - jMin;
+
+				for (int i = 0; i < rasterX; i++) line[i] = columnDistances[i * rasterY + rj];
+
+				getDistanceTransform_1D(line.data(), rasterX, unit_X * unit_X, d.data(), nearest.data(), v.data(), z.data());
+
+				for (int i = 0; i < resX; i++)
+				{
+					int ri = i - iMin;
+					if (nearest[ri] < 0) continue;
+
+					nearestNode[i * resY + j] = nearest[ri] * rasterY + columnNearest[nearest[ri] * rasterY + rj];
+				}
+			}
+		}, 16);
+
+		// exact distances to the sources of the closest raster vertex, and to all sources that can be closer within the band
+		double bandDistance = 4 * (std::max)(unit_X, unit_Y);
+
+		zUtilsParallel::forRange(0, numVertices, [&](int start, int end, int)
+		{
+			for (int v = start; v < end; v++)
+			{
+				double d = INF;
+
+				for (auto &s : farSources) d = (std::min)(d, getSourceDistance(v, s));
+
+				int node = nearestNode[v];
+
+				if (node >= 0)
+				{
+					for (int k = sourceOffsets[node]; k < sourceOffsets[node + 1]; k++) d = (std::min)(d, getSourceDistance(v, sourceIds[k]));
+				}
+
+				if (node >= 0 && d <= bandDistance)
+				{
+					int ri = v / resY - iMin;
+					int rj = v % resY - jMin;
+
+					int ringX = (int)ceil((d + rasterDistance) / unit_X);
+					int ringY = (int)ceil((d + rasterDistance) / unit_Y);
+
+					for (int x = (std::max)(0, ri - ringX); x <= (std::min)(rasterX - 1, ri + ringX); x++)
+					{
+						for (int y = (std::max)(0, rj - ringY); y <= (std::min)(rasterY - 1, rj + ringY); y++)
+						{
+							int n = x * rasterY + y;
+							for (int k = sourceOffsets[n]; k < sourceOffsets[n + 1]; k++) d = (std::min)(d, getSourceDistance(v, sourceIds[k]));
+						}
+					}
+				}
+
+				distances[v] = d;
+			}
+		}, 256);
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::getDistanceTransform_1D(const double *f, int n, double unitSq, double *d, int *nearest, int *v, double *z)
+	{
+		const double INF = std::numeric_limits<double>::max();
+
+		// lower envelope of the parabolas rooted at the finite samples
+		int k = -1;
+
+		for (int q = 0; q < n; q++)
+		{
+			if (f[q] == INF) continue;
+
+			double s = -INF;
+
+			while (k >= 0)
+			{
+				s = ((f[q] + unitSq * q * q) - (f[v[k]] + unitSq * v[k] * v[k])) / (2 * unitSq * (q - v[k]));
+
+				if (s <= z[k]) k--;
+				else break;
+			}
+
+			if (k < 0) s = -INF;
+
+			k++;
+			v[k] = q;
+			z[k] = s;
+			z[k + 1] = INF;
+		}
+
+		if (k < 0)
+		{
+			for (int q = 0; q < n; q++)
+			{
+				d[q] = INF;
+				nearest[q] = -1;
+			}
+
+			return;
+		}
+
+		k = 0;
+
+		for (int q = 0; q < n; q++)
+		{
+			while (z[k + 1] < q) k++;
+
+			d[q] = unitSq * (q - v[k]) * (q - v[k]) + f[v[k]];
+			nearest[q] = v[k];
+		}
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::setOffsetDistances(zScalarArray &scalars, zDoubleArray &distances, float offset)
+	{
+		scalars.assign(distances.size(), 0);
+
+		for (int i = 0; i < (int)distances.size(); i++)
+		{
+			// distances past 10000 were never picked up by the closest search
+			double r = distances[i] - offset;
+			scalars[i] = (r < 10000) ? r : 0.0;
+		}
+	}
+
+	//---- PROTECTED SMOOTH METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::computeSmoothRows(const zScalar *inValues, zScalar *outValues, int offsetX, int startX, int endX, double diffuseDamp, zDiffusionType type)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+
+		bool laplacian = (type == zLaplacian);
+		zScalar centreWeight = (laplacian) ? -8 : 1;
+
+		// neighbours are summed in the same order as the ring neighbours, clamped at the field boundary
+		auto smoothCell = [&](int x, int y)
+		{
+			int startIdX = (x == 0) ? 0 : -1;
+			int endIdX = (x == n_X - 1) ? 0 : 1;
+
+			int startIdY = (y == 0) ? 0 : -1;
+			int endIdY = (y == n_Y - 1) ? 0 : 1;
+
+			float lapA = 0;
+			int count = 0;
+
+			for (int i = startIdX; i <= endIdX; i++)
+			{
+				const zScalar *row = inValues + (x + i - offsetX) * n_Y;
+
+				for (int j = startIdY; j <= endIdY; j++)
+				{
+					lapA += (i == 0 && j == 0) ? row[y + j] * centreWeight : row[y + j] * 1;
+					count++;
+				}
+			}
+
+			int id = (x - offsetX) * n_Y + y;
+
+			if (laplacian) outValues[id] = inValues[id] + (lapA * diffuseDamp);
+			else outValues[id] = lapA / count;
+		};
+
+		for (int x = startX; x < endX; x++)
+		{
+			smoothCell(x, 0);
+			if (n_Y > 1) smoothCell(x, n_Y - 1);
+
+			if (x == 0 || x == n_X - 1)
+			{
+				for (int y = 1; y < n_Y - 1; y++) smoothCell(x, y);
+				continue;
+			}
+
+			// interior of the row, vectorizable along y
+			const zScalar *r0 = inValues + (x - 1 - offsetX) * n_Y;
+			const zScalar *r1 = inValues + (x - offsetX) * n_Y;
+			const zScalar *r2 = inValues + (x + 1 - offsetX) * n_Y;
+
+			zScalar *out = outValues + (x - offsetX) * n_Y;
+
+			if (laplacian)
+			{
+				for (int y = 1; y < n_Y - 1; y++)
+				{
+					float lapA = 0;
+					lapA += r0[y - 1]; lapA += r0[y]; lapA += r0[y + 1];
+					lapA += r1[y - 1]; lapA += r1[y] * centreWeight; lapA += r1[y + 1];
+					lapA += r2[y - 1]; lapA += r2[y]; lapA += r2[y + 1];
+
+					out[y] = r1[y] + (lapA * diffuseDamp);
+				}
+			}
+			else
+			{
+				for (int y = 1; y < n_Y - 1; y++)
+				{
+					float lapA = 0;
+					lapA += r0[y - 1]; lapA += r0[y]; lapA += r0[y + 1];
+					lapA += r1[y - 1]; lapA += r1[y]; lapA += r1[y + 1];
+					lapA += r2[y - 1]; lapA += r2[y]; lapA += r2[y + 1];
+
+					out[y] = lapA / 9;
+				}
+			}
+		}
+	}
+
+	//---- PROTECTED SAMPLING METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnMeshField<T>::getSampleCells_Bilinear(zPoint *samplePositions, int numSamples, int *ids, float *tX, float *tY, char *inBounds)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+
+		float minX = fieldObj->field.minBB.x;
+		float minY = fieldObj->field.minBB.y;
+
+		float invUnitX = 1.0 / fieldObj->field.unit_X;
+		float invUnitY = 1.0 / fieldObj->field.unit_Y;
+
+		float maxU = n_X - 1;
+		float maxV = n_Y - 1;
+
+		// lower corner of the cell, one below the last field value so the upper corner exists
+		int maxIdX = (std::max)(n_X - 2, 0);
+		int maxIdY = (std::max)(n_Y - 2, 0);
+
+		// straight line code per sample, so the loop vectorizes over the samples
+		for (int i = 0; i < numSamples; i++)
+		{
+			float u = (samplePositions[i].x - minX) * invUnitX;
+			float v = (samplePositions[i].y - minY) * invUnitY;
+
+			inBounds[i] = (u >= 0 && u <= maxU && v >= 0 && v <= maxV) ? 1 : 0;
+
+			u = (std::min)((std::max)(u, 0.0f), maxU);
+			v = (std::min)((std::max)(v, 0.0f), maxV);
+
+			int idX = (std::min)((int)u, maxIdX);
+			int idY = (std::min)((int)v, maxIdY);
+
+			tX[i] = (std::min)(u - idX, 1.0f);
+			tY[i] = (std::min)(v - idY, 1.0f);
+
+			ids[i] = idX * n_Y + idY;
+		}
+	}
+
 #if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
 	// explicit instantiation
 	template class zFnMeshField<zVector>;
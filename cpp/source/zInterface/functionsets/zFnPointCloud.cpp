@@ -45,6 +45,8 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointCloud::from(string path, zFileTpye type, bool staticGeom)
 	{
 		if (type == zCSV) fromCSV(path);
+		else if (type == zPLY || type == zPLYASCII) fromPLY(path);
+		else if (type == zXYZ) fromXYZ(path);
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::from(json& j, bool staticGeom)
@@ -57,6 +59,9 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointCloud::to(string path, zFileTpye type)
 	{
 		if (type == zCSV) toCSV(path);
+		else if (type == zPLY) toPLY(path, zPlyBinaryLittleEndian);
+		else if (type == zPLYASCII) toPLY(path, zPlyASCII);
+		else if (type == zXYZ) toXYZ(path);
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::to(json& j)
@@ -84,6 +89,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointCloud::clear()
 	{
 		pointsObj->pCloud.clear();
+		pointsObj->kdTree.clear();
 	}
 
 	//---- CREATE METHODS
@@ -92,6 +98,209 @@ namespace zSpace
 	{
 		pointsObj->pCloud.create(_positions);
 
+		// positions changed
+		pointsObj->kdTree.clear();
+	}
+
+	ZSPACE_INLINE bool zFnPointCloud::createFromCSV(string infilename, zUtilsCSVLayout &layout, vector<zDoubleArray> &scalarColumns)
+	{
+		zUtilsMappedFile csvFile;
+
+		if (!csvFile.open(infilename))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		// target of each column - -1 unused, 0 - 2 position, 3 - 5 color, 6 + scalars
+		bool hasColors = layout.hasColors();
+		int numScalars = (int)layout.scalarColumns.size();
+		int numColumns = layout.getNumColumns();
+
+		zIntArray columnTargets(numColumns, -1);
+		for (int k = 0; k < 3; k++)
+		{
+			if (layout.positionColumns[k] >= 0) columnTargets[layout.positionColumns[k]] = k;
+			if (hasColors) columnTargets[layout.colorColumns[k]] = 3 + k;
+		}
+		for (int k = 0; k < numScalars; k++) if (layout.scalarColumns[k] >= 0) columnTargets[layout.scalarColumns[k]] = 6 + k;
+
+		bool validLayout = true;
+		for (int k = 0; k < 3; k++) validLayout = validLayout && layout.positionColumns[k] >= 0 && columnTargets[layout.positionColumns[k]] == k;
+
+		if (!validLayout)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : invalid column layout." << endl;
+			return false;
+		}
+
+		// per chunk parse results
+		struct zCSVChunk
+		{
+			zPointArray positions;
+			zColorArray colors;
+			zDoubleArray scalars;
+		};
+
+		int numChunks = (int)(std::min)((size_t)zUtilsParallel::getNumThreads(), csvFile.getSize() / (1 << 20) + 1);
+
+		vector<pair<size_t, size_t>> chunkRanges;
+		csvFile.getLineChunks(numChunks, chunkRanges);
+		numChunks = (int)chunkRanges.size();
+
+		vector<zCSVChunk> chunks(numChunks);
+
+		zUtilsParallel::forEach(0, numChunks, [&](int c)
+		{
+			zCSVChunk &chunk = chunks[c];
+			zUtilsTextCursor cursor(csvFile.getData() + chunkRanges[c].first, csvFile.getData() + chunkRanges[c].second);
+
+			// estimated number of rows, assuming about 12 characters per column
+			size_t estimate = (chunkRanges[c].second - chunkRanges[c].first) / (12 * numColumns + 1);
+			chunk.positions.reserve(estimate);
+			if (hasColors) chunk.colors.reserve(estimate);
+			chunk.scalars.reserve(estimate * numScalars);
+
+			double values[6];
+			zDoubleArray rowScalars(numScalars);
+
+			while (!cursor.atEnd())
+			{
+				if (cursor.atLineEnd())
+				{
+					cursor.skipLine();
+					continue;
+				}
+
+				if (layout.skipVertexToken) cursor.matchToken("v");
+
+				bool validRow = true;
+
+				for (int col = 0; col < numColumns && validRow; col++)
+				{
+					int target = columnTargets[col];
+
+					if (target < 0)
+					{
+						const char* token;
+						size_t length;
+						cursor.readToken(token, length, ",;");
+					}
+					else
+					{
+						double val;
+						validRow = cursor.readDouble(val);
+
+						if (target < 6) values[target] = val;
+						else rowScalars[target - 6] = val;
+					}
+
+					cursor.skipSpaces();
+					if (!cursor.skipChar(',')) cursor.skipChar(';');
+				}
+
+				// header and malformed rows are skipped
+				if (validRow)
+				{
+					chunk.positions.push_back(zPoint(values[0], values[1], values[2]));
+
+					if (hasColors)
+					{
+						zColor col(values[3] * layout.colorScale, values[4] * layout.colorScale, values[5] * layout.colorScale, 1);
+						chunk.colors.push_back(col);
+					}
+
+					chunk.scalars.insert(chunk.scalars.end(), rowScalars.begin(), rowScalars.end());
+				}
+
+				cursor.skipLine();
+			}
+		});
+
+		csvFile.close();
+
+		// chunk offsets
+		zIntArray vOffsets(numChunks + 1, 0);
+		for (int c = 0; c < numChunks; c++) vOffsets[c + 1] = vOffsets[c] + (int)chunks[c].positions.size();
+
+		int nV = vOffsets[numChunks];
+
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		pCloud.clear();
+		pCloud.positionVertex.clear();
+
+		pCloud.vertexPositions.resize(nV);
+		if (hasColors) pCloud.vertexColors.resize(nV);
+
+		scalarColumns.assign(numScalars, zDoubleArray());
+		for (auto &column : scalarColumns) column.resize(nV);
+
+		// stitch the chunks
+		zUtilsParallel::forEach(0, numChunks, [&](int c)
+		{
+			zCSVChunk &chunk = chunks[c];
+
+			std::copy(chunk.positions.begin(), chunk.positions.end(), pCloud.vertexPositions.begin() + vOffsets[c]);
+
+			for (int i = 0; i < (int)chunk.colors.size(); i++)
+			{
+				zColor &col = pCloud.vertexColors[vOffsets[c] + i];
+
+				col = chunk.colors[i];
+				col.toHSV();
+			}
+
+			for (int i = 0; i < (int)chunk.positions.size(); i++)
+			{
+				for (int k = 0; k < numScalars; k++) scalarColumns[k][vOffsets[c] + i] = chunk.scalars[i * numScalars + k];
+			}
+
+			zPointArray().swap(chunk.positions);
+			zColorArray().swap(chunk.colors);
+			zDoubleArray().swap(chunk.scalars);
+		});
+
+		setVertexContainers();
+
+		printf("\n inPositions: %i ", nV);
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnPointCloud::createFromStore(zPointCloudStore &store, zPoint &minBB, zPoint &maxBB, int lod)
+	{
+		if (!store.isReadable())
+		{
+			cout << " error: point cloud store is not readable." << endl;
+			return false;
+		}
+
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		pCloud.clear();
+		store.getPoints(minBB, maxBB, lod, pCloud.vertexPositions, pCloud.vertexColors);
+
+		setVertexContainers();
+
+		printf("\n inPositions: %i ", pCloud.n_v);
+
+		return true;
+	}
+
+	ZSPACE_INLINE bool zFnPointCloud::toStore(zPointCloudStore &store, string directory, int maxTilePoints, int maxDepth)
+	{
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		zPoint minBB, maxBB;
+		getBounds(minBB, maxBB);
+
+		if (!store.create(directory, minBB, maxBB, maxTilePoints, maxDepth)) return false;
+
+		bool colors = pCloud.vertexColors.size() == pCloud.vertexPositions.size();
+		store.addPoints(pCloud.vertexPositions.data(), (colors) ? pCloud.vertexColors.data() : nullptr, pCloud.vertexPositions.size());
+
+		return store.finalise();
 	}
 
 	//---- APPEND METHODS
@@ -99,6 +308,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointCloud::addPosition(zPoint &_position)
 	{
 		pointsObj->pCloud.addVertex(_position);
+		pointsObj->kdTree.clear();
 	}
 
 	ZSPACE_INLINE void zFnPointCloud::addPositions(zPointArray &_positions)
@@ -113,6 +323,47 @@ namespace zSpace
 		return  pointsObj->pCloud.n_v;
 	}
 
+	ZSPACE_INLINE void zFnPointCloud::computeKDTree(int leafSize)
+	{
+		pointsObj->kdTree.create(pointsObj->pCloud.vertexPositions, leafSize);
+	}
+
+	ZSPACE_INLINE int zFnPointCloud::getClosestVertex(const zPoint &pos, double &distanceSquared, double maxDistance)
+	{
+		updateKDTree();
+		return pointsObj->kdTree.getClosest(pos, distanceSquared, maxDistance);
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::getClosestVertices(const zPointArray &positions, zIntArray &closest, zDoubleArray &distancesSquared, double maxDistance)
+	{
+		updateKDTree();
+		pointsObj->kdTree.getClosest(positions, closest, distancesSquared, maxDistance);
+	}
+
+	ZSPACE_INLINE int zFnPointCloud::getKNearestVertices(const zPoint &pos, int k, zIntArray &neighbours, zDoubleArray &distancesSquared, double maxDistance)
+	{
+		updateKDTree();
+		return pointsObj->kdTree.getKNearest(pos, k, neighbours, distancesSquared, maxDistance);
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::getKNearestVertices(const zPointArray &positions, int k, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared, double maxDistance)
+	{
+		updateKDTree();
+		pointsObj->kdTree.getKNearest(positions, k, neighbours, distancesSquared, maxDistance);
+	}
+
+	ZSPACE_INLINE int zFnPointCloud::getVerticesInRadius(const zPoint &pos, double radius, zIntArray &neighbours, zDoubleArray &distancesSquared)
+	{
+		updateKDTree();
+		return pointsObj->kdTree.getInRadius(pos, radius, neighbours, distancesSquared);
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::getVerticesInRadius(const zPointArray &positions, double radius, vector<zIntArray> &neighbours, vector<zDoubleArray> &distancesSquared)
+	{
+		updateKDTree();
+		pointsObj->kdTree.getInRadius(positions, radius, neighbours, distancesSquared);
+	}
+
 	//--- SET METHODS 
 
 	ZSPACE_INLINE void zFnPointCloud::setVertexColor(zColor col)
@@ -293,88 +544,300 @@ namespace zSpace
 			pos[i] = newPos;
 		}
 
+		// positions changed
+		pointsObj->kdTree.clear();
+	}
+
+	//---- PROTECTED METHODS
+
+	ZSPACE_INLINE void zFnPointCloud::updateKDTree()
+	{
+		if (pointsObj->kdTree.numPoints() != numVertices()) computeKDTree();
 	}
 
 	//---- PROTECTED FACTORY METHODS
 
-	ZSPACE_INLINE void zFnPointCloud::fromCSV(string infilename)
+	ZSPACE_INLINE bool zFnPointCloud::fromCSV(string infilename)
 	{
-		pointsObj->pCloud.vertexPositions.clear();
+		zUtilsCSVLayout layout;
+		vector<zDoubleArray> scalarColumns;
+
+		return createFromCSV(infilename, layout, scalarColumns);
+	}
 
-		ifstream myfile;
-		myfile.open(infilename.c_str());
+	ZSPACE_INLINE void zFnPointCloud::toCSV(string outfilename)
+	{
+
+		// output file
+		ofstream myfile;
+		myfile.open(outfilename.c_str());
 
 		if (myfile.fail())
 		{
-			cout << " error in opening file  " << infilename.c_str() << endl;
+			cout << " error in opening file  " << outfilename.c_str() << endl;
 			return;
 
 		}
 
-		while (!myfile.eof())
-		{
-			string str;
-			getline(myfile, str);
+		// the text of contiguous point ranges is formatted in parallel and written in order
+		const int grain = 1 << 14;
+
+		// vertex positions
+		int nV = pointsObj->pCloud.vertexPositions.size();
+		vector<zUtilsTextWriter> vWriters(zUtilsParallel::getNumRanges(nV, grain), zUtilsTextWriter(filePrecision));
 
-			vector<string> perlineData = pointsObj->pCloud.coreUtils.splitString(str, " ");
+		zUtilsParallel::forRange(0, nV, [&](int start, int end, int threadId)
+		{
+			zUtilsTextWriter &writer = vWriters[threadId];
+			writer.reserve((size_t)(end - start) * (3 * filePrecision + 20));
 
-			if (perlineData.size() > 0)
+			for (int i = start; i < end; i++)
 			{
-				// vertex
-				if (perlineData[0] == "v")
-				{
-					if (perlineData.size() == 4)
-					{
-						zVector pos;
-						pos.x = atof(perlineData[1].c_str());
-						pos.y = atof(perlineData[2].c_str());
-						pos.z = atof(perlineData[3].c_str());
+				zPoint &vPos = pointsObj->pCloud.vertexPositions[i];
+
+				writer.write("\n v ");
+				writer.write(vPos.x);
+				writer.write(' ');
+				writer.write(vPos.y);
+				writer.write(' ');
+				writer.write(vPos.z);
+			}
+		}, grain);
 
-						pointsObj->pCloud.vertexPositions.push_back(pos);
+		for (auto &writer : vWriters) writer.flush(myfile);
 
+		myfile.close();
 
-					}
-					//printf("\n working vertex");
-				}
+		cout << endl << " TXT exported. File:   " << outfilename.c_str() << endl;
+	}
+
+	ZSPACE_INLINE bool zFnPointCloud::fromPLY(string infilename)
+	{
+		zUtilsPlyReader reader;
+
+		if (!reader.open(infilename))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
+		}
+
+		zUtilsPlyElement* vertex = reader.getElement("vertex");
+
+		if (vertex == nullptr)
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : no vertex element." << endl;
+			return false;
+		}
+
+		const int grain = 1 << 14;
+		const size_t vStride = sizeof(zVector) / sizeof(float);
+		const size_t cStride = sizeof(zColor) / sizeof(float);
+
+		int nV = (int)vertex->count;
 
+		zPointCloud &pCloud = pointsObj->pCloud;
 
+		pCloud.clear();
+		pCloud.positionVertex.clear();
+
+		// positions
+		pCloud.vertexPositions.resize(nV);
+
+		if (nV > 0)
+		{
+			bool valid = reader.readProperty(*vertex, "x", &pCloud.vertexPositions[0].x, vStride);
+			valid = valid && reader.readProperty(*vertex, "y", &pCloud.vertexPositions[0].y, vStride);
+			valid = valid && reader.readProperty(*vertex, "z", &pCloud.vertexPositions[0].z, vStride);
+
+			if (!valid)
+			{
+				pCloud.clear();
+
+				cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete vertex data." << endl;
+				return false;
 			}
 		}
 
-		myfile.close();
+		// vertex colors
+		if (nV > 0 && reader.hasProperty(*vertex, "red") && reader.hasProperty(*vertex, "green") && reader.hasProperty(*vertex, "blue"))
+		{
+			pCloud.vertexColors.assign(nV, zColor(0, 0, 0, 1));
 
+			reader.readProperty(*vertex, "red", &pCloud.vertexColors[0].r, cStride, true);
+			reader.readProperty(*vertex, "green", &pCloud.vertexColors[0].g, cStride, true);
+			reader.readProperty(*vertex, "blue", &pCloud.vertexColors[0].b, cStride, true);
+			reader.readProperty(*vertex, "alpha", &pCloud.vertexColors[0].a, cStride, true);
 
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				pCloud.vertexColors[i].toHSV();
+			}, grain);
+		}
 
-		printf("\n inPositions: %i ", pointsObj->pCloud.vertexPositions.size());
+		setVertexContainers();
 
+		printf("\n inPositions: %i ", nV);
 
+		return true;
 	}
 
-	ZSPACE_INLINE void zFnPointCloud::toCSV(string outfilename)
+	ZSPACE_INLINE void zFnPointCloud::toPLY(string outfilename, int format)
 	{
+		zPointCloud &pCloud = pointsObj->pCloud;
 
-		// output file
-		ofstream myfile;
-		myfile.open(outfilename.c_str());
+		int nV = pCloud.vertexPositions.size();
+		bool vColors = (int)pCloud.vertexColors.size() == nV;
 
-		if (myfile.fail())
+		// columns over the point cloud containers
+		const size_t vStride = sizeof(zVector) / sizeof(float);
+		const size_t cStride = sizeof(zColor) / sizeof(float);
+
+		zUtilsPlyWriter writer;
+
+		writer.addElement("vertex", nV);
+
+		if (nV > 0)
+		{
+			writer.addProperty("x", zPlyFloat32, &pCloud.vertexPositions[0].x, vStride);
+			writer.addProperty("y", zPlyFloat32, &pCloud.vertexPositions[0].y, vStride);
+			writer.addProperty("z", zPlyFloat32, &pCloud.vertexPositions[0].z, vStride);
+		}
+
+		if (nV > 0 && vColors)
+		{
+			writer.addProperty("red", zPlyUInt8, &pCloud.vertexColors[0].r, cStride, 255.0f);
+			writer.addProperty("green", zPlyUInt8, &pCloud.vertexColors[0].g, cStride, 255.0f);
+			writer.addProperty("blue", zPlyUInt8, &pCloud.vertexColors[0].b, cStride, 255.0f);
+			writer.addProperty("alpha", zPlyUInt8, &pCloud.vertexColors[0].a, cStride, 255.0f);
+		}
+
+		if (!writer.write(outfilename, format, filePrecision))
 		{
 			cout << " error in opening file  " << outfilename.c_str() << endl;
 			return;
+		}
+
+		cout << endl << " PLY exported. File:   " << outfilename.c_str() << endl;
+	}
+
+	ZSPACE_INLINE bool zFnPointCloud::fromXYZ(string infilename)
+	{
+		zUtilsBinaryReader reader;
 
+		if (!reader.open(infilename, "ZXYZ", 1))
+		{
+			cout << " error in opening file  " << infilename.c_str() << endl;
+			return false;
 		}
 
-		// vertex positions
-		for (int i = 0; i < pointsObj->pCloud.vertexPositions.size(); i++)
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		size_t nP = 0, nC = 0;
+		const zVector* positionData = (const zVector*)reader.getBlock(zBinVertexPositions, sizeof(zVector), nP);
+		const uint8_t* colorData = (const uint8_t*)reader.getBlock(zBinVertexColorsRGB8, 3 * sizeof(uint8_t), nC);
+
+		if (positionData == nullptr || (colorData != nullptr && nC != nP))
+		{
+			cout << " error in reading file  " << infilename.c_str() << " : invalid or incomplete point data." << endl;
+			return false;
+		}
+
+		const int grain = 1 << 14;
+		int nV = (int)nP;
+
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		pCloud.clear();
+		pCloud.positionVertex.clear();
+
+		// the position block has the memory layout of the container
+		pCloud.vertexPositions.resize(nV);
+		if (nV > 0) memcpy(&pCloud.vertexPositions[0].x, positionData, nP * sizeof(zVector));
+
+		if (colorData != nullptr)
 		{
+			pCloud.vertexColors.resize(nV);
 
-			myfile << "\n v " << pointsObj->pCloud.vertexPositions[i].x << " " << pointsObj->pCloud.vertexPositions[i].y << " " << pointsObj->pCloud.vertexPositions[i].z;
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				zColor &col = pCloud.vertexColors[i];
 
+				col = zColor(colorData[i * 3 + 0] / 255.0f, colorData[i * 3 + 1] / 255.0f, colorData[i * 3 + 2] / 255.0f, 1);
+				col.toHSV();
+			}, grain);
 		}
 
-		myfile.close();
+		reader.close();
 
-		cout << endl << " TXT exported. File:   " << outfilename.c_str() << endl;
+		setVertexContainers();
+
+		printf("\n inPositions: %i ", nV);
+
+		return true;
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::toXYZ(string outfilename)
+	{
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		const int grain = 1 << 14;
+		int nV = pCloud.vertexPositions.size();
+
+		zUtilsBinaryWriter writer;
+		writer.addBlock(zBinVertexPositions, pCloud.vertexPositions.data(), sizeof(zVector), nV);
+
+		vector<uint8_t> colorData;
+
+		if ((int)pCloud.vertexColors.size() == nV)
+		{
+			colorData.resize(nV * 3);
+
+			zUtilsParallel::forEach(0, nV, [&](int i)
+			{
+				zColor &col = pCloud.vertexColors[i];
+
+				colorData[i * 3 + 0] = (uint8_t)std::round(coreUtils.ofClamp(col.r, 0.0f, 1.0f) * 255.0f);
+				colorData[i * 3 + 1] = (uint8_t)std::round(coreUtils.ofClamp(col.g, 0.0f, 1.0f) * 255.0f);
+				colorData[i * 3 + 2] = (uint8_t)std::round(coreUtils.ofClamp(col.b, 0.0f, 1.0f) * 255.0f);
+			}, grain);
+
+			writer.addBlock(zBinVertexColorsRGB8, colorData.data(), 3 * sizeof(uint8_t), nV);
+		}
+
+		if (!writer.write(outfilename, "ZXYZ", 1))
+		{
+			cout << " error in opening file  " << outfilename.c_str() << endl;
+			return;
+		}
+
+		cout << endl << " XYZ exported. File:   " << outfilename.c_str() << endl;
+	}
+
+	ZSPACE_INLINE void zFnPointCloud::setVertexContainers()
+	{
+		zPointCloud &pCloud = pointsObj->pCloud;
+
+		// positions reloaded
+		pointsObj->kdTree.clear();
+
+		const int grain = 1 << 14;
+		int nV = pCloud.vertexPositions.size();
+
+		// default attribute values
+		if ((int)pCloud.vertexColors.size() != nV) pCloud.vertexColors.assign(nV, zColor(1, 0, 0, 1));
+		pCloud.vertexWeights.assign(nV, 2.0);
+
+		// vertices
+		pCloud.vertices.resize(nV);
+
+		zUtilsParallel::forEach(0, nV, [&](int i)
+		{
+			pCloud.vertices[i].setId(i);
+		}, grain);
+
+		pCloud.setNumVertices(nV);
+
+		pCloud.setPositionMap();
 	}
 
 }
\ No newline at end of file
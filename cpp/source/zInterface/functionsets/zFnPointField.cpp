@@ -53,6 +53,13 @@ namespace zSpace
 	template<typename T>
 	ZSPACE_INLINE void zFnPointField<T>::getBounds(zPoint& minBB, zPoint& maxBB)
 	{
+		if (fieldObj->sparse)
+		{
+			minBB = fieldObj->sparseField.minBB;
+			maxBB = fieldObj->sparseField.maxBB;
+			return;
+		}
+
 		minBB = fieldObj->field.minBB;
 		maxBB = fieldObj->field.maxBB;
 	}
@@ -62,6 +69,7 @@ namespace zSpace
 	{
 
 		fieldObj->field.fieldValues.clear();
+		fieldObj->sparseField.clear();
 
 		fnPoints.clear();
 	}
@@ -76,6 +84,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointField<zScalar>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, int _NR)
 	{
 		fieldObj->field = zField3D<zScalar>(_minBB, _maxBB, _n_X, _n_Y, _n_Z);
+		fieldObj->sparse = false;
 
 		// compute neighbours
 		ringNeighbours.clear();
@@ -120,6 +129,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointField<zVector>::create(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, int _NR)
 	{
 		fieldObj->field = zField3D<zVector>(_minBB, _maxBB, _n_X, _n_Y, _n_Z);
+		fieldObj->sparse = false;
 
 		// compute neighbours
 		ringNeighbours.clear();
@@ -145,6 +155,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointField<zScalar>::create(double _unit_X, double _unit_Y, double _unit_Z, int _n_X, int _n_Y, int _n_Z, zPoint _minBB, int _NR)
 	{
 		fieldObj->field = zField3D<zScalar>(_unit_X, _unit_Y, _unit_Z, _n_X, _n_Y, _n_Z, _minBB);
+		fieldObj->sparse = false;
 
 		// compute neighbours
 		ringNeighbours.clear();
@@ -170,6 +181,7 @@ namespace zSpace
 	ZSPACE_INLINE void zFnPointField<zVector>::create(double _unit_X, double _unit_Y, double _unit_Z, int _n_X, int _n_Y, int _n_Z, zPoint _minBB, int _NR)
 	{
 		fieldObj->field = zField3D<zVector>(_unit_X, _unit_Y, _unit_Z, _n_X, _n_Y, _n_Z, _minBB);
+		fieldObj->sparse = false;
 
 		// compute neighbours
 		ringNeighbours.clear();
@@ -206,6 +218,12 @@ namespace zSpace
 		setFieldValues(gradients);
 	}
 
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeKDTree()
+	{
+		fnPoints.computeKDTree();
+	}
+
 	//--- FIELD QUERY METHODS 
 
 	template<>
@@ -427,6 +445,133 @@ namespace zSpace
 		return true;
 	}
 
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValues_Trilinear(zPointArray &samplePositions, vector<T> &fieldValues, zBoolArray &inBounds)
+	{
+		if (fieldObj->field.n_X * fieldObj->field.n_Y * fieldObj->field.n_Z != numFieldValues() || numFieldValues() == 0) throw std::invalid_argument(" error: field values dont match the field resolution.");
+
+		int numSamples = samplePositions.size();
+
+		fieldValues.assign(numSamples, T());
+		vector<char> sampleInBounds(numSamples, 0);
+
+		int n_Z = fieldObj->field.n_Z;
+		int strideX = (fieldObj->field.n_X > 1) ? fieldObj->field.n_Y * n_Z : 0;
+		int strideY = (fieldObj->field.n_Y > 1) ? n_Z : 0;
+		int strideZ = (n_Z > 1) ? 1 : 0;
+
+		T *values = fieldObj->field.fieldValues.data();
+
+		const int batchSize = 256;
+
+		zUtilsParallel::forRange(0, numSamples, [&](int start, int end, int)
+		{
+			int ids[batchSize];
+			float tX[batchSize], tY[batchSize], tZ[batchSize];
+
+			for (int batchStart = start; batchStart < end; batchStart += batchSize)
+			{
+				int n = (std::min)(batchSize, end - batchStart);
+
+				getSampleCells_Trilinear(&samplePositions[batchStart], n, ids, tX, tY, tZ, &sampleInBounds[batchStart]);
+
+				for (int i = 0; i < n; i++)
+				{
+					int id = ids[i];
+
+					T v00 = values[id] * (1 - tX[i]) + values[id + strideX] * tX[i];
+					T v10 = values[id + strideY] * (1 - tX[i]) + values[id + strideX + strideY] * tX[i];
+					T v01 = values[id + strideZ] * (1 - tX[i]) + values[id + strideX + strideZ] * tX[i];
+					T v11 = values[id + strideY + strideZ] * (1 - tX[i]) + values[id + strideX + strideY + strideZ] * tX[i];
+
+					T v0 = v00 * (1 - tY[i]) + v10 * tY[i];
+					T v1 = v01 * (1 - tY[i]) + v11 * tY[i];
+
+					fieldValues[batchStart + i] = v0 * (1 - tZ[i]) + v1 * tZ[i];
+				}
+			}
+		}, batchSize);
+
+		inBounds.assign(sampleInBounds.begin(), sampleInBounds.end());
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getFieldValues_Trilinear(zPointArray &samplePositions, zScalarArray &fieldValues, zVectorArray &gradients, zBoolArray &inBounds)
+	{
+		if (fieldObj->field.n_X * fieldObj->field.n_Y * fieldObj->field.n_Z != numFieldValues() || numFieldValues() == 0) throw std::invalid_argument(" error: field values dont match the field resolution.");
+
+		int numSamples = samplePositions.size();
+
+		fieldValues.assign(numSamples, 0);
+		gradients.assign(numSamples, zVector());
+		vector<char> sampleInBounds(numSamples, 0);
+
+		int n_Z = fieldObj->field.n_Z;
+		int strideX = (fieldObj->field.n_X > 1) ? fieldObj->field.n_Y * n_Z : 0;
+		int strideY = (fieldObj->field.n_Y > 1) ? n_Z : 0;
+		int strideZ = (n_Z > 1) ? 1 : 0;
+
+		// derivatives are zero along axes with a single field value
+		float invUnitX = (strideX > 0) ? 1.0 / fieldObj->field.unit_X : 0.0;
+		float invUnitY = (strideY > 0) ? 1.0 / fieldObj->field.unit_Y : 0.0;
+		float invUnitZ = (strideZ > 0) ? 1.0 / fieldObj->field.unit_Z : 0.0;
+
+		zScalar *values = fieldObj->field.fieldValues.data();
+
+		const int batchSize = 256;
+
+		zUtilsParallel::forRange(0, numSamples, [&](int start, int end, int)
+		{
+			int ids[batchSize];
+			float tX[batchSize], tY[batchSize], tZ[batchSize];
+
+			for (int batchStart = start; batchStart < end; batchStart += batchSize)
+			{
+				int n = (std::min)(batchSize, end - batchStart);
+
+				getSampleCells_Trilinear(&samplePositions[batchStart], n, ids, tX, tY, tZ, &sampleInBounds[batchStart]);
+
+				for (int i = 0; i < n; i++)
+				{
+					int id = ids[i];
+
+					// corner values, indexed by the x, y and z offsets as bits
+					float c[8];
+					c[0] = values[id];
+					c[1] = values[id + strideX];
+					c[2] = values[id + strideY];
+					c[3] = values[id + strideX + strideY];
+					c[4] = values[id + strideZ];
+					c[5] = values[id + strideX + strideZ];
+					c[6] = values[id + strideY + strideZ];
+					c[7] = values[id + strideX + strideY + strideZ];
+
+					float x = tX[i], y = tY[i], z = tZ[i];
+
+					float v00 = c[0] * (1 - x) + c[1] * x;
+					float v10 = c[2] * (1 - x) + c[3] * x;
+					float v01 = c[4] * (1 - x) + c[5] * x;
+					float v11 = c[6] * (1 - x) + c[7] * x;
+
+					float v0 = v00 * (1 - y) + v10 * y;
+					float v1 = v01 * (1 - y) + v11 * y;
+
+					fieldValues[batchStart + i] = v0 * (1 - z) + v1 * z;
+
+					float dX0 = (c[1] - c[0]) * (1 - y) + (c[3] - c[2]) * y;
+					float dX1 = (c[5] - c[4]) * (1 - y) + (c[7] - c[6]) * y;
+
+					zVector &g = gradients[batchStart + i];
+					g.x = (dX0 * (1 - z) + dX1 * z) * invUnitX;
+					g.y = ((v10 - v00) * (1 - z) + (v11 - v01) * z) * invUnitY;
+					g.z = (v1 - v0) * invUnitZ;
+				}
+			}
+		}, batchSize);
+
+		inBounds.assign(sampleInBounds.begin(), sampleInBounds.end());
+	}
+
 	template<typename T>
 	ZSPACE_INLINE void zFnPointField<T>::getFieldValues(vector<T>& fieldValues)
 	{
@@ -541,42 +686,11 @@ namespace zSpace
 	//----  3D IDW FIELD METHODS
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zObjMesh& inMeshObj, T meshValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjMesh &inMeshObj, T meshValue, double influence, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
 		zFnMesh inFnMesh(inMeshObj);
 
-		zVector* positions = fnPoints.getRawVertexPositions();
-		zVector* inPositions = inFnMesh.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnMesh.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = meshValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0)  d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inFnMesh.getRawVertexPositions(), inFnMesh.numVertices(), nullptr, meshValue, nullptr, influence, power, true, cutoff);
 
 		if (normalise)
 		{
@@ -586,44 +700,11 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zObjGraph& inGraphObj, T graphValue, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjGraph &inGraphObj, T graphValue, double influence, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
 		zFnGraph inFnGraph(inGraphObj);
 
-		zVector* positions = fnPoints.getRawVertexPositions();
-		zVector* inPositions = inFnGraph.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnGraph.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				if (r < tempDist)
-				{
-					double w = pow(r, power);
-					wSum += w;
-					double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-					d = graphValue * val;
-
-					tempDist = r;
-				}
-
-			}
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-
-
-		}
+		computeFieldValues_IDW(fieldValues, inFnGraph.getRawVertexPositions(), inFnGraph.numVertices(), nullptr, graphValue, nullptr, influence, power, true, cutoff);
 
 		if (normalise)
 		{
@@ -634,163 +715,49 @@ namespace zSpace
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zObjPointCloud& inPointsObj, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, T value, double influence, double power, bool normalise, double cutoff)
 	{
-
-		fieldValues.clear();
 		zFnPointCloud inFnPoints(inPointsObj);
 
-		zVector* positions = fnPoints.getRawVertexPositions();
-		zVector* inPositions = inFnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnPoints.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0)  d /= wSum;
-			d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inFnPoints.getRawVertexPositions(), inFnPoints.numVertices(), nullptr, value, nullptr, influence, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 
-	template <typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zObjPointCloud& inPointsObj, vector<T>& values, vector<double>& influences, double power, bool normalise)
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zObjPointCloud &inPointsObj, vector<T> &values, vector<double>& influences, double power, bool normalise, double cutoff)
 	{
-		fieldValues.clear();
 		zFnPointCloud inFnPoints(inPointsObj);
 
-
 		if (inFnPoints.numVertices() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inFnPoints.numVertices() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector* positions = fnPoints.getRawVertexPositions();
-		zVector* inPositions = inFnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inFnPoints.numVertices(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)  d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inFnPoints.getRawVertexPositions(), inFnPoints.numVertices(), values.data(), T(), influences.data(), 0.0, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
+
 	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zPointArray& inPositions, T value, double influence, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, T value, double influence, double power, bool normalise, double cutoff)
 	{
-
-		fieldValues.clear();
-
-		zVector* positions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influence) / (w)) : 0.0;;
-
-				d += (value * val);
-			}
-
-
-			if (wSum > 0) d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inPositions.data(), inPositions.size(), nullptr, value, nullptr, influence, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
-
+	
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T>& fieldValues, zPointArray& inPositions, vector<T>& values, vector<double>& influences, double power, bool normalise)
+	ZSPACE_INLINE void zFnPointField<T>::getFieldValuesAsVertexDistance_IDW(vector<T> &fieldValues, zPointArray &inPositions, vector<T> &values, zDoubleArray& influences, double power, bool normalise, double cutoff)
 	{
 		if (inPositions.size() != values.size()) throw std::invalid_argument(" error: size of inPositions and values dont match.");
 		if (inPositions.size() != influences.size()) throw std::invalid_argument(" error: size of inPositions and influences dont match.");
 
-		zVector* positions = fnPoints.getRawVertexPositions();
-
-		for (int i = 0; i < fnPoints.numVertices(); i++)
-		{
-			T d;
-			double wSum = 0.0;
-			double tempDist = 10000;
-
-			for (int j = 0; j < inPositions.size(); j++)
-			{
-				double r = positions[i].distanceTo(inPositions[j]);
-
-				double w = pow(r, power);
-				wSum += w;
-
-				double val = (w > 0.0) ? ((r * influences[j]) / (w)) : 0.0;;
-
-				d += (values[j] * val);
-			}
-
-
-			if (wSum > 0)	d /= wSum;
-			else d = T();
-
-			fieldValues.push_back(d);
-		}
+		computeFieldValues_IDW(fieldValues, inPositions.data(), inPositions.size(), values.data(), T(), influences.data(), 0.0, power, false, cutoff);
 
 		if (normalise)	normliseValues(fieldValues);
 
-
-
 	}
 
 	//----  3D SCALAR FIELD METHODS
@@ -1049,6 +1016,14 @@ namespace zSpace
 
 	}
 
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getScalars_Expression(zScalarArray &scalars, zFieldExpression &expression, int nodeId, bool normalise)
+	{
+		expression.getValues(fnPoints.getRawVertexPositions(), fnPoints.numVertices(), scalars, nodeId);
+
+		if (normalise) normliseValues(scalars);
+	}
+
 	//--- COMPUTE METHODS 
 
 	template<typename T>
@@ -1108,57 +1083,69 @@ namespace zSpace
 	//---- zScalar specilization for smoothField
 
 	template<>
-	ZSPACE_INLINE void zFnPointField<zScalar>::smoothField(int numSmooth, double diffuseDamp, zDiffusionType type)
+	ZSPACE_INLINE void zFnPointField<zScalar>::smoothField(int numSmooth, double diffuseDamp, zDiffusionType type, int blockSteps)
 	{
-		for (int k = 0; k < numSmooth; k++)
+		if (numSmooth <= 0) return;
+
+		zScalarArray &scalars = fieldObj->field.fieldValues;
+
+		int n_X = fieldObj->field.n_X;
+		int sliceSize = fieldObj->field.n_Y * fieldObj->field.n_Z;
+
+		blockSteps = (std::max)(1, (std::min)(blockSteps, numSmooth));
+
+		// the buffers are swapped after every pass
+		zScalarArray buffer(scalars.size());
+
+		zScalar *inValues = scalars.data();
+		zScalar *outValues = buffer.data();
+
+		// slices per tile, so a tile and its halo stay in cache
+		int tileSlices = (std::max)(1, 65536 / sliceSize);
+
+		for (int k = 0; k < numSmooth; k += blockSteps)
 		{
-			vector<float> tempValues;
+			int steps = (std::min)(blockSteps, numSmooth - k);
 
-			for (zItPointScalarField s(*fieldObj); !s.end(); s++)
+			zUtilsParallel::forRange(0, n_X, [&](int start, int end, int)
 			{
-				double lapA = 0;
-
-				vector<zItPointScalarField> aNeigbours;
-				s.getNeighbour_Adjacents(aNeigbours);
+				zScalarArray tile0, tile1;
 
-				for (int j = 0; j < aNeigbours.size(); j++)
+				for (int tileStart = start; tileStart < end; tileStart += tileSlices)
 				{
-					int id = aNeigbours[j].getId();
-					zScalar val = aNeigbours[j].getValue();
+					int tileEnd = (std::min)(tileStart + tileSlices, end);
 
-					if (type == zLaplacian)
-					{
-						if (id != s.getId()) lapA += (val * 1);
-						else lapA += (val * -6);
-					}
-					else if (type == zAverage)
+					if (steps == 1)
 					{
-						lapA += (val * 1);
+						computeSmoothSlices(inValues, outValues, 0, tileStart, tileEnd, diffuseDamp, type);
+						continue;
 					}
-				}
 
+					// every step the valid slices of the halo shrink by one slice on either side, except at the field boundary
+					int haloStart = (std::max)(0, tileStart - steps);
+					int haloEnd = (std::min)(n_X, tileEnd + steps);
 
+					tile0.assign(inValues + haloStart * sliceSize, inValues + haloEnd * sliceSize);
+					tile1.resize(tile0.size());
 
-				if (type == zLaplacian)
-				{
-					double val1 = s.getValue();
+					for (int s = 1; s <= steps; s++)
+					{
+						int sliceStart = (haloStart == 0) ? 0 : haloStart + s;
+						int sliceEnd = (haloEnd == n_X) ? n_X : haloEnd - s;
 
-					double newA = val1 + (lapA * diffuseDamp);
-					tempValues.push_back(newA);
-				}
-				else if (type == zAverage)
-				{
-					if (lapA != 0) lapA /= (aNeigbours.size());
+						computeSmoothSlices(tile0.data(), tile1.data(), haloStart, sliceStart, sliceEnd, diffuseDamp, type);
+						tile0.swap(tile1);
+					}
 
-					tempValues.push_back(lapA);
+					std::copy(tile0.begin() + (tileStart - haloStart) * sliceSize, tile0.begin() + (tileEnd - haloStart) * sliceSize, outValues + tileStart * sliceSize);
 				}
+			}, tileSlices);
 
-			}
-
-			setFieldValues(tempValues);
-
+			std::swap(inValues, outValues);
 		}
 
+		if (inValues != scalars.data()) scalars.swap(buffer);
+
 		updateColors();
 
 	}
@@ -1339,108 +1326,1676 @@ namespace zSpace
 
 	}
 
-	//----  UPDATE METHODS
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_union(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result)
+	{
+		computeSparseBoolean(field_A, field_B, field_Result, [](float a, float b) { return (std::min)(a, b); });
+	}
 
-	//---- zScalar specilization for updateColors
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_subtract(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result)
+	{
+		computeSparseBoolean(field_A, field_B, field_Result, [](float a, float b) { return (std::max)(a, -1 * b); });
+	}
 
 	template<>
-	ZSPACE_INLINE void zFnPointField<zScalar>::updateColors()
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_intersect(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result)
 	{
+		computeSparseBoolean(field_A, field_B, field_Result, [](float a, float b) { return (std::max)(a, b); });
+	}
 
-		vector<float> scalars;
-		getFieldValues(scalars);
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::boolean_difference(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result)
+	{
+		zSparseField3D<zScalar> AUnionB;
+		boolean_union(field_A, field_B, AUnionB);
 
-		computeDomain(scalars, contourValueDomain);
+		zSparseField3D<zScalar> AIntersectB;
+		boolean_intersect(field_B, field_A, AIntersectB);
 
-		//convert to HSV
+		boolean_subtract(AUnionB, AIntersectB, field_Result);
+	}
 
-		if (contourValueDomain.min == contourValueDomain.max)
-		{
-			zColor col(0.5, 0.5, 0.5);
+	//----  SPARSE FIELD METHODS
 
-			fnPoints.setVertexColor(col);
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::createSparse(zPoint _minBB, zPoint _maxBB, int _n_X, int _n_Y, int _n_Z, T _background)
+	{
+		if (_n_X <= 0 || _n_Y <= 0 || _n_Z <= 0) throw std::invalid_argument(" error: resolution needs to be positive.");
 
-			return;
-		}
+		clear();
 
-		else
-		{
-			fieldColorDomain.min.toHSV(); fieldColorDomain.max.toHSV();
+		fieldObj->field = zField3D<T>();
+		fieldObj->sparseField = zSparseField3D<T>(_minBB, _maxBB, _n_X, _n_Y, _n_Z, _background);
+		fieldObj->sparse = true;
 
-			zColor* cols = fnPoints.getRawVertexColors();
+		ringNeighbours.clear();
+		adjacentNeighbours.clear();
+	}
 
-			for (int i = 0; i < scalars.size(); i++)
-			{
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::isSparse()
+	{
+		return fieldObj->sparse;
+	}
 
-				//SDFs
-					if (scalars[i] <= 0)
-					{
-						//temp = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
+	template<typename T>
+	ZSPACE_INLINE int zFnPointField<T>::numActiveBlocks()
+	{
+		return fieldObj->sparseField.numBlocks();
+	}
 
-						cols[i] = zColor(0, 0.550, 0.950, 1);
-					}
-					else if (scalars[i] > 0)
-					{
-						cols[i] = zColor(0.950, 0, 0.55, 1);
-						//cols[i] = zColor(0.25, 0.25, 0.25, 1) /*dCol.max*/;
-					}
-					else cols[i] = zColor(0.950, 0, 0.55, 1);
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::getSparseFieldValue(zPoint &samplePos, T &fieldValue)
+	{
+		zSparseField3D<T> &sf = fieldObj->sparseField;
 
-				//if (scalars[i] < contourValueDomain.min) cols[i] = fieldColorDomain.min;
-				//else if (scalars[i] > contourValueDomain.max) cols[i] = fieldColorDomain.max;
-				//else
-				//{
-				//	cols[i] = coreUtils.blendColor(scalars[i], contourValueDomain, fieldColorDomain, zHSV);
-				//}
+		double u[3] = { (samplePos.x - sf.minBB.x) / sf.unit_X, (samplePos.y - sf.minBB.y) / sf.unit_Y, (samplePos.z - sf.minBB.z) / sf.unit_Z };
+		int n[3] = { sf.n_X, sf.n_Y, sf.n_Z };
 
-			}
+		int id[3];
+		double t[3];
 
-		}
+		for (int j = 0; j < 3; j++)
+		{
+			if (u[j] < 0 || u[j] > n[j] - 1) return false;
+
+			id[j] = (std::min)((int)floor(u[j]), (std::max)(n[j] - 2, 0));
+			t[j] = (n[j] > 1) ? u[j] - id[j] : 0.0;
+		}
+
+		auto getValue = [&](int dx, int dy, int dz) -> T
+		{
+			return sf.getValue((std::min)(id[0] + dx, n[0] - 1), (std::min)(id[1] + dy, n[1] - 1), (std::min)(id[2] + dz, n[2] - 1));
+		};
+
+		T c00 = getValue(0, 0, 0) * (1 - t[0]) + getValue(1, 0, 0) * t[0];
+		T c10 = getValue(0, 1, 0) * (1 - t[0]) + getValue(1, 1, 0) * t[0];
+		T c01 = getValue(0, 0, 1) * (1 - t[0]) + getValue(1, 0, 1) * t[0];
+		T c11 = getValue(0, 1, 1) * (1 - t[0]) + getValue(1, 1, 1) * t[0];
+
+		T c0 = c00 * (1 - t[1]) + c10 * t[1];
+		T c1 = c01 * (1 - t[1]) + c11 * t[1];
+
+		fieldValue = c0 * (1 - t[2]) + c1 * t[2];
+
+		return true;
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::setSparseScalarsAsSignedDistance(zObjMesh &inMeshObj, double bandWidth)
+	{
+		if (!fieldObj->sparse) throw std::invalid_argument(" error: field is not sparse.");
+
+		zFnMesh inFnMesh(inMeshObj);
+
+		zPointArray inPositions;
+		inFnMesh.getVertexPositions(inPositions);
+
+		vector<zIntArray> faceTris;
+		inFnMesh.getMeshTriangles(faceTris);
+
+		zIntArray inTriangles;
+		for (auto &tris : faceTris) inTriangles.insert(inTriangles.end(), tris.begin(), tris.end());
+
+		computeSparseDistances(fieldObj->sparseField, inPositions, inTriangles, 3, 0, bandWidth);
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::setSparseScalarsAsEdgeDistance(zObjGraph &inGraphObj, float offset, double bandWidth)
+	{
+		if (!fieldObj->sparse) throw std::invalid_argument(" error: field is not sparse.");
+
+		zFnGraph inFnGraph(inGraphObj);
+
+		zPointArray inPositions;
+		inFnGraph.getVertexPositions(inPositions);
+
+		zIntArray inEdges;
+
+		for (zItGraphEdge e(inGraphObj); !e.end(); e++)
+		{
+			if (e.getLength() < EPS) continue;
+
+			inEdges.push_back(e.getHalfEdge(0).getStartVertex().getId());
+			inEdges.push_back(e.getHalfEdge(0).getVertex().getId());
+		}
+
+		computeSparseDistances(fieldObj->sparseField, inPositions, inEdges, 2, offset, bandWidth);
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::setSparseScalarsAsVertexDistance(zObjPointCloud &inPointsObj, float offset, double bandWidth)
+	{
+		if (!fieldObj->sparse) throw std::invalid_argument(" error: field is not sparse.");
+
+		zFnPointCloud inFnPoints(inPointsObj);
+
+		zPointArray inPositions;
+		inFnPoints.getVertexPositions(inPositions);
+
+		zIntArray inPoints(inPositions.size());
+		for (int i = 0; i < (int)inPoints.size(); i++) inPoints[i] = i;
+
+		computeSparseDistances(fieldObj->sparseField, inPositions, inPoints, 1, offset, bandWidth);
+	}
+
+	//----  ISOSURFACE METHODS
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getIsosurface(zObjMesh &coutourMeshObj, zPoint regionMin, zPoint regionMax, float inThreshold, bool invertMesh)
+	{
+		if (fieldObj->sparse) throw std::invalid_argument(" error: field is sparse.");
+
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+
+		if (n_X * n_Y * n_Z != numFieldValues()) throw std::invalid_argument(" error: field values dont match the field resolution.");
+
+		zFnMesh tempFn(coutourMeshObj);
+		tempFn.clear(); // clear memory if the mobject exists.
+
+		zPoint minBB = fieldObj->field.minBB;
+		double unit_X = fieldObj->field.unit_X;
+		double unit_Y = fieldObj->field.unit_Y;
+		double unit_Z = fieldObj->field.unit_Z;
+
+		// field value range of the region, snapped outwards to the cells
+		auto getIndex = [](float val, float minVal, double unit, int n, bool roundUp)
+		{
+			double u = (val - minVal) / unit;
+			int id = (roundUp) ? (int)ceil(u) : (int)floor(u);
+			return (std::min)((std::max)(id, 0), n - 1);
+		};
+
+		int x0 = getIndex(regionMin.x, minBB.x, unit_X, n_X, false);
+		int y0 = getIndex(regionMin.y, minBB.y, unit_Y, n_Y, false);
+		int z0 = getIndex(regionMin.z, minBB.z, unit_Z, n_Z, false);
+
+		int x1 = getIndex(regionMax.x, minBB.x, unit_X, n_X, true);
+		int y1 = getIndex(regionMax.y, minBB.y, unit_Y, n_Y, true);
+		int z1 = getIndex(regionMax.z, minBB.z, unit_Z, n_Z, true);
+
+		// no cells in the region
+		if (x1 <= x0 || y1 <= y0 || z1 <= z0) return;
+
+		int m_X = x1 - x0 + 1;
+		int m_Y = y1 - y0 + 1;
+		int m_Z = z1 - z0 + 1;
+
+		zScalar *values = fieldObj->field.fieldValues.data();
+		float threshold = inThreshold;
+
+		int planeSize = 3 * m_Y * m_Z;
+
+		// numbers the crossing vertices of the edges in X, Y and Z from the field values of a plane, in a fixed order so every slab computes the same ids.
+		// planeVertices gets the vertex per edge, -1 if the edge doesnt cross the threshold. The positions are written if the input container is not null.
+		auto computePlaneVertices = [&](int i, int vertexId, int *planeVertices, zPoint *outPositions)
+		{
+			for (int j = 0; j < m_Y; j++)
+			{
+				for (int k = 0; k < m_Z; k++)
+				{
+					int id = 3 * (j * m_Z + k);
+					int fieldId = ((i + x0) * n_Y + (j + y0)) * n_Z + (k + z0);
+
+					float val = values[fieldId];
+					bool inside = val < threshold;
+
+					zPoint pos(minBB.x + (i + x0) * unit_X, minBB.y + (j + y0) * unit_Y, minBB.z + (k + z0) * unit_Z);
+
+					int nextIds[3] = { (i < m_X - 1) ? fieldId + n_Y * n_Z : -1, (j < m_Y - 1) ? fieldId + n_Z : -1, (k < m_Z - 1) ? fieldId + 1 : -1 };
+
+					for (int axis = 0; axis < 3; axis++)
+					{
+						if (planeVertices) planeVertices[id + axis] = -1;
+						if (nextIds[axis] == -1) continue;
+
+						float nextVal = values[nextIds[axis]];
+						if (inside == (nextVal < threshold)) continue;
+
+						if (planeVertices) planeVertices[id + axis] = vertexId;
+
+						if (outPositions)
+						{
+							zPoint &vPos = outPositions[vertexId];
+							vPos = pos;
+
+							float t = (threshold - val) / (nextVal - val);
+							if (axis == 0) vPos.x += t * unit_X;
+							else if (axis == 1) vPos.y += t * unit_Y;
+							else vPos.z += t * unit_Z;
+						}
+
+						vertexId++;
+					}
+				}
+			}
+
+			return vertexId;
+		};
+
+		// count the crossing vertices per slab of field values in X, each slab owns the edges starting on its planes
+		int numRanges = zUtilsParallel::getNumRanges(m_X);
+
+		zIntArray rangeStart(numRanges, 0);
+		zIntArray rangeEnd(numRanges, 0);
+		zIntArray rangeOffset(numRanges + 1, 0);
+
+		zUtilsParallel::forRange(0, m_X, [&](int start, int end, int tid)
+		{
+			rangeStart[tid] = start;
+			rangeEnd[tid] = end;
+
+			int numVertices = 0;
+			for (int i = start; i < end; i++) numVertices = computePlaneVertices(i, numVertices, nullptr, nullptr);
+
+			rangeOffset[tid + 1] = numVertices;
+		});
+
+		for (int r = 0; r < numRanges; r++) rangeOffset[r + 1] += rangeOffset[r];
+
+		int numPositions = rangeOffset[numRanges];
+		if (numPositions == 0) return;
+
+		zPointArray positions(numPositions);
+
+		// cube edges as the plane, 0 for the plane of the cell and 1 for the next, and the offset in to the plane vertices from the first corner of the cell, following the edge order of the triangle table
+		int cubeEdgePlanes[12] = { 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0 };
+		int cubeEdgeOffsets[12] =
+		{
+			0, 1, 3 * m_Z, 1,
+			3, 4, 3 * m_Z + 3, 4,
+			2, 2, 3 * m_Z + 2, 3 * m_Z + 2
+		};
+
+		// vertices and triangles per slab, with a cache of the vertices of the two planes of the cells being visited
+		vector<zIntArray> rangeConnects(numRanges);
+
+		zUtilsParallel::forEach(0, numRanges, [&](int r)
+		{
+			int start = rangeStart[r];
+			int end = rangeEnd[r];
+			if (start == end) return;
+
+			zIntArray planeVertices(planeSize);
+			zIntArray nextPlaneVertices(planeSize);
+
+			int vertexId = computePlaneVertices(start, rangeOffset[r], planeVertices.data(), positions.data());
+
+			zIntArray &rConnects = rangeConnects[r];
+
+			for (int i = start; i < end && i < m_X - 1; i++)
+			{
+				// the last plane of the slab is numbered by the next slab, its ids are computed without writing the positions
+				if (i + 1 < end) vertexId = computePlaneVertices(i + 1, vertexId, nextPlaneVertices.data(), positions.data());
+				else computePlaneVertices(i + 1, rangeOffset[r + 1], nextPlaneVertices.data(), nullptr);
+
+				int *cubePlanes[2] = { planeVertices.data(), nextPlaneVertices.data() };
+
+				for (int j = 0; j < m_Y - 1; j++)
+				{
+					for (int k = 0; k < m_Z - 1; k++)
+					{
+						int fieldId = ((i + x0) * n_Y + (j + y0)) * n_Z + (k + z0);
+
+						// cube corners in the vertex order of the triangle table
+						int corners[8] =
+						{
+							fieldId, fieldId + n_Y * n_Z, fieldId + n_Y * n_Z + n_Z, fieldId + n_Z,
+							fieldId + 1, fieldId + n_Y * n_Z + 1, fieldId + n_Y * n_Z + n_Z + 1, fieldId + n_Z + 1
+						};
+
+						int cubeIndex = 0;
+						for (int c = 0; c < 8; c++)
+						{
+							if (values[corners[c]] < threshold) cubeIndex |= (1 << c);
+						}
+
+						if (cubeIndex == 0 || cubeIndex == 255) continue;
+
+						int cellId = 3 * (j * m_Z + k);
+
+						const int *cubeTris = getCubeTriangles(cubeIndex);
+
+						for (int t = 0; cubeTris[t] != -1; t += 3)
+						{
+							int v0 = cubePlanes[cubeEdgePlanes[cubeTris[t]]][cellId + cubeEdgeOffsets[cubeTris[t]]];
+							int v1 = cubePlanes[cubeEdgePlanes[cubeTris[t + 1]]][cellId + cubeEdgeOffsets[cubeTris[t + 1]]];
+							int v2 = cubePlanes[cubeEdgePlanes[cubeTris[t + 2]]][cellId + cubeEdgeOffsets[cubeTris[t + 2]]];
+
+							// table winding faces the inside, reversed so the normals point to the higher field values
+							rConnects.push_back(v0);
+							rConnects.push_back((invertMesh) ? v1 : v2);
+							rConnects.push_back((invertMesh) ? v2 : v1);
+						}
+					}
+				}
+
+				swap(planeVertices, nextPlaneVertices);
+			}
+		});
+
+		zIntArray connectOffset(numRanges, 0);
+		int numConnects = 0;
+
+		for (int r = 0; r < numRanges; r++)
+		{
+			connectOffset[r] = numConnects;
+			numConnects += rangeConnects[r].size();
+		}
+
+		zIntArray polyConnects(numConnects);
+		zIntArray polyCounts(numConnects / 3, 3);
+
+		zUtilsParallel::forEach(0, numRanges, [&](int r)
+		{
+			std::copy(rangeConnects[r].begin(), rangeConnects[r].end(), polyConnects.begin() + connectOffset[r]);
+		});
+
+		tempFn.create(positions, polyCounts, polyConnects);
+	}
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::getIsosurface(zObjMesh &coutourMeshObj, float inThreshold, bool invertMesh)
+	{
+		getIsosurface(coutourMeshObj, fieldObj->field.minBB, fieldObj->field.maxBB, inThreshold, invertMesh);
+	}
+
+	//----  UPDATE METHODS
+
+	//---- zScalar specilization for updateColors
+
+	template<>
+	ZSPACE_INLINE void zFnPointField<zScalar>::updateColors()
+	{
+
+		vector<float> scalars;
+		getFieldValues(scalars);
+
+		computeDomain(scalars, contourValueDomain);
+
+		//convert to HSV
+
+		if (contourValueDomain.min == contourValueDomain.max)
+		{
+			zColor col(0.5, 0.5, 0.5);
+
+			fnPoints.setVertexColor(col);
+
+			return;
+		}
+
+		else
+		{
+			fieldColorDomain.min.toHSV(); fieldColorDomain.max.toHSV();
+
+			zColor* cols = fnPoints.getRawVertexColors();
+
+			for (int i = 0; i < scalars.size(); i++)
+			{
+
+				//SDFs
+					if (scalars[i] <= 0)
+					{
+						//temp = coreUtils.blendColor(scalars[i], dVal, dCol, zHSV);
+
+						cols[i] = zColor(0, 0.550, 0.950, 1);
+					}
+					else if (scalars[i] > 0)
+					{
+						cols[i] = zColor(0.950, 0, 0.55, 1);
+						//cols[i] = zColor(0.25, 0.25, 0.25, 1) /*dCol.max*/;
+					}
+					else cols[i] = zColor(0.950, 0, 0.55, 1);
+
+				//if (scalars[i] < contourValueDomain.min) cols[i] = fieldColorDomain.min;
+				//else if (scalars[i] > contourValueDomain.max) cols[i] = fieldColorDomain.max;
+				//else
+				//{
+				//	cols[i] = coreUtils.blendColor(scalars[i], contourValueDomain, fieldColorDomain, zHSV);
+				//}
+
+			}
+
+		}
+
+	}
+
+	//---- FIELD FRAME METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::openFieldWriter(zUtilsFieldWriter &writer, string path, zFieldPrecision precision, bool compress, int keyFrameInterval)
+	{
+		zUtilsFieldHeader header;
+		getFieldHeader(header);
+
+		header.precision = precision;
+		header.compression = (compress) ? 1 : 0;
+		header.keyFrameInterval = (keyFrameInterval > 0) ? keyFrameInterval : 1;
+
+		return writer.open(path, header);
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::writeFieldFrame(zUtilsFieldWriter &writer, double time)
+	{
+		const zUtilsFieldHeader &header = writer.getHeader();
+
+		if (!writer.isOpen() || header.numValues != fieldObj->field.fieldValues.size() || header.numComponents != sizeof(T) / sizeof(float))
+		{
+			cout << " error: field does not match the field file writer." << endl;
+			return false;
+		}
+
+		return writer.addFrame((const float*)fieldObj->field.fieldValues.data(), time);
+	}
+
+	//---- zScalar &  zVector specilization for readFieldFrame
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zScalar>::readFieldFrame(zUtilsFieldReader &reader, int frame)
+	{
+		if (!readFieldValues(reader, frame)) return false;
+
+		updateColors();
+		return true;
+	}
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zVector>::readFieldFrame(zUtilsFieldReader &reader, int frame)
+	{
+		return readFieldValues(reader, frame);
+	}
+
+	//---- DATABASE METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::to(zDatabase &database, string tableName, int64_t id)
+	{
+		zUtilsFieldHeader header;
+		getFieldHeader(header);
+
+		memcpy(header.magic, "ZFLD", 4);
+		header.version = 1;
+		header.byteOrder = 0x01020304;
+		header.numFrames = 1;
+
+		// values follow the header, as stored in memory
+		vector<unsigned char> data(sizeof(header) + header.numValues * sizeof(T));
+		memcpy(data.data(), &header, sizeof(header));
+		if (header.numValues > 0) memcpy(data.data() + sizeof(header), fieldObj->field.fieldValues.data(), header.numValues * sizeof(T));
+
+		zPoint minBB(header.minBB[0], header.minBB[1], header.minBB[2]);
+		zPoint maxBB(header.maxBB[0], header.maxBB[1], header.maxBB[2]);
+
+		if (!database.geometryTableCreate(tableName)) return false;
+
+		if (!database.geometryInsert(tableName, id, zFIELD, minBB, maxBB, data.data(), data.size()))
+		{
+			cout << " error in writing geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::getFieldValues(zDatabase &database, string tableName, int64_t id, int startIndex, int numValues, vector<T> &values)
+	{
+		zUtilsFieldHeader header;
+
+		bool valid = database.geometryRead(tableName, id, 0, &header, sizeof(header));
+		valid = valid && memcmp(header.magic, "ZFLD", 4) == 0 && header.byteOrder == 0x01020304 && header.precision == zFieldFloat32;
+		valid = valid && header.numComponents == sizeof(T) / sizeof(float);
+		valid = valid && startIndex >= 0 && numValues >= 0 && (uint64_t)startIndex + numValues <= header.numValues;
+
+		if (!valid)
+		{
+			cout << " error in reading geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
+		}
+
+		values.resize(numValues);
+		if (numValues == 0) return true;
+
+		return database.geometryRead(tableName, id, sizeof(header) + (int64_t)startIndex * sizeof(T), values.data(), (int64_t)numValues * sizeof(T));
+	}
+
+	//---- zScalar &  zVector specilization for from database
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zScalar>::from(zDatabase &database, string tableName, int64_t id)
+	{
+		if (!readFieldValues(database, tableName, id)) return false;
+
+		updateColors();
+		return true;
+	}
+
+	template<>
+	ZSPACE_INLINE bool zFnPointField<zVector>::from(zDatabase &database, string tableName, int64_t id)
+	{
+		return readFieldValues(database, tableName, id);
+	}
+
+	//----  PROTECTED METHODS
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::readFieldValues(zUtilsFieldReader &reader, int frame)
+	{
+		if (!reader.isOpen() || frame < 0 || frame >= reader.numFrames()) return false;
+
+		if (!setFieldHeader(reader.getHeader())) return false;
+
+		return reader.getFrame(frame, (float*)fieldObj->field.fieldValues.data());
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::getFieldHeader(zUtilsFieldHeader &header)
+	{
+		static_assert(sizeof(zVector) == 3 * sizeof(float), "zVector is expected to be three packed floats.");
+
+		memset(&header, 0, sizeof(header));
+
+		header.numComponents = sizeof(T) / sizeof(float);
+		header.precision = zFieldFloat32;
+
+		header.n_X = fieldObj->field.n_X;
+		header.n_Y = fieldObj->field.n_Y;
+		header.n_Z = fieldObj->field.n_Z;
+
+		header.unit_X = fieldObj->field.unit_X;
+		header.unit_Y = fieldObj->field.unit_Y;
+		header.unit_Z = fieldObj->field.unit_Z;
+
+		zPoint minBB, maxBB;
+		getBounds(minBB, maxBB);
+
+		header.minBB[0] = minBB.x; header.minBB[1] = minBB.y; header.minBB[2] = minBB.z;
+		header.maxBB[0] = maxBB.x; header.maxBB[1] = maxBB.y; header.maxBB[2] = maxBB.z;
+
+		header.numValues = fieldObj->field.fieldValues.size();
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::setFieldHeader(const zUtilsFieldHeader &header)
+	{
+		if (header.numComponents != sizeof(T) / sizeof(float))
+		{
+			cout << " error: zFIELD data is not a " << ((sizeof(T) == sizeof(float)) ? "scalar" : "vector") << " field." << endl;
+			return false;
+		}
+
+		if (header.n_X != fieldObj->field.n_X || header.n_Y != fieldObj->field.n_Y || header.n_Z != fieldObj->field.n_Z || header.numValues != fieldObj->field.fieldValues.size())
+		{
+			zPoint minBB(header.minBB[0], header.minBB[1], header.minBB[2]);
+			zPoint maxBB(header.maxBB[0], header.maxBB[1], header.maxBB[2]);
+
+			create(minBB, maxBB, header.n_X, header.n_Y, header.n_Z);
+
+			if (header.numValues != fieldObj->field.fieldValues.size())
+			{
+				cout << " error: zFIELD data values do not match the field resolution." << endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	ZSPACE_INLINE bool zFnPointField<T>::readFieldValues(zDatabase &database, string tableName, int64_t id)
+	{
+		zUtilsFieldHeader header;
+
+		bool valid = database.geometryRead(tableName, id, 0, &header, sizeof(header));
+		valid = valid && memcmp(header.magic, "ZFLD", 4) == 0 && header.byteOrder == 0x01020304 && header.precision == zFieldFloat32;
+
+		if (!valid)
+		{
+			cout << " error in reading geometry  " << tableName.c_str() << " : " << id << endl;
+			return false;
+		}
+
+		if (!setFieldHeader(header)) return false;
+
+		if (header.numValues == 0) return true;
+
+		// straight in to the field values, without a copy of the blob
+		return database.geometryRead(tableName, id, sizeof(header), fieldObj->field.fieldValues.data(), (int64_t)header.numValues * sizeof(T));
+	}
+
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::createPointCloud()
+	{
+		vector<zVector>positions;
+
+		zVector minBB, maxBB;
+		double unit_X, unit_Y, unit_Z;
+		int n_X, n_Y, n_Z;
+
+		getUnitDistances(unit_X, unit_Y, unit_Z);
+		getResolution(n_X, n_Y, n_Z);
+
+		getBoundingBox(minBB, maxBB);
+
+		zVector unitVec = zVector(unit_X, unit_Y, unit_Z);
+		zVector startPt = minBB;
+
+		for (int i = 0; i < n_X; i++)
+		{
+			for (int j = 0; j < n_Y; j++)
+			{
+
+				for (int k = 0; k < n_Z; k++)
+				{
+
+					zVector pos;
+					pos.x = startPt.x + i * unitVec.x;
+					pos.y = startPt.y + j * unitVec.y;
+					pos.z = startPt.z + k * unitVec.z;
+
+					positions.push_back(pos);
+
+			}
+		}
+	}
+
+		fnPoints.create(positions);
+
+		computeKDTree();
+}
+
+
+	//---- PROTECTED IDW METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeFieldValues_IDW(vector<T> &fieldValues, zPoint *inPositions, int numInPositions, T *values, T value, double *influences, double influence, double power, bool closestOnly, double cutoff)
+	{
+		zVector *positions = fnPoints.getRawVertexPositions();
+		int numPositions = fnPoints.numVertices();
+
+		fieldValues.assign(numPositions, T());
+
+		// truncated IDW, only the input positions within the cutoff radius are gathered from the tree
+		zKDTree tree;
+		if (cutoff >= 0) tree.create(zPointArray(inPositions, inPositions + numInPositions));
+
+		// the field points are processed in tiles, so the accumulators of a tile stay in cache while the input positions stream past
+		const int tileSize = 256;
+
+		zUtilsParallel::forRange(0, numPositions, [&](int start, int end, int)
+		{
+			vector<T> d(tileSize);
+			zDoubleArray wSum(tileSize);
+			zDoubleArray tempDist(tileSize);
+
+			zIntArray neighbours;
+			zDoubleArray distancesSquared;
+
+			for (int tileStart = start; tileStart < end; tileStart += tileSize)
+			{
+				int tileEnd = (std::min)(tileStart + tileSize, end);
+
+				std::fill(d.begin(), d.end(), T());
+				std::fill(wSum.begin(), wSum.end(), 0.0);
+				std::fill(tempDist.begin(), tempDist.end(), 10000.0);
+
+				// same arithmetic and input order per field point as the serial IDW
+				auto addInput = [&](int i, int j)
+				{
+					int k = i - tileStart;
+					double r = positions[i].distanceTo(inPositions[j]);
+
+					if (closestOnly && r >= tempDist[k]) return;
+
+					double w = (power == 2.0) ? r * r : pow(r, power);
+					wSum[k] += w;
+
+					double val = (w > 0.0) ? ((r * ((influences) ? influences[j] : influence)) / (w)) : 0.0;
+
+					if (closestOnly)
+					{
+						d[k] = ((values) ? values[j] : value) * val;
+						tempDist[k] = r;
+					}
+					else d[k] += (((values) ? values[j] : value) * val);
+				};
+
+				if (cutoff >= 0)
+				{
+					for (int i = tileStart; i < tileEnd; i++)
+					{
+						tree.getInRadius(positions[i], cutoff, neighbours, distancesSquared);
+
+						std::sort(neighbours.begin(), neighbours.end());
+						for (auto &j : neighbours) addInput(i, j);
+					}
+				}
+				else
+				{
+					for (int j = 0; j < numInPositions; j++)
+					{
+						for (int i = tileStart; i < tileEnd; i++) addInput(i, j);
+					}
+				}
+
+				for (int i = tileStart; i < tileEnd; i++)
+				{
+					int k = i - tileStart;
+
+					if (wSum[k] > 0) d[k] /= wSum[k];
+					else d[k] = T();
+
+					fieldValues[i] = d[k];
+				}
+			}
+		}, tileSize);
+	}
 
+	//---- PROTECTED SPARSE FIELD METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeSparseDistances(zSparseField3D<zScalar> &sparseField, zPointArray &inPositions, zIntArray &inPrimitives, int primitiveSize, float offset, double bandWidth)
+	{
+		if (bandWidth <= 0) throw std::invalid_argument(" error: band width needs to be positive.");
+
+		// a narrower band would miss the voxels on either side of the surface
+		double voxelDiagonal = zVector(sparseField.unit_X, sparseField.unit_Y, sparseField.unit_Z).length();
+		bandWidth = (std::max)(bandWidth, voxelDiagonal);
+
+		sparseField.clear();
+		sparseField.background = bandWidth;
+
+		const int B = zSparseField3D<zScalar>::blockSize;
+		const int BV = zSparseField3D<zScalar>::blockVolume;
+
+		int numPrimitives = inPrimitives.size() / primitiveSize;
+		if (numPrimitives == 0) return;
+
+		// angle weighted pseudo normals of the triangle vertices, edges and faces for the sign, and bounding spheres of the triangles
+		zVectorArray faceNormals, edgeNormals, vertexNormals;
+		zPointArray triangleCentres;
+		zDoubleArray triangleRadii;
+
+		if (primitiveSize == 3)
+		{
+			triangleCentres.assign(numPrimitives, zPoint());
+			triangleRadii.assign(numPrimitives, 0.0);
+
+			for (int t = 0; t < numPrimitives; t++)
+			{
+				int *v = &inPrimitives[t * 3];
+
+				triangleCentres[t] = (inPositions[v[0]] + inPositions[v[1]] + inPositions[v[2]]) / 3;
+				for (int j = 0; j < 3; j++) triangleRadii[t] = (std::max)(triangleRadii[t], (double)triangleCentres[t].distanceTo(inPositions[v[j]]));
+			}
+
+			faceNormals.assign(numPrimitives, zVector());
+			edgeNormals.assign(numPrimitives * 3, zVector());
+			vertexNormals.assign(inPositions.size(), zVector());
+
+			unordered_map<int64_t, zVector> edgeSums;
+
+			auto getEdgeKey = [&](int v0, int v1) -> int64_t
+			{
+				return ((int64_t)(std::min)(v0, v1) << 32) | (int64_t)(std::max)(v0, v1);
+			};
+
+			for (int t = 0; t < numPrimitives; t++)
+			{
+				int *v = &inPrimitives[t * 3];
+
+				zVector n = (inPositions[v[1]] - inPositions[v[0]]) ^ (inPositions[v[2]] - inPositions[v[0]]);
+				if (n.length() < EPS) continue;
+
+				n.normalize();
+				faceNormals[t] = n;
+
+				for (int j = 0; j < 3; j++)
+				{
+					zVector e0 = inPositions[v[(j + 1) % 3]] - inPositions[v[j]];
+					zVector e1 = inPositions[v[(j + 2) % 3]] - inPositions[v[j]];
+
+					vertexNormals[v[j]] += n * e0.angle(e1) * DEG_TO_RAD;
+					edgeSums[getEdgeKey(v[j], v[(j + 1) % 3])] += n;
+				}
+			}
+
+			for (int t = 0; t < numPrimitives; t++)
+			{
+				int *v = &inPrimitives[t * 3];
+				for (int j = 0; j < 3; j++) edgeNormals[t * 3 + j] = edgeSums[getEdgeKey(v[j], v[(j + 1) % 3])];
+			}
+		}
+
+		// distance to a primitive, signed for triangles
+		auto getDistance = [&](int prim, zPoint &p) -> double
+		{
+			int *v = &inPrimitives[prim * primitiveSize];
+
+			if (primitiveSize == 1) return p.distanceTo(inPositions[v[0]]);
+
+			if (primitiveSize == 2)
+			{
+				zVector ab = inPositions[v[1]] - inPositions[v[0]];
+				zVector ap = p - inPositions[v[0]];
+
+				double len = ab * ab;
+				double t = (len > 0) ? (std::max)(0.0, (std::min)(1.0, (ap * ab) / len)) : 0.0;
+
+				zPoint closest = inPositions[v[0]] + ab * t;
+				return p.distanceTo(closest);
+			}
+
+			int feature;
+			zPoint closest = getClosestPoint_Triangle(p, inPositions[v[0]], inPositions[v[1]], inPositions[v[2]], feature);
+
+			zVector n;
+			if (feature < 3) n = vertexNormals[v[feature]];
+			else if (feature < 6) n = edgeNormals[prim * 3 + feature - 3];
+			else n = faceNormals[prim];
+
+			zVector d = p - closest;
+			double dist = d.length();
+
+			return ((d * n) < 0) ? -dist : dist;
+		};
+
+		// blocks within reach of each primitive
+		double reach = bandWidth + offset;
+
+		int nb_X, nb_Y, nb_Z;
+		sparseField.getBlockResolution(nb_X, nb_Y, nb_Z);
+
+		zVector blockUnit(sparseField.unit_X * B, sparseField.unit_Y * B, sparseField.unit_Z * B);
+		double blockRadius = 0.5 * (blockUnit - zVector(sparseField.unit_X, sparseField.unit_Y, sparseField.unit_Z)).length();
+
+		// every voxel of an active block is within reach + 2 * blockRadius of a primitive, so the triangles within that distance of the block
+		// are kept as well, for the sign of the voxels beyond the band to come from the global closest triangle
+		double signReach = (primitiveSize == 3) ? reach + 2 * blockRadius : reach;
+
+		int numRanges = zUtilsParallel::getNumRanges(numPrimitives, 64);
+		vector<vector<pair<int64_t, pair<float, int>>>> rangeBlockPrimitives(numRanges);
+
+		zUtilsParallel::forRange(0, numPrimitives, [&](int start, int end, int tid)
+		{
+			vector<pair<int64_t, pair<float, int>>> &blockPrimitives = rangeBlockPrimitives[tid];
+
+			for (int prim = start; prim < end; prim++)
+			{
+				zPoint minP = inPositions[inPrimitives[prim * primitiveSize]];
+				zPoint maxP = minP;
+
+				for (int j = 1; j < primitiveSize; j++)
+				{
+					zPoint &p = inPositions[inPrimitives[prim * primitiveSize + j]];
+
+					minP.x = (std::min)(minP.x, p.x); minP.y = (std::min)(minP.y, p.y); minP.z = (std::min)(minP.z, p.z);
+					maxP.x = (std::max)(maxP.x, p.x); maxP.y = (std::max)(maxP.y, p.y); maxP.z = (std::max)(maxP.z, p.z);
+				}
+
+				int lo[3], hi[3];
+				double minC[3] = { minP.x - signReach - sparseField.minBB.x, minP.y - signReach - sparseField.minBB.y, minP.z - signReach - sparseField.minBB.z };
+				double maxC[3] = { maxP.x + signReach - sparseField.minBB.x, maxP.y + signReach - sparseField.minBB.y, maxP.z + signReach - sparseField.minBB.z };
+				double units[3] = { blockUnit.x, blockUnit.y, blockUnit.z };
+				int nb[3] = { nb_X, nb_Y, nb_Z };
+
+				bool outside = false;
+
+				for (int j = 0; j < 3; j++)
+				{
+					lo[j] = (std::max)(0, (int)floor(minC[j] / units[j]));
+					hi[j] = (std::min)(nb[j] - 1, (int)floor(maxC[j] / units[j]));
+
+					if (lo[j] > hi[j]) outside = true;
+				}
+
+				if (outside) continue;
+
+				for (int bx = lo[0]; bx <= hi[0]; bx++)
+				{
+					for (int by = lo[1]; by <= hi[1]; by++)
+					{
+						for (int bz = lo[2]; bz <= hi[2]; bz++)
+						{
+							// the block is skipped if it lies outside the reach of the primitive, and only used for the sign if it lies outside the band
+							zPoint centre = sparseField.minBB + zVector((bx * B + 0.5 * (B - 1)) * sparseField.unit_X, (by * B + 0.5 * (B - 1)) * sparseField.unit_Y, (bz * B + 0.5 * (B - 1)) * sparseField.unit_Z);
+							double dCentre = abs(getDistance(prim, centre));
+
+							if (dCentre > signReach + blockRadius) continue;
+
+							// the sign only primitives are sorted by their distance to the block centre, after the others
+							float sortDistance = (dCentre > reach + blockRadius) ? dCentre : -1;
+							blockPrimitives.push_back(pair<int64_t, pair<float, int>>(sparseField.getBlockKey(bx, by, bz), pair<float, int>(sortDistance, prim)));
+						}
+					}
+				}
+			}
+		}, 64);
+
+		vector<pair<int64_t, pair<float, int>>> blockPrimitives;
+		for (auto &r : rangeBlockPrimitives) blockPrimitives.insert(blockPrimitives.end(), r.begin(), r.end());
+
+		std::sort(blockPrimitives.begin(), blockPrimitives.end());
+
+		// activate the blocks in key order with at least one primitive within reach, with their primitives in one contiguous range each, the sign only ones last
+		zIntArray primitiveOffsets;
+		zIntArray signOffsets;
+		zIntArray primitiveIds;
+		vector<float> primitiveDistances;
+
+		for (int k = 0; k < (int)blockPrimitives.size(); k++)
+		{
+			int64_t key = blockPrimitives[k].first;
+			bool blockStart = (k == 0 || key != blockPrimitives[k - 1].first);
+
+			if (blockStart && blockPrimitives[k].second.first >= 0)
+			{
+				while (k + 1 < (int)blockPrimitives.size() && blockPrimitives[k + 1].first == key) k++;
+				continue;
+			}
+
+			if (blockStart)
+			{
+				sparseField.blockIndices[key] = sparseField.blockKeys.size();
+				sparseField.blockKeys.push_back(key);
+				primitiveOffsets.push_back(primitiveIds.size());
+				signOffsets.push_back(-1);
+			}
+
+			if (blockPrimitives[k].second.first >= 0 && signOffsets.back() == -1) signOffsets.back() = primitiveIds.size();
+
+			primitiveIds.push_back(blockPrimitives[k].second.second);
+			primitiveDistances.push_back(blockPrimitives[k].second.first);
+		}
+
+		primitiveOffsets.push_back(primitiveIds.size());
+
+		for (int b = 0; b < (int)signOffsets.size(); b++)
+		{
+			if (signOffsets[b] == -1) signOffsets[b] = primitiveOffsets[b + 1];
+		}
+
+		sparseField.blockValues.assign(sparseField.blockKeys.size() * BV, (zScalar)bandWidth);
+
+		zUtilsParallel::forEach(0, sparseField.blockKeys.size(), [&](int b)
+		{
+			int bx, by, bz;
+			sparseField.getBlockCoordinates(sparseField.blockKeys[b], bx, by, bz);
+
+			for (int lx = 0; lx < B && bx * B + lx < sparseField.n_X; lx++)
+			{
+				for (int ly = 0; ly < B && by * B + ly < sparseField.n_Y; ly++)
+				{
+					for (int lz = 0; lz < B && bz * B + lz < sparseField.n_Z; lz++)
+					{
+						zPoint p = sparseField.minBB + zVector((bx * B + lx) * sparseField.unit_X, (by * B + ly) * sparseField.unit_Y, (bz * B + lz) * sparseField.unit_Z);
+
+						double d = std::numeric_limits<double>::max();
+
+						for (int k = primitiveOffsets[b]; k < signOffsets[b]; k++)
+						{
+							double dPrim = getDistance(primitiveIds[k], p);
+							if (abs(dPrim) < abs(d)) d = dPrim;
+						}
+
+						// beyond the band the closest primitive within reach need not be the global closest one, which sets the sign
+						if (abs(d) > reach)
+						{
+							for (int k = signOffsets[b]; k < primitiveOffsets[b + 1]; k++)
+							{
+								// the voxel is within blockRadius of the block centre
+								if (primitiveDistances[k] - blockRadius >= abs(d)) break;
+
+								int prim = primitiveIds[k];
+								if (p.distanceTo(triangleCentres[prim]) - triangleRadii[prim] >= abs(d)) continue;
+
+								double dPrim = getDistance(prim, p);
+								if (abs(dPrim) < abs(d)) d = dPrim;
+							}
+						}
+
+						d -= offset;
+						d = (std::max)(-bandWidth, (std::min)(bandWidth, d));
+
+						sparseField.blockValues[b * BV + (lx * B + ly) * B + lz] = d;
+					}
+				}
+			}
+		}, 4);
+
+		pruneSparseBlocks(sparseField);
+		floodFillSparseSigns(sparseField);
 	}
 
-	//----  PROTECTED METHODS
+	template<typename T>
+	ZSPACE_INLINE zPoint zFnPointField<T>::getClosestPoint_Triangle(zPoint &p, zPoint &t0, zPoint &t1, zPoint &t2, int &feature)
+	{
+		zVector ab = t1 - t0;
+		zVector ac = t2 - t0;
+
+		zVector ap = p - t0;
+		double d1 = ab * ap;
+		double d2 = ac * ap;
+		if (d1 <= 0 && d2 <= 0) { feature = 0; return t0; }
+
+		zVector bp = p - t1;
+		double d3 = ab * bp;
+		double d4 = ac * bp;
+		if (d3 >= 0 && d4 <= d3) { feature = 1; return t1; }
+
+		double vc = d1 * d4 - d3 * d2;
+		if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{
+			feature = 3;
+			return t0 + ab * (d1 / (d1 - d3));
+		}
+
+		zVector cp = p - t2;
+		double d5 = ab * cp;
+		double d6 = ac * cp;
+		if (d6 >= 0 && d5 <= d6) { feature = 2; return t2; }
+
+		double vb = d5 * d2 - d1 * d6;
+		if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{
+			feature = 5;
+			return t0 + ac * (d2 / (d2 - d6));
+		}
+
+		double va = d3 * d6 - d5 * d4;
+		if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+		{
+			feature = 4;
+			return t1 + (t2 - t1) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+		}
+
+		double denom = 1.0 / (va + vb + vc);
+
+		feature = 6;
+		return t0 + ab * (vb * denom) + ac * (vc * denom);
+	}
 
 	template<typename T>
-	ZSPACE_INLINE void zFnPointField<T>::createPointCloud()
+	ZSPACE_INLINE void zFnPointField<T>::pruneSparseBlocks(zSparseField3D<zScalar> &sparseField)
 	{
-		vector<zVector>positions;
+		const int BV = zSparseField3D<zScalar>::blockVolume;
 
-		zVector minBB, maxBB;
-		double unit_X, unit_Y, unit_Z;
-		int n_X, n_Y, n_Z;
+		float band = sparseField.background;
+		int numBlocks = sparseField.numBlocks();
 
-		getUnitDistances(unit_X, unit_Y, unit_Z);
-		getResolution(n_X, n_Y, n_Z);
+		// 1 for blocks entirely outside the band, -1 for blocks entirely inside it, 0 for the others
+		zIntArray blockStates(numBlocks, 0);
 
-		getBoundingBox(minBB, maxBB);
+		zUtilsParallel::forEach(0, numBlocks, [&](int b)
+		{
+			float *values = &sparseField.blockValues[b * BV];
 
-		zVector unitVec = zVector(unit_X, unit_Y, unit_Z);
-		zVector startPt = minBB;
+			bool outside = true, inside = true;
 
-		for (int i = 0; i < n_X; i++)
+			for (int k = 0; k < BV; k++)
+			{
+				if (values[k] < band) outside = false;
+				if (values[k] > -band) inside = false;
+			}
+
+			blockStates[b] = (outside) ? 1 : ((inside) ? -1 : 0);
+		}, 64);
+
+		int numActive = 0;
+
+		for (int b = 0; b < numBlocks; b++)
 		{
-			for (int j = 0; j < n_Y; j++)
+			int64_t key = sparseField.blockKeys[b];
+
+			if (blockStates[b] != 0)
 			{
+				sparseField.blockIndices.erase(key);
+				if (blockStates[b] == -1) sparseField.tileValues[key] = -band;
 
-				for (int k = 0; k < n_Z; k++)
+				continue;
+			}
+
+			if (numActive != b)
+			{
+				std::copy(sparseField.blockValues.begin() + b * BV, sparseField.blockValues.begin() + (b + 1) * BV, sparseField.blockValues.begin() + numActive * BV);
+				sparseField.blockKeys[numActive] = key;
+				sparseField.blockIndices[key] = numActive;
+			}
+
+			numActive++;
+		}
+
+		sparseField.blockKeys.resize(numActive);
+		sparseField.blockValues.resize(numActive * BV);
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::floodFillSparseSigns(zSparseField3D<zScalar> &sparseField)
+	{
+		const int B = zSparseField3D<zScalar>::blockSize;
+		const int BV = zSparseField3D<zScalar>::blockVolume;
+
+		float band = sparseField.background;
+
+		int nb_X, nb_Y, nb_Z;
+		sparseField.getBlockResolution(nb_X, nb_Y, nb_Z);
+
+		// scan lines of blocks along x, starting outside at the minimum bounds
+		int numLines = nb_Y * nb_Z;
+		int numRanges = zUtilsParallel::getNumRanges(numLines, 16);
+
+		vector<vector<int64_t>> rangeInsideKeys(numRanges);
+
+		zUtilsParallel::forRange(0, numLines, [&](int start, int end, int tid)
+		{
+			for (int line = start; line < end; line++)
+			{
+				int by = line / nb_Z;
+				int bz = line % nb_Z;
+
+				// the voxel on the max x face of a block the sign is read from
+				int ly = (std::min)(B / 2, sparseField.n_Y - 1 - by * B);
+				int lz = (std::min)(B / 2, sparseField.n_Z - 1 - bz * B);
+
+				bool inside = false;
+
+				for (int bx = 0; bx < nb_X; bx++)
 				{
+					int64_t key = sparseField.getBlockKey(bx, by, bz);
+					int id = sparseField.getBlockIndex(key);
 
-					zVector pos;
-					pos.x = startPt.x + i * unitVec.x;
-					pos.y = startPt.y + j * unitVec.y;
-					pos.z = startPt.z + k * unitVec.z;
+					if (id != -1)
+					{
+						int lx = (std::min)(B - 1, sparseField.n_X - 1 - bx * B);
+						inside = sparseField.blockValues[id * BV + (lx * B + ly) * B + lz] < 0;
+					}
+					else if (sparseField.tileValues.find(key) != sparseField.tileValues.end())
+					{
+						inside = sparseField.tileValues[key] < 0;
+					}
+					else if (inside) rangeInsideKeys[tid].push_back(key);
+				}
+			}
+		}, 16);
 
-					positions.push_back(pos);
+		for (auto &keys : rangeInsideKeys)
+		{
+			for (auto &key : keys) sparseField.tileValues[key] = -band;
+		}
+	}
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeSparseBoolean(zSparseField3D<zScalar>& field_A, zSparseField3D<zScalar>& field_B, zSparseField3D<zScalar>& field_Result, float(*op)(float, float))
+	{
+		if (field_A.n_X != field_B.n_X || field_A.n_Y != field_B.n_Y || field_A.n_Z != field_B.n_Z) throw std::invalid_argument(" error: resolution of the sparse fields dont match.");
+
+		const int BV = zSparseField3D<zScalar>::blockVolume;
+
+		zSparseField3D<zScalar> out(field_A.minBB, field_A.maxBB, field_A.n_X, field_A.n_Y, field_A.n_Z, op(field_A.background, field_B.background));
+
+		// only the active blocks of either field are combined
+		out.blockKeys = field_A.blockKeys;
+		out.blockKeys.insert(out.blockKeys.end(), field_B.blockKeys.begin(), field_B.blockKeys.end());
+
+		std::sort(out.blockKeys.begin(), out.blockKeys.end());
+		out.blockKeys.erase(std::unique(out.blockKeys.begin(), out.blockKeys.end()), out.blockKeys.end());
+
+		for (int b = 0; b < (int)out.blockKeys.size(); b++) out.blockIndices[out.blockKeys[b]] = b;
+
+		out.blockValues.resize(out.blockKeys.size() * BV);
+
+		zUtilsParallel::forEach(0, out.blockKeys.size(), [&](int b)
+		{
+			int64_t key = out.blockKeys[b];
+
+			int idA = field_A.getBlockIndex(key);
+			int idB = field_B.getBlockIndex(key);
+
+			float tileA = (idA == -1) ? field_A.getTileValue(key) : 0;
+			float tileB = (idB == -1) ? field_B.getTileValue(key) : 0;
+
+			for (int k = 0; k < BV; k++)
+			{
+				float valA = (idA == -1) ? tileA : field_A.blockValues[idA * BV + k];
+				float valB = (idB == -1) ? tileB : field_B.blockValues[idB * BV + k];
+
+				out.blockValues[b * BV + k] = op(valA, valB);
+			}
+		}, 16);
+
+		// tiles of blocks inactive in both fields
+		for (int j = 0; j < 2; j++)
+		{
+			for (auto &tile : ((j == 0) ? field_A.tileValues : field_B.tileValues))
+			{
+				if (out.getBlockIndex(tile.first) != -1) continue;
 
+				float value = op(field_A.getTileValue(tile.first), field_B.getTileValue(tile.first));
+				if (value != out.background) out.tileValues[tile.first] = value;
 			}
 		}
+
+		pruneSparseBlocks(out);
+
+		field_Result = out;
 	}
 
-		fnPoints.create(positions);
+	//---- PROTECTED SMOOTH METHODS
 
-}
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::computeSmoothSlices(const zScalar *inValues, zScalar *outValues, int offsetX, int startX, int endX, double diffuseDamp, zDiffusionType type)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+
+		bool laplacian = (type == zLaplacian);
+		zScalar centreWeight = (laplacian) ? -6 : 1;
+
+		// the adjacent neighbours are the cells of the 3x3x3 block sharing at least one index with the cell, summed in the same order as getNeighbour_Adjacents and clamped at the field boundary
+		auto smoothCell = [&](int x, int y, int z)
+		{
+			int startIdX = (x == 0) ? 0 : -1;
+			int endIdX = (x == n_X - 1) ? 0 : 1;
+
+			int startIdY = (y == 0) ? 0 : -1;
+			int endIdY = (y == n_Y - 1) ? 0 : 1;
+
+			int startIdZ = (z == 0) ? 0 : -1;
+			int endIdZ = (z == n_Z - 1) ? 0 : 1;
+
+			double lapA = 0;
+			int count = 0;
+
+			for (int i = startIdX; i <= endIdX; i++)
+			{
+				for (int j = startIdY; j <= endIdY; j++)
+				{
+					const zScalar *row = inValues + ((x + i - offsetX) * n_Y + (y + j)) * n_Z;
+
+					for (int k = startIdZ; k <= endIdZ; k++)
+					{
+						if (i != 0 && j != 0 && k != 0) continue;
+
+						lapA += (i == 0 && j == 0 && k == 0) ? row[z + k] * centreWeight : row[z + k] * 1;
+						count++;
+					}
+				}
+			}
+
+			int id = ((x - offsetX) * n_Y + y) * n_Z + z;
+
+			if (laplacian) outValues[id] = inValues[id] + (lapA * diffuseDamp);
+			else outValues[id] = lapA / count;
+		};
+
+		for (int x = startX; x < endX; x++)
+		{
+			for (int y = 0; y < n_Y; y++)
+			{
+				smoothCell(x, y, 0);
+				if (n_Z > 1) smoothCell(x, y, n_Z - 1);
 
+				if (x == 0 || x == n_X - 1 || y == 0 || y == n_Y - 1)
+				{
+					for (int z = 1; z < n_Z - 1; z++) smoothCell(x, y, z);
+					continue;
+				}
+
+				// interior of the row, vectorizable along z
+				const zScalar *r00 = inValues + ((x - 1 - offsetX) * n_Y + y - 1) * n_Z;
+				const zScalar *r01 = inValues + ((x - 1 - offsetX) * n_Y + y) * n_Z;
+				const zScalar *r02 = inValues + ((x - 1 - offsetX) * n_Y + y + 1) * n_Z;
+				const zScalar *r10 = inValues + ((x - offsetX) * n_Y + y - 1) * n_Z;
+				const zScalar *r11 = inValues + ((x - offsetX) * n_Y + y) * n_Z;
+				const zScalar *r12 = inValues + ((x - offsetX) * n_Y + y + 1) * n_Z;
+				const zScalar *r20 = inValues + ((x + 1 - offsetX) * n_Y + y - 1) * n_Z;
+				const zScalar *r21 = inValues + ((x + 1 - offsetX) * n_Y + y) * n_Z;
+				const zScalar *r22 = inValues + ((x + 1 - offsetX) * n_Y + y + 1) * n_Z;
+
+				zScalar *out = outValues + ((x - offsetX) * n_Y + y) * n_Z;
+
+				for (int z = 1; z < n_Z - 1; z++)
+				{
+					double lapA = 0;
+					lapA += r00[z];
+					lapA += r01[z - 1]; lapA += r01[z]; lapA += r01[z + 1];
+					lapA += r02[z];
+					lapA += r10[z - 1]; lapA += r10[z]; lapA += r10[z + 1];
+					lapA += r11[z - 1]; lapA += r11[z] * centreWeight; lapA += r11[z + 1];
+					lapA += r12[z - 1]; lapA += r12[z]; lapA += r12[z + 1];
+					lapA += r20[z];
+					lapA += r21[z - 1]; lapA += r21[z]; lapA += r21[z + 1];
+					lapA += r22[z];
+
+					out[z] = (laplacian) ? r11[z] + (lapA * diffuseDamp) : lapA / 19;
+				}
+			}
+		}
+	}
+
+	//---- PROTECTED SAMPLING METHODS
+
+	template<typename T>
+	ZSPACE_INLINE void zFnPointField<T>::getSampleCells_Trilinear(zPoint *samplePositions, int numSamples, int *ids, float *tX, float *tY, float *tZ, char *inBounds)
+	{
+		int n_X = fieldObj->field.n_X;
+		int n_Y = fieldObj->field.n_Y;
+		int n_Z = fieldObj->field.n_Z;
+
+		float minX = fieldObj->field.minBB.x;
+		float minY = fieldObj->field.minBB.y;
+		float minZ = fieldObj->field.minBB.z;
+
+		float invUnitX = 1.0 / fieldObj->field.unit_X;
+		float invUnitY = 1.0 / fieldObj->field.unit_Y;
+		float invUnitZ = 1.0 / fieldObj->field.unit_Z;
+
+		float maxU = n_X - 1;
+		float maxV = n_Y - 1;
+		float maxW = n_Z - 1;
+
+		// lower corner of the cell, one below the last field value so the upper corner exists
+		int maxIdX = (std::max)(n_X - 2, 0);
+		int maxIdY = (std::max)(n_Y - 2, 0);
+		int maxIdZ = (std::max)(n_Z - 2, 0);
+
+		// straight line code per sample, so the loop vectorizes over the samples
+		for (int i = 0; i < numSamples; i++)
+		{
+			float u = (samplePositions[i].x - minX) * invUnitX;
+			float v = (samplePositions[i].y - minY) * invUnitY;
+			float w = (samplePositions[i].z - minZ) * invUnitZ;
+
+			inBounds[i] = (u >= 0 && u <= maxU && v >= 0 && v <= maxV && w >= 0 && w <= maxW) ? 1 : 0;
+
+			u = (std::min)((std::max)(u, 0.0f), maxU);
+			v = (std::min)((std::max)(v, 0.0f), maxV);
+			w = (std::min)((std::max)(w, 0.0f), maxW);
+
+			int idX = (std::min)((int)u, maxIdX);
+			int idY = (std::min)((int)v, maxIdY);
+			int idZ = (std::min)((int)w, maxIdZ);
+
+			tX[i] = (std::min)(u - idX, 1.0f);
+			tY[i] = (std::min)(v - idY, 1.0f);
+			tZ[i] = (std::min)(w - idZ, 1.0f);
+
+			ids[i] = (idX * n_Y + idY) * n_Z + idZ;
+		}
+	}
+
+	template<typename T>
+	ZSPACE_INLINE const int* zFnPointField<T>::getCubeTriangles(int cubeIndex)
+	{
+		// triangle table of http://paulbourke.net/geometry/polygonise/
+		static const int cubeTriangles[256][16] =
+		{
+			{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 8, 3, 9, 8, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, 1, 2, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 2, 10, 0, 2, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{2, 8, 3, 2, 10, 8, 10, 9, 8, -1, -1, -1, -1, -1, -1, -1},
+			{3, 11, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 11, 2, 8, 11, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 9, 0, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 11, 2, 1, 9, 11, 9, 8, 11, -1, -1, -1, -1, -1, -1, -1},
+			{3, 10, 1, 11, 10, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 10, 1, 0, 8, 10, 8, 11, 10, -1, -1, -1, -1, -1, -1, -1},
+			{3, 9, 0, 3, 11, 9, 11, 10, 9, -1, -1, -1, -1, -1, -1, -1},
+			{9, 8, 10, 10, 8, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 3, 0, 7, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 1, 9, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 1, 9, 4, 7, 1, 7, 3, 1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 4, 7, 3, 0, 4, 1, 2, 10, -1, -1, -1, -1, -1, -1, -1},
+			{9, 2, 10, 9, 0, 2, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1},
+			{2, 10, 9, 2, 9, 7, 2, 7, 3, 7, 9, 4, -1, -1, -1, -1},
+			{8, 4, 7, 3, 11, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{11, 4, 7, 11, 2, 4, 2, 0, 4, -1, -1, -1, -1, -1, -1, -1},
+			{9, 0, 1, 8, 4, 7, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
+			{4, 7, 11, 9, 4, 11, 9, 11, 2, 9, 2, 1, -1, -1, -1, -1},
+			{3, 10, 1, 3, 11, 10, 7, 8, 4, -1, -1, -1, -1, -1, -1, -1},
+			{1, 11, 10, 1, 4, 11, 1, 0, 4, 7, 11, 4, -1, -1, -1, -1},
+			{4, 7, 8, 9, 0, 11, 9, 11, 10, 11, 0, 3, -1, -1, -1, -1},
+			{4, 7, 11, 4, 11, 9, 9, 11, 10, -1, -1, -1, -1, -1, -1, -1},
+			{9, 5, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 5, 4, 0, 8, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 5, 4, 1, 5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{8, 5, 4, 8, 3, 5, 3, 1, 5, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, 9, 5, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 0, 8, 1, 2, 10, 4, 9, 5, -1, -1, -1, -1, -1, -1, -1},
+			{5, 2, 10, 5, 4, 2, 4, 0, 2, -1, -1, -1, -1, -1, -1, -1},
+			{2, 10, 5, 3, 2, 5, 3, 5, 4, 3, 4, 8, -1, -1, -1, -1},
+			{9, 5, 4, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 11, 2, 0, 8, 11, 4, 9, 5, -1, -1, -1, -1, -1, -1, -1},
+			{0, 5, 4, 0, 1, 5, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
+			{2, 1, 5, 2, 5, 8, 2, 8, 11, 4, 8, 5, -1, -1, -1, -1},
+			{10, 3, 11, 10, 1, 3, 9, 5, 4, -1, -1, -1, -1, -1, -1, -1},
+			{4, 9, 5, 0, 8, 1, 8, 10, 1, 8, 11, 10, -1, -1, -1, -1},
+			{5, 4, 0, 5, 0, 11, 5, 11, 10, 11, 0, 3, -1, -1, -1, -1},
+			{5, 4, 8, 5, 8, 10, 10, 8, 11, -1, -1, -1, -1, -1, -1, -1},
+			{9, 7, 8, 5, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 3, 0, 9, 5, 3, 5, 7, 3, -1, -1, -1, -1, -1, -1, -1},
+			{0, 7, 8, 0, 1, 7, 1, 5, 7, -1, -1, -1, -1, -1, -1, -1},
+			{1, 5, 3, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 7, 8, 9, 5, 7, 10, 1, 2, -1, -1, -1, -1, -1, -1, -1},
+			{10, 1, 2, 9, 5, 0, 5, 3, 0, 5, 7, 3, -1, -1, -1, -1},
+			{8, 0, 2, 8, 2, 5, 8, 5, 7, 10, 5, 2, -1, -1, -1, -1},
+			{2, 10, 5, 2, 5, 3, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1},
+			{7, 9, 5, 7, 8, 9, 3, 11, 2, -1, -1, -1, -1, -1, -1, -1},
+			{9, 5, 7, 9, 7, 2, 9, 2, 0, 2, 7, 11, -1, -1, -1, -1},
+			{2, 3, 11, 0, 1, 8, 1, 7, 8, 1, 5, 7, -1, -1, -1, -1},
+			{11, 2, 1, 11, 1, 7, 7, 1, 5, -1, -1, -1, -1, -1, -1, -1},
+			{9, 5, 8, 8, 5, 7, 10, 1, 3, 10, 3, 11, -1, -1, -1, -1},
+			{5, 7, 0, 5, 0, 9, 7, 11, 0, 1, 0, 10, 11, 10, 0, -1},
+			{11, 10, 0, 11, 0, 3, 10, 5, 0, 8, 0, 7, 5, 7, 0, -1},
+			{11, 10, 5, 7, 11, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{10, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 0, 1, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 8, 3, 1, 9, 8, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1},
+			{1, 6, 5, 2, 6, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 6, 5, 1, 2, 6, 3, 0, 8, -1, -1, -1, -1, -1, -1, -1},
+			{9, 6, 5, 9, 0, 6, 0, 2, 6, -1, -1, -1, -1, -1, -1, -1},
+			{5, 9, 8, 5, 8, 2, 5, 2, 6, 3, 2, 8, -1, -1, -1, -1},
+			{2, 3, 11, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{11, 0, 8, 11, 2, 0, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1},
+			{0, 1, 9, 2, 3, 11, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1},
+			{5, 10, 6, 1, 9, 2, 9, 11, 2, 9, 8, 11, -1, -1, -1, -1},
+			{6, 3, 11, 6, 5, 3, 5, 1, 3, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 11, 0, 11, 5, 0, 5, 1, 5, 11, 6, -1, -1, -1, -1},
+			{3, 11, 6, 0, 3, 6, 0, 6, 5, 0, 5, 9, -1, -1, -1, -1},
+			{6, 5, 9, 6, 9, 11, 11, 9, 8, -1, -1, -1, -1, -1, -1, -1},
+			{5, 10, 6, 4, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 3, 0, 4, 7, 3, 6, 5, 10, -1, -1, -1, -1, -1, -1, -1},
+			{1, 9, 0, 5, 10, 6, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1},
+			{10, 6, 5, 1, 9, 7, 1, 7, 3, 7, 9, 4, -1, -1, -1, -1},
+			{6, 1, 2, 6, 5, 1, 4, 7, 8, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 5, 5, 2, 6, 3, 0, 4, 3, 4, 7, -1, -1, -1, -1},
+			{8, 4, 7, 9, 0, 5, 0, 6, 5, 0, 2, 6, -1, -1, -1, -1},
+			{7, 3, 9, 7, 9, 4, 3, 2, 9, 5, 9, 6, 2, 6, 9, -1},
+			{3, 11, 2, 7, 8, 4, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1},
+			{5, 10, 6, 4, 7, 2, 4, 2, 0, 2, 7, 11, -1, -1, -1, -1},
+			{0, 1, 9, 4, 7, 8, 2, 3, 11, 5, 10, 6, -1, -1, -1, -1},
+			{9, 2, 1, 9, 11, 2, 9, 4, 11, 7, 11, 4, 5, 10, 6, -1},
+			{8, 4, 7, 3, 11, 5, 3, 5, 1, 5, 11, 6, -1, -1, -1, -1},
+			{5, 1, 11, 5, 11, 6, 1, 0, 11, 7, 11, 4, 0, 4, 11, -1},
+			{0, 5, 9, 0, 6, 5, 0, 3, 6, 11, 6, 3, 8, 4, 7, -1},
+			{6, 5, 9, 6, 9, 11, 4, 7, 9, 7, 11, 9, -1, -1, -1, -1},
+			{10, 4, 9, 6, 4, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 10, 6, 4, 9, 10, 0, 8, 3, -1, -1, -1, -1, -1, -1, -1},
+			{10, 0, 1, 10, 6, 0, 6, 4, 0, -1, -1, -1, -1, -1, -1, -1},
+			{8, 3, 1, 8, 1, 6, 8, 6, 4, 6, 1, 10, -1, -1, -1, -1},
+			{1, 4, 9, 1, 2, 4, 2, 6, 4, -1, -1, -1, -1, -1, -1, -1},
+			{3, 0, 8, 1, 2, 9, 2, 4, 9, 2, 6, 4, -1, -1, -1, -1},
+			{0, 2, 4, 4, 2, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{8, 3, 2, 8, 2, 4, 4, 2, 6, -1, -1, -1, -1, -1, -1, -1},
+			{10, 4, 9, 10, 6, 4, 11, 2, 3, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 2, 2, 8, 11, 4, 9, 10, 4, 10, 6, -1, -1, -1, -1},
+			{3, 11, 2, 0, 1, 6, 0, 6, 4, 6, 1, 10, -1, -1, -1, -1},
+			{6, 4, 1, 6, 1, 10, 4, 8, 1, 2, 1, 11, 8, 11, 1, -1},
+			{9, 6, 4, 9, 3, 6, 9, 1, 3, 11, 6, 3, -1, -1, -1, -1},
+			{8, 11, 1, 8, 1, 0, 11, 6, 1, 9, 1, 4, 6, 4, 1, -1},
+			{3, 11, 6, 3, 6, 0, 0, 6, 4, -1, -1, -1, -1, -1, -1, -1},
+			{6, 4, 8, 11, 6, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{7, 10, 6, 7, 8, 10, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1},
+			{0, 7, 3, 0, 10, 7, 0, 9, 10, 6, 7, 10, -1, -1, -1, -1},
+			{10, 6, 7, 1, 10, 7, 1, 7, 8, 1, 8, 0, -1, -1, -1, -1},
+			{10, 6, 7, 10, 7, 1, 1, 7, 3, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 6, 1, 6, 8, 1, 8, 9, 8, 6, 7, -1, -1, -1, -1},
+			{2, 6, 9, 2, 9, 1, 6, 7, 9, 0, 9, 3, 7, 3, 9, -1},
+			{7, 8, 0, 7, 0, 6, 6, 0, 2, -1, -1, -1, -1, -1, -1, -1},
+			{7, 3, 2, 6, 7, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{2, 3, 11, 10, 6, 8, 10, 8, 9, 8, 6, 7, -1, -1, -1, -1},
+			{2, 0, 7, 2, 7, 11, 0, 9, 7, 6, 7, 10, 9, 10, 7, -1},
+			{1, 8, 0, 1, 7, 8, 1, 10, 7, 6, 7, 10, 2, 3, 11, -1},
+			{11, 2, 1, 11, 1, 7, 10, 6, 1, 6, 7, 1, -1, -1, -1, -1},
+			{8, 9, 6, 8, 6, 7, 9, 1, 6, 11, 6, 3, 1, 3, 6, -1},
+			{0, 9, 1, 11, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{7, 8, 0, 7, 0, 6, 3, 11, 0, 11, 6, 0, -1, -1, -1, -1},
+			{7, 11, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{7, 6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 0, 8, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 1, 9, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{8, 1, 9, 8, 3, 1, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1},
+			{10, 1, 2, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, 3, 0, 8, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+			{2, 9, 0, 2, 10, 9, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+			{6, 11, 7, 2, 10, 3, 10, 8, 3, 10, 9, 8, -1, -1, -1, -1},
+			{7, 2, 3, 6, 2, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{7, 0, 8, 7, 6, 0, 6, 2, 0, -1, -1, -1, -1, -1, -1, -1},
+			{2, 7, 6, 2, 3, 7, 0, 1, 9, -1, -1, -1, -1, -1, -1, -1},
+			{1, 6, 2, 1, 8, 6, 1, 9, 8, 8, 7, 6, -1, -1, -1, -1},
+			{10, 7, 6, 10, 1, 7, 1, 3, 7, -1, -1, -1, -1, -1, -1, -1},
+			{10, 7, 6, 1, 7, 10, 1, 8, 7, 1, 0, 8, -1, -1, -1, -1},
+			{0, 3, 7, 0, 7, 10, 0, 10, 9, 6, 10, 7, -1, -1, -1, -1},
+			{7, 6, 10, 7, 10, 8, 8, 10, 9, -1, -1, -1, -1, -1, -1, -1},
+			{6, 8, 4, 11, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 6, 11, 3, 0, 6, 0, 4, 6, -1, -1, -1, -1, -1, -1, -1},
+			{8, 6, 11, 8, 4, 6, 9, 0, 1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 4, 6, 9, 6, 3, 9, 3, 1, 11, 3, 6, -1, -1, -1, -1},
+			{6, 8, 4, 6, 11, 8, 2, 10, 1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, 3, 0, 11, 0, 6, 11, 0, 4, 6, -1, -1, -1, -1},
+			{4, 11, 8, 4, 6, 11, 0, 2, 9, 2, 10, 9, -1, -1, -1, -1},
+			{10, 9, 3, 10, 3, 2, 9, 4, 3, 11, 3, 6, 4, 6, 3, -1},
+			{8, 2, 3, 8, 4, 2, 4, 6, 2, -1, -1, -1, -1, -1, -1, -1},
+			{0, 4, 2, 4, 6, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 9, 0, 2, 3, 4, 2, 4, 6, 4, 3, 8, -1, -1, -1, -1},
+			{1, 9, 4, 1, 4, 2, 2, 4, 6, -1, -1, -1, -1, -1, -1, -1},
+			{8, 1, 3, 8, 6, 1, 8, 4, 6, 6, 10, 1, -1, -1, -1, -1},
+			{10, 1, 0, 10, 0, 6, 6, 0, 4, -1, -1, -1, -1, -1, -1, -1},
+			{4, 6, 3, 4, 3, 8, 6, 10, 3, 0, 3, 9, 10, 9, 3, -1},
+			{10, 9, 4, 6, 10, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 9, 5, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, 4, 9, 5, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1},
+			{5, 0, 1, 5, 4, 0, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1},
+			{11, 7, 6, 8, 3, 4, 3, 5, 4, 3, 1, 5, -1, -1, -1, -1},
+			{9, 5, 4, 10, 1, 2, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1},
+			{6, 11, 7, 1, 2, 10, 0, 8, 3, 4, 9, 5, -1, -1, -1, -1},
+			{7, 6, 11, 5, 4, 10, 4, 2, 10, 4, 0, 2, -1, -1, -1, -1},
+			{3, 4, 8, 3, 5, 4, 3, 2, 5, 10, 5, 2, 11, 7, 6, -1},
+			{7, 2, 3, 7, 6, 2, 5, 4, 9, -1, -1, -1, -1, -1, -1, -1},
+			{9, 5, 4, 0, 8, 6, 0, 6, 2, 6, 8, 7, -1, -1, -1, -1},
+			{3, 6, 2, 3, 7, 6, 1, 5, 0, 5, 4, 0, -1, -1, -1, -1},
+			{6, 2, 8, 6, 8, 7, 2, 1, 8, 4, 8, 5, 1, 5, 8, -1},
+			{9, 5, 4, 10, 1, 6, 1, 7, 6, 1, 3, 7, -1, -1, -1, -1},
+			{1, 6, 10, 1, 7, 6, 1, 0, 7, 8, 7, 0, 9, 5, 4, -1},
+			{4, 0, 10, 4, 10, 5, 0, 3, 10, 6, 10, 7, 3, 7, 10, -1},
+			{7, 6, 10, 7, 10, 8, 5, 4, 10, 4, 8, 10, -1, -1, -1, -1},
+			{6, 9, 5, 6, 11, 9, 11, 8, 9, -1, -1, -1, -1, -1, -1, -1},
+			{3, 6, 11, 0, 6, 3, 0, 5, 6, 0, 9, 5, -1, -1, -1, -1},
+			{0, 11, 8, 0, 5, 11, 0, 1, 5, 5, 6, 11, -1, -1, -1, -1},
+			{6, 11, 3, 6, 3, 5, 5, 3, 1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 10, 9, 5, 11, 9, 11, 8, 11, 5, 6, -1, -1, -1, -1},
+			{0, 11, 3, 0, 6, 11, 0, 9, 6, 5, 6, 9, 1, 2, 10, -1},
+			{11, 8, 5, 11, 5, 6, 8, 0, 5, 10, 5, 2, 0, 2, 5, -1},
+			{6, 11, 3, 6, 3, 5, 2, 10, 3, 10, 5, 3, -1, -1, -1, -1},
+			{5, 8, 9, 5, 2, 8, 5, 6, 2, 3, 8, 2, -1, -1, -1, -1},
+			{9, 5, 6, 9, 6, 0, 0, 6, 2, -1, -1, -1, -1, -1, -1, -1},
+			{1, 5, 8, 1, 8, 0, 5, 6, 8, 3, 8, 2, 6, 2, 8, -1},
+			{1, 5, 6, 2, 1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 3, 6, 1, 6, 10, 3, 8, 6, 5, 6, 9, 8, 9, 6, -1},
+			{10, 1, 0, 10, 0, 6, 9, 5, 0, 5, 6, 0, -1, -1, -1, -1},
+			{0, 3, 8, 5, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{10, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{11, 5, 10, 7, 5, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{11, 5, 10, 11, 7, 5, 8, 3, 0, -1, -1, -1, -1, -1, -1, -1},
+			{5, 11, 7, 5, 10, 11, 1, 9, 0, -1, -1, -1, -1, -1, -1, -1},
+			{10, 7, 5, 10, 11, 7, 9, 8, 1, 8, 3, 1, -1, -1, -1, -1},
+			{11, 1, 2, 11, 7, 1, 7, 5, 1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, 1, 2, 7, 1, 7, 5, 7, 2, 11, -1, -1, -1, -1},
+			{9, 7, 5, 9, 2, 7, 9, 0, 2, 2, 11, 7, -1, -1, -1, -1},
+			{7, 5, 2, 7, 2, 11, 5, 9, 2, 3, 2, 8, 9, 8, 2, -1},
+			{2, 5, 10, 2, 3, 5, 3, 7, 5, -1, -1, -1, -1, -1, -1, -1},
+			{8, 2, 0, 8, 5, 2, 8, 7, 5, 10, 2, 5, -1, -1, -1, -1},
+			{9, 0, 1, 5, 10, 3, 5, 3, 7, 3, 10, 2, -1, -1, -1, -1},
+			{9, 8, 2, 9, 2, 1, 8, 7, 2, 10, 2, 5, 7, 5, 2, -1},
+			{1, 3, 5, 3, 7, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 7, 0, 7, 1, 1, 7, 5, -1, -1, -1, -1, -1, -1, -1},
+			{9, 0, 3, 9, 3, 5, 5, 3, 7, -1, -1, -1, -1, -1, -1, -1},
+			{9, 8, 7, 5, 9, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{5, 8, 4, 5, 10, 8, 10, 11, 8, -1, -1, -1, -1, -1, -1, -1},
+			{5, 0, 4, 5, 11, 0, 5, 10, 11, 11, 3, 0, -1, -1, -1, -1},
+			{0, 1, 9, 8, 4, 10, 8, 10, 11, 10, 4, 5, -1, -1, -1, -1},
+			{10, 11, 4, 10, 4, 5, 11, 3, 4, 9, 4, 1, 3, 1, 4, -1},
+			{2, 5, 1, 2, 8, 5, 2, 11, 8, 4, 5, 8, -1, -1, -1, -1},
+			{0, 4, 11, 0, 11, 3, 4, 5, 11, 2, 11, 1, 5, 1, 11, -1},
+			{0, 2, 5, 0, 5, 9, 2, 11, 5, 4, 5, 8, 11, 8, 5, -1},
+			{9, 4, 5, 2, 11, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{2, 5, 10, 3, 5, 2, 3, 4, 5, 3, 8, 4, -1, -1, -1, -1},
+			{5, 10, 2, 5, 2, 4, 4, 2, 0, -1, -1, -1, -1, -1, -1, -1},
+			{3, 10, 2, 3, 5, 10, 3, 8, 5, 4, 5, 8, 0, 1, 9, -1},
+			{5, 10, 2, 5, 2, 4, 1, 9, 2, 9, 4, 2, -1, -1, -1, -1},
+			{8, 4, 5, 8, 5, 3, 3, 5, 1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 4, 5, 1, 0, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{8, 4, 5, 8, 5, 3, 9, 0, 5, 0, 3, 5, -1, -1, -1, -1},
+			{9, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 11, 7, 4, 9, 11, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1},
+			{0, 8, 3, 4, 9, 7, 9, 11, 7, 9, 10, 11, -1, -1, -1, -1},
+			{1, 10, 11, 1, 11, 4, 1, 4, 0, 7, 4, 11, -1, -1, -1, -1},
+			{3, 1, 4, 3, 4, 8, 1, 10, 4, 7, 4, 11, 10, 11, 4, -1},
+			{4, 11, 7, 9, 11, 4, 9, 2, 11, 9, 1, 2, -1, -1, -1, -1},
+			{9, 7, 4, 9, 11, 7, 9, 1, 11, 2, 11, 1, 0, 8, 3, -1},
+			{11, 7, 4, 11, 4, 2, 2, 4, 0, -1, -1, -1, -1, -1, -1, -1},
+			{11, 7, 4, 11, 4, 2, 8, 3, 4, 3, 2, 4, -1, -1, -1, -1},
+			{2, 9, 10, 2, 7, 9, 2, 3, 7, 7, 4, 9, -1, -1, -1, -1},
+			{9, 10, 7, 9, 7, 4, 10, 2, 7, 8, 7, 0, 2, 0, 7, -1},
+			{3, 7, 10, 3, 10, 2, 7, 4, 10, 1, 10, 0, 4, 0, 10, -1},
+			{1, 10, 2, 8, 7, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 9, 1, 4, 1, 7, 7, 1, 3, -1, -1, -1, -1, -1, -1, -1},
+			{4, 9, 1, 4, 1, 7, 0, 8, 1, 8, 7, 1, -1, -1, -1, -1},
+			{4, 0, 3, 7, 4, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{4, 8, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{9, 10, 8, 10, 11, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 0, 9, 3, 9, 11, 11, 9, 10, -1, -1, -1, -1, -1, -1, -1},
+			{0, 1, 10, 0, 10, 8, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1},
+			{3, 1, 10, 11, 3, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 2, 11, 1, 11, 9, 9, 11, 8, -1, -1, -1, -1, -1, -1, -1},
+			{3, 0, 9, 3, 9, 11, 1, 2, 9, 2, 11, 9, -1, -1, -1, -1},
+			{0, 2, 11, 8, 0, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{3, 2, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{2, 3, 8, 2, 8, 10, 10, 8, 9, -1, -1, -1, -1, -1, -1, -1},
+			{9, 10, 2, 0, 9, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{2, 3, 8, 2, 8, 10, 0, 1, 8, 1, 10, 8, -1, -1, -1, -1},
+			{1, 10, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{1, 3, 8, 9, 1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 9, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{0, 3, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+			{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}
+		};
+
+		return cubeTriangles[cubeIndex];
+	}
 
 #if defined(ZSPACE_STATIC_LIBRARY)  || defined(ZSPACE_DYNAMIC_LIBRARY)
 	// explicit instantiation
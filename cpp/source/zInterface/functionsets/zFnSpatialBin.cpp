@@ -37,7 +37,16 @@ namespace zSpace
 
 	ZSPACE_INLINE void zFnSpatialBin::clear()
 	{
-		binObj->bins.clear();
+		binObj->binOffsets.clear();
+		binObj->binEntries.clear();
+		binObj->binPositions.clear();
+
+		binObj->binCells.clear();
+		binObj->cellBins.clear();
+
+		objectOffsets.clear();
+		pointBins.clear();
+
 		binObj->field.fieldValues.clear();
 		fnPoints.clear();
 	}
@@ -49,7 +58,13 @@ namespace zSpace
 		binObj->field = zField3D<zScalar>(_minBB, _maxBB, _res, _res, _res);
 
 		// initialise bins
-		binObj->bins.assign(_res*_res*_res, zBin());
+		binObj->sparse = false;
+		binObj->binCells.clear();
+		binObj->cellBins.clear();
+
+		binObj->binOffsets.assign(_res*_res*_res + 1, 0);
+		binObj->binEntries.clear();
+		binObj->binPositions.clear();
 
 		// compute neighbours
 		ringNeighbours.clear();
@@ -71,6 +86,36 @@ namespace zSpace
 
 	}
 
+	ZSPACE_INLINE void zFnSpatialBin::createSparse(double _cellSize)
+	{
+		if (_cellSize <= 0) throw std::invalid_argument(" error: cell size has to be greater than 0.");
+
+		binObj->field = zField3D<zScalar>();
+		binObj->field.unit_X = binObj->field.unit_Y = binObj->field.unit_Z = _cellSize;
+		binObj->field.n_X = binObj->field.n_Y = binObj->field.n_Z = 0;
+		binObj->field.minBB = binObj->field.maxBB = zPoint(0, 0, 0);
+
+		// initialise bins, cells are added with the points
+		binObj->sparse = true;
+		binObj->binCells.clear();
+		binObj->cellBins.clear();
+
+		binObj->binOffsets.assign(1, 0);
+		binObj->binEntries.clear();
+		binObj->binPositions.clear();
+
+		ringNeighbours.clear();
+		adjacentNeighbours.clear();
+
+		objectOffsets.clear();
+		pointBins.clear();
+
+		fnPoints.clear();
+
+		// bin existing objects
+		binNewObjects();
+	}
+
 	//---- GET METHODS
 
 	ZSPACE_INLINE int zFnSpatialBin::numObjects()
@@ -80,13 +125,34 @@ namespace zSpace
 
 	ZSPACE_INLINE int zFnSpatialBin::numBins()
 	{
-		return binObj->bins.size();
+		return (binObj->binOffsets.size() > 0) ? binObj->binOffsets.size() - 1 : 0;
 	}
 
 	ZSPACE_INLINE void zFnSpatialBin::getNeighbourhoodRing(int index, int numRings, zIntArray &ringNeighbours)
 	{
 		ringNeighbours.clear();
 
+		if (binObj->sparse)
+		{
+			if (index < 0 || index >= (int)binObj->binCells.size()) throw std::invalid_argument(" error: index out of bounds.");
+
+			int idX, idY, idZ;
+			getCellIndices(binObj->binCells[index], idX, idY, idZ);
+
+			for (int i = -numRings; i <= numRings; i++)
+			{
+				for (int j = -numRings; j <= numRings; j++)
+				{
+					for (int k = -numRings; k <= numRings; k++)
+					{
+						int newId;
+						if (getIndex(idX + i, idY + j, idZ + k, newId)) ringNeighbours.push_back(newId);
+					}
+				}
+			}
+
+			return;
+		}
 
 		int idX = floor(index / (binObj->field.n_Y * binObj->field.n_Z));
 		int idY = floor((index - (idX *binObj->field.n_Z *binObj->field.n_Y)) / (binObj->field.n_Z));
@@ -146,6 +212,28 @@ namespace zSpace
 		int numRings = 1;
 		//printf("\n working numRings : %i ", numRings);
 
+		if (binObj->sparse)
+		{
+			if (index < 0 || index >= (int)binObj->binCells.size()) throw std::invalid_argument(" error: index out of bounds.");
+
+			int idX, idY, idZ;
+			getCellIndices(binObj->binCells[index], idX, idY, idZ);
+
+			for (int i = -numRings; i <= numRings; i++)
+			{
+				for (int j = -numRings; j <= numRings; j++)
+				{
+					for (int k = -numRings; k <= numRings; k++)
+					{
+						int newId;
+						if ((i == 0 || j == 0 || k == 0) && getIndex(idX + i, idY + j, idZ + k, newId)) adjacentNeighbours.push_back(newId);
+					}
+				}
+			}
+
+			return;
+		}
+
 		int idX = floor(index / (binObj->field.n_Y *binObj->field.n_Z));
 		int idY = floor((index - (idX *binObj->field.n_Z *binObj->field.n_Y)) / (binObj->field.n_Z));
 		int idZ = index % binObj->field.n_Z;
@@ -196,6 +284,14 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zFnSpatialBin::getIndex(int index_X, int index_Y, int index_Z, int &index)
 	{
+		if (binObj->sparse)
+		{
+			auto it = binObj->cellBins.find(getCellKey(index_X, index_Y, index_Z));
+
+			index = (it != binObj->cellBins.end()) ? it->second : -1;
+			return (index != -1);
+		}
+
 		bool out = true;
 
 		if (index_X > (binObj->field.n_X - 1) || index_X <  0 || index_Y >(binObj->field.n_Y - 1) || index_Y < 0 || index_Z >(binObj->field.n_Z - 1) || index_Z < 0) out = false;
@@ -207,6 +303,11 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zFnSpatialBin::getIndex(zPoint &pos, int &index)
 	{
+		if (binObj->sparse)
+		{
+			index = getBinIndex(pos);
+			return (index != -1);
+		}
 
 		int index_X = floor((pos.x - binObj->field.minBB.x) / binObj->field.unit_X);
 		int index_Y = floor((pos.y - binObj->field.minBB.y) / binObj->field.unit_Y);
@@ -220,6 +321,11 @@ namespace zSpace
 
 	ZSPACE_INLINE bool zFnSpatialBin::getIndices(zPoint &pos, int &index_X, int &index_Y, int &index_Z)
 	{
+		if (binObj->sparse)
+		{
+			int index;
+			return getCellIndices(pos, index_X, index_Y, index_Z) && getIndex(index_X, index_Y, index_Z, index);
+		}
 		index_X = floor((pos.x - binObj->field.minBB.x) / binObj->field.unit_X);
 		index_Y = floor((pos.y - binObj->field.minBB.y) / binObj->field.unit_Y);
 		index_Z = floor((pos.z - binObj->field.minBB.z) / binObj->field.unit_Z);
@@ -230,34 +336,555 @@ namespace zSpace
 		return out;
 	}
 
+	ZSPACE_INLINE int zFnSpatialBin::getBinSize(int index)
+	{
+		if (index < 0 || index >= numBins()) throw std::invalid_argument(" error: index out of bounds.");
+
+		return binObj->binOffsets[index + 1] - binObj->binOffsets[index];
+	}
+
+	ZSPACE_INLINE const zIntPair* zFnSpatialBin::getBinEntries(int index, int &numEntries)
+	{
+		numEntries = getBinSize(index);
+		return (numEntries > 0) ? &binObj->binEntries[binObj->binOffsets[index]] : nullptr;
+	}
+
+	ZSPACE_INLINE const zPoint* zFnSpatialBin::getBinPositions(int index, int &numEntries)
+	{
+		numEntries = getBinSize(index);
+		return (numEntries > 0) ? &binObj->binPositions[binObj->binOffsets[index]] : nullptr;
+	}
+
 	//---- METHODS
 
 	ZSPACE_INLINE void zFnSpatialBin::clearBins()
 	{
-		binObj->bins.clear();
+		if (binObj->sparse)
+		{
+			binObj->binCells.clear();
+			binObj->cellBins.clear();
+			binObj->binOffsets.assign(1, 0);
+
+			fnPoints.clear();
+		}
+		else std::fill(binObj->binOffsets.begin(), binObj->binOffsets.end(), 0);
+
+		binObj->binEntries.clear();
+		binObj->binPositions.clear();
+
+		objectOffsets.clear();
+		pointBins.clear();
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::rebuildBins()
+	{
+		clearBins();
+		binNewObjects();
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::updateBins()
+	{
+		// objects changed size, offsets are stale
+		bool resized = (objectOffsets.size() != objectPositions.size() + 1);
+		for (int i = 0; !resized && i < (int)objectPositions.size(); i++) resized = (objectOffsets[i + 1] - objectOffsets[i] != (int)objectPositions[i]->size());
+
+		if (resized)
+		{
+			rebuildBins();
+			return pointBins.size();
+		}
+
+		int numChanged = computePointBins();
+
+		if (numChanged > 0) sortBins();
+		else copyBinPositions();
+
+		return numChanged;
+	}
+
+	//---- QUERY METHODS
+
+	ZSPACE_INLINE bool zFnSpatialBin::getClosest(const zPoint &pos, zBinNeighbour &closest, double maxDistance)
+	{
+		vector<zBinNeighbour> neighbours;
+		double maxDistanceSq = (maxDistance < 0) ? std::numeric_limits<double>::max() : maxDistance * maxDistance;
+
+		closest = zBinNeighbour();
+		if (searchNearest(pos, 1, maxDistanceSq, neighbours) == 0) return false;
+
+		closest = neighbours[0];
+		return true;
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::getClosest(zPointArray &positions, vector<zBinNeighbour> &closest, double maxDistance)
+	{
+		closest.assign(positions.size(), zBinNeighbour());
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			getClosest(positions[i], closest[i], maxDistance);
+		}, 64);
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::getKNearest(const zPoint &pos, int k, vector<zBinNeighbour> &neighbours, double maxDistance)
+	{
+		double maxDistanceSq = (maxDistance < 0) ? std::numeric_limits<double>::max() : maxDistance * maxDistance;
+		return searchNearest(pos, k, maxDistanceSq, neighbours);
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::getKNearest(zPointArray &positions, int k, vector<vector<zBinNeighbour>> &neighbours, double maxDistance)
+	{
+		neighbours.resize(positions.size());
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			getKNearest(positions[i], k, neighbours[i], maxDistance);
+		}, 64);
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::getInRadius(const zPoint &pos, double radius, vector<zBinNeighbour> &neighbours)
+	{
+		neighbours.clear();
+		if (radius < 0) return 0;
+
+		return searchNearest(pos, std::numeric_limits<int>::max(), radius * radius, neighbours);
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::getInRadius(zPointArray &positions, double radius, vector<vector<zBinNeighbour>> &neighbours)
+	{
+		neighbours.resize(positions.size());
+
+		zUtilsParallel::forEach(0, positions.size(), [&](int i)
+		{
+			getInRadius(positions[i], radius, neighbours[i]);
+		}, 64);
 	}
 
 	//---- PROTECTED METHODS
-	   
-	ZSPACE_INLINE void zFnSpatialBin::partitionToBin(zPoint &inPos, int pointId, int objectId)
+
+	ZSPACE_INLINE int64_t zFnSpatialBin::getCellKey(int index_X, int index_Y, int index_Z)
 	{
+		// 21 bits per axis, offset to be positive
+		const int64_t offset = 1 << 20;
+		return ((index_X + offset) << 42) | ((index_Y + offset) << 21) | (index_Z + offset);
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::getCellIndices(int64_t key, int &index_X, int &index_Y, int &index_Z)
+	{
+		const int64_t offset = 1 << 20;
+		const int64_t mask = (1 << 21) - 1;
+
+		index_X = (int)(((key >> 42) & mask) - offset);
+		index_Y = (int)(((key >> 21) & mask) - offset);
+		index_Z = (int)((key & mask) - offset);
+	}
+
+	ZSPACE_INLINE bool zFnSpatialBin::getCellIndices(const zPoint &pos, int &index_X, int &index_Y, int &index_Z)
+	{
+		const double offset = 1 << 20;
+
+		double x = floor(pos.x / binObj->field.unit_X);
+		double y = floor(pos.y / binObj->field.unit_Y);
+		double z = floor(pos.z / binObj->field.unit_Z);
+
+		if (!(x >= -offset && x < offset && y >= -offset && y < offset && z >= -offset && z < offset)) return false;
+
+		index_X = (int)x;
+		index_Y = (int)y;
+		index_Z = (int)z;
+
+		return true;
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::getBinIndex(const zPoint &pos)
+	{
+		if (binObj->sparse)
+		{
+			int index_X, index_Y, index_Z, index;
+			if (!getCellIndices(pos, index_X, index_Y, index_Z)) return -1;
+
+			getIndex(index_X, index_Y, index_Z, index);
+			return index;
+		}
+
+		zField3D<zScalar> &field = binObj->field;
+
+		int index_X = floor((pos.x - field.minBB.x) / field.unit_X);
+		int index_Y = floor((pos.y - field.minBB.y) / field.unit_Y);
+		int index_Z = floor((pos.z - field.minBB.z) / field.unit_Z);
+
+		// points on the max bounds belong to the last bin
+		if (index_X == field.n_X && pos.x <= field.maxBB.x) index_X--;
+		if (index_Y == field.n_Y && pos.y <= field.maxBB.y) index_Y--;
+		if (index_Z == field.n_Z && pos.z <= field.maxBB.z) index_Z--;
 
 		int index;
-		bool check = getIndex(inPos, index);
+		bool check = getIndex(index_X, index_Y, index_Z, index);
+
+		return (check) ? index : -1;
+	}
+
+	ZSPACE_INLINE bool zFnSpatialBin::getQueryCell(const zPoint &pos, int &index_X, int &index_Y, int &index_Z)
+	{
+		if (numBins() == 0) return false;
+
+		if (binObj->sparse) return getCellIndices(pos, index_X, index_Y, index_Z);
+
+		zField3D<zScalar> &field = binObj->field;
+
+		double x = floor((pos.x - field.minBB.x) / field.unit_X);
+		double y = floor((pos.y - field.minBB.y) / field.unit_Y);
+		double z = floor((pos.z - field.minBB.z) / field.unit_Z);
+
+		index_X = (int)(std::min)((std::max)(x, 0.0), (double)(field.n_X - 1));
+		index_Y = (int)(std::min)((std::max)(y, 0.0), (double)(field.n_Y - 1));
+		index_Z = (int)(std::min)((std::max)(z, 0.0), (double)(field.n_Z - 1));
+
+		return true;
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::getMaxRing(int index_X, int index_Y, int index_Z)
+	{
+		zField3D<zScalar> &field = binObj->field;
+
+		int minX = 0, minY = 0, minZ = 0;
+		int maxX = field.n_X - 1, maxY = field.n_Y - 1, maxZ = field.n_Z - 1;
+
+		if (binObj->sparse)
+		{
+			minX = (int)round(field.minBB.x / field.unit_X);
+			minY = (int)round(field.minBB.y / field.unit_Y);
+			minZ = (int)round(field.minBB.z / field.unit_Z);
 
-		if (check)
+			maxX = (int)round(field.maxBB.x / field.unit_X) - 1;
+			maxY = (int)round(field.maxBB.y / field.unit_Y) - 1;
+			maxZ = (int)round(field.maxBB.z / field.unit_Z) - 1;
+		}
+
+		int out = (std::max)(abs(index_X - minX), abs(index_X - maxX));
+		out = (std::max)(out, (std::max)(abs(index_Y - minY), abs(index_Y - maxY)));
+		out = (std::max)(out, (std::max)(abs(index_Z - minZ), abs(index_Z - maxZ)));
+
+		return out;
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::getShellBins(int index_X, int index_Y, int index_Z, int ring, zIntArray &shellBins)
+	{
+		shellBins.clear();
+
+		for (int i = -ring; i <= ring; i++)
+		{
+			for (int j = -ring; j <= ring; j++)
+			{
+				// inside the shell only the two cells on the z faces
+				bool onShell = (abs(i) == ring || abs(j) == ring);
+				int stepZ = (onShell || ring == 0) ? 1 : 2 * ring;
+
+				for (int k = -ring; k <= ring; k += stepZ)
+				{
+					int newId;
+					if (getIndex(index_X + i, index_Y + j, index_Z + k, newId)) shellBins.push_back(newId);
+				}
+			}
+		}
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::addNearest(int index, const zPoint &pos, int k, double maxDistanceSq, vector<zBinNeighbour> &heap)
+	{
+		int start = binObj->binOffsets[index];
+		int end = binObj->binOffsets[index + 1];
+
+		const zPoint* positions = binObj->binPositions.data();
+		const zIntPair* entries = binObj->binEntries.data();
+
+		for (int i = start; i < end; i++)
+		{
+			double dx = positions[i].x - pos.x;
+			double dy = positions[i].y - pos.y;
+			double dz = positions[i].z - pos.z;
+
+			zBinNeighbour candidate;
+			candidate.distanceSquared = dx * dx + dy * dy + dz * dz;
+
+			if (candidate.distanceSquared > maxDistanceSq) continue;
+
+			candidate.objectId = entries[i].first;
+			candidate.vertexId = entries[i].second;
+
+			if ((int)heap.size() < k)
+			{
+				heap.push_back(candidate);
+				std::push_heap(heap.begin(), heap.end());
+			}
+			else if (candidate < heap.front())
+			{
+				std::pop_heap(heap.begin(), heap.end());
+				heap.back() = candidate;
+				std::push_heap(heap.begin(), heap.end());
+			}
+		}
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::searchNearest(const zPoint &pos, int k, double maxDistanceSq, vector<zBinNeighbour> &neighbours)
+	{
+		neighbours.clear();
+		if (k <= 0) return 0;
+
+		int index_X, index_Y, index_Z;
+		if (!getQueryCell(pos, index_X, index_Y, index_Z)) return 0;
+
+		zField3D<zScalar> &field = binObj->field;
+		double minUnit = (std::min)(field.unit_X, (std::min)(field.unit_Y, field.unit_Z));
+
+		int maxRing = getMaxRing(index_X, index_Y, index_Z);
+		zIntArray shellBins;
+
+		for (int ring = 0; ring <= maxRing; ring++)
 		{
-			if (objectId >= objects.size()) throw std::invalid_argument(" error: object index out of bounds.");
+			// the points of this ring and beyond are at least ring - 1 cells away
+			if (ring > 1)
+			{
+				double boundSq = (ring - 1) * minUnit * (ring - 1) * minUnit;
+
+				if (boundSq > maxDistanceSq) break;
+				if ((int)neighbours.size() == k && boundSq > neighbours.front().distanceSquared) break;
+			}
+
+			// sparse shells larger than the number of cells, check the remaining cells directly
+			if (binObj->sparse && (double)(2 * ring + 1) * (2 * ring + 1) * (2 * ring + 1) > numBins())
+			{
+				for (int i = 0; i < numBins(); i++)
+				{
+					int x, y, z;
+					getCellIndices(binObj->binCells[i], x, y, z);
+
+					int cellRing = (std::max)(abs(x - index_X), (std::max)(abs(y - index_Y), abs(z - index_Z)));
+					if (cellRing >= ring) addNearest(i, pos, k, maxDistanceSq, neighbours);
+				}
+
+				break;
+			}
 
-			else binObj->bins[index].addVertexIndex(pointId, objectId);
+			getShellBins(index_X, index_Y, index_Z, ring, shellBins);
+			for (auto &b : shellBins) addNearest(b, pos, k, maxDistanceSq, neighbours);
 		}
 
+		std::sort_heap(neighbours.begin(), neighbours.end());
+
+		return neighbours.size();
+	}
+
+	ZSPACE_INLINE int zFnSpatialBin::computePointBins(int startObject)
+	{
+		int numChanged = 0;
+		int numCells = binObj->binCells.size();
+
+		for (int i = startObject; i < (int)objectPositions.size(); i++)
+		{
+			zPoint* positions = objectPositions[i]->data();
+			int* bins = pointBins.data() + objectOffsets[i];
+
+			int numPoints = objectOffsets[i + 1] - objectOffsets[i];
+			int numPointRanges = zUtilsParallel::getNumRanges(numPoints, 1024);
+
+			zIntArray rangeChanged(numPointRanges, 0);
+			zIntArray rangeMissing(numPointRanges, 0);
+
+			zUtilsParallel::forRange(0, numPoints, [&](int start, int end, int tid)
+			{
+				int count = 0;
+				int missing = 0;
+
+				for (int j = start; j < end; j++)
+				{
+					int index = getBinIndex(positions[j]);
+
+					// sparse cell which does not exist yet, created below
+					int index_X, index_Y, index_Z;
+					if (index == -1 && binObj->sparse && getCellIndices(positions[j], index_X, index_Y, index_Z))
+					{
+						index = -2;
+						missing++;
+					}
+
+					if (index != bins[j]) count++;
+
+					bins[j] = index;
+				}
+
+				rangeChanged[tid] += count;
+				rangeMissing[tid] += missing;
+			}, 1024);
+
+			int numMissing = 0;
+			for (int j = 0; j < numPointRanges; j++)
+			{
+				numChanged += rangeChanged[j];
+				numMissing += rangeMissing[j];
+			}
+
+			if (numMissing == 0) continue;
+
+			for (int j = 0; j < numPoints; j++)
+			{
+				if (bins[j] != -2) continue;
+
+				int index_X, index_Y, index_Z;
+				getCellIndices(positions[j], index_X, index_Y, index_Z);
+
+				int64_t key = getCellKey(index_X, index_Y, index_Z);
+				auto it = binObj->cellBins.find(key);
+
+				if (it == binObj->cellBins.end())
+				{
+					it = binObj->cellBins.insert(make_pair(key, (int)binObj->binCells.size())).first;
+					binObj->binCells.push_back(key);
+
+					// grow the bounds to the new cell
+					zPoint cellMin(index_X * binObj->field.unit_X, index_Y * binObj->field.unit_Y, index_Z * binObj->field.unit_Z);
+					zPoint cellMax = cellMin + zVector(binObj->field.unit_X, binObj->field.unit_Y, binObj->field.unit_Z);
+
+					if (binObj->binCells.size() == 1)
+					{
+						binObj->field.minBB = cellMin;
+						binObj->field.maxBB = cellMax;
+					}
+					else
+					{
+						binObj->field.minBB = zPoint((std::min)(binObj->field.minBB.x, cellMin.x), (std::min)(binObj->field.minBB.y, cellMin.y), (std::min)(binObj->field.minBB.z, cellMin.z));
+						binObj->field.maxBB = zPoint((std::max)(binObj->field.maxBB.x, cellMax.x), (std::max)(binObj->field.maxBB.y, cellMax.y), (std::max)(binObj->field.maxBB.z, cellMax.z));
+					}
+				}
+
+				bins[j] = it->second;
+			}
+		}
+
+		if ((int)binObj->binCells.size() != numCells)
+		{
+			binObj->binOffsets.resize(binObj->binCells.size() + 1);
+			createPointCloud();
+		}
+
+		return numChanged;
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::binNewObjects()
+	{
+		if (objectOffsets.size() == 0) objectOffsets.push_back(0);
+
+		int startObject = objectOffsets.size() - 1;
+		for (int i = startObject; i < (int)objectPositions.size(); i++) objectOffsets.push_back(objectOffsets.back() + objectPositions[i]->size());
+
+		pointBins.resize(objectOffsets.back(), -1);
+
+		computePointBins(startObject);
+		sortBins();
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::sortBins()
+	{
+		int nBins = numBins();
+		int numPoints = pointBins.size();
+
+		int grain = 4096;
+		int numRanges = zUtilsParallel::getNumRanges(numPoints, grain);
+
+		zIntArray &binOffsets = binObj->binOffsets;
+		std::fill(binOffsets.begin(), binOffsets.end(), 0);
+
+		if (numRanges == 0 || nBins == 0)
+		{
+			binObj->binEntries.clear();
+			binObj->binPositions.clear();
+			return;
+		}
+
+		// count per range and bin
+		vector<zIntArray> counts(numRanges);
+
+		zUtilsParallel::forRange(0, numPoints, [&](int start, int end, int tid)
+		{
+			zIntArray &count = counts[tid];
+			count.assign(nBins, 0);
+
+			for (int i = start; i < end; i++)
+			{
+				if (pointBins[i] >= 0) count[pointBins[i]]++;
+			}
+		}, grain);
+
+		// exclusive scan in bin then range order, which keeps the points of a bin sorted by object and vertex index
+		int offset = 0;
+		for (int i = 0; i < nBins; i++)
+		{
+			binOffsets[i] = offset;
+
+			for (int j = 0; j < numRanges; j++)
+			{
+				int count = counts[j][i];
+				counts[j][i] = offset;
+				offset += count;
+			}
+		}
+		binOffsets[nBins] = offset;
+
+		// scatter
+		zIntArray sorted(offset);
+
+		zUtilsParallel::forRange(0, numPoints, [&](int start, int end, int tid)
+		{
+			zIntArray &cursor = counts[tid];
+
+			for (int i = start; i < end; i++)
+			{
+				if (pointBins[i] >= 0) sorted[cursor[pointBins[i]]++] = i;
+			}
+		}, grain);
+
+		binObj->binEntries.resize(offset);
+
+		zUtilsParallel::forEach(0, offset, [&](int i)
+		{
+			int objectId = (int)(std::upper_bound(objectOffsets.begin(), objectOffsets.end(), sorted[i]) - objectOffsets.begin()) - 1;
+			binObj->binEntries[i] = zIntPair(objectId, sorted[i] - objectOffsets[objectId]);
+		}, grain);
+
+		copyBinPositions();
+	}
+
+	ZSPACE_INLINE void zFnSpatialBin::copyBinPositions()
+	{
+		vector<zIntPair> &binEntries = binObj->binEntries;
+		binObj->binPositions.resize(binEntries.size());
+
+		zUtilsParallel::forEach(0, binEntries.size(), [&](int i)
+		{
+			binObj->binPositions[i] = (*objectPositions[binEntries[i].first])[binEntries[i].second];
+		}, 4096);
 	}
 
 	ZSPACE_INLINE void zFnSpatialBin::createPointCloud()
 	{
 		vector<zVector>positions;
 
+		if (binObj->sparse)
+		{
+			zVector unitVec = zVector(binObj->field.unit_X, binObj->field.unit_Y, binObj->field.unit_Z);
+
+			// cells are only ever appended, add the points of the new cells
+			for (int i = binObj->pCloud.n_v; i < (int)binObj->binCells.size(); i++)
+			{
+				int index_X, index_Y, index_Z;
+				getCellIndices(binObj->binCells[i], index_X, index_Y, index_Z);
+
+				zVector pos(index_X * unitVec.x, index_Y * unitVec.y, index_Z * unitVec.z);
+				binObj->pCloud.addVertex(pos);
+			}
+
+			return;
+		}
+
 		zVector minBB = binObj->field.minBB;
 		zVector maxBB = binObj->field.maxBB;
 
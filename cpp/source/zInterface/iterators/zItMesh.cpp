@@ -1038,15 +1038,31 @@ namespace zSpace
 		}
 	}
 
-	ZSPACE_INLINE void zItMeshFace::getVertices(zIntArray &vertexIndicies)
+	template<typename T>
+	ZSPACE_INLINE void zItMeshFace::appendVertices(T &vertexIndicies)
 	{
-		zItMeshHalfEdgeArray faceHEdges;
-		getHalfEdges(faceHEdges);
+		if (getHalfEdge().onBoundary()) return;
 
-		for (auto &he : faceHEdges)
+		zItMeshHalfEdge start = getHalfEdge();
+		zItMeshHalfEdge e = getHalfEdge();
+
+		do
 		{
-			vertexIndicies.push_back(he.getSym().getVertex().getId());
-		}
+			vertexIndicies.push_back(e.getSym().getVertex().getId());
+			e = e.getNext();
+
+		} while (e != start);
+	}
+
+	ZSPACE_INLINE void zItMeshFace::getVertices(zIntArray &vertexIndicies)
+	{
+		appendVertices(vertexIndicies);
+	}
+
+	ZSPACE_INLINE void zItMeshFace::getVertices(zScratchIntArray &vertexIndicies)
+	{
+		vertexIndicies.clear();
+		appendVertices(vertexIndicies);
 	}
 
 	ZSPACE_INLINE void zItMeshFace::getVertexPositions(vector<zVector> &vertPositions)
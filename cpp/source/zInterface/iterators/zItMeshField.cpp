@@ -37,7 +37,7 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
 		advance(iter, _index);
 	}
 
@@ -46,27 +46,26 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
-		int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
-
-		int _index = _index_X * fieldObj->field.n_Y + _index_Y;
-
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
-		advance(iter, _index);
+		int _index;
 
 		if (closestIndex)
 		{
-			zPointArray rNeighbourPos;
-			zIntArray rNeighbours;
+			// KD-tree of the field value positions, built by the field function set
+			if (fieldObj->kdTree.numPoints() != (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: field KD-tree not built, call computeKDTree of the field function set.");
 
-			getNeighbourPosition_Ring(1, rNeighbourPos);
-			getNeighbour_Ring(1, rNeighbours);
-
-			int idOut = coreUtils.getClosest_PointCloud(_pos, rNeighbourPos);
+			double distanceSquared;
+			_index = fieldObj->kdTree.getClosest(_pos, distanceSquared);
+		}
+		else
+		{
+			int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
+			int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
 
-			_index = rNeighbours[idOut];
-			advance(iter, _index);
+			_index = _index_X * fieldObj->field.n_Y + _index_Y;
 		}
+
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		advance(iter, _index);
 	}
 
 	ZSPACE_INLINE zItMeshScalarField::zItMeshScalarField(zObjMeshScalarField &_fieldObj, int _index_X, int _index_Y)
@@ -156,7 +155,8 @@ namespace zSpace
 		}
 	}
 
-	ZSPACE_INLINE void zItMeshScalarField::getNeighbour_Ring(int numRings, zIntArray &ringNeighbours)
+	template<typename T>
+	ZSPACE_INLINE void zItMeshScalarField::getNeighbourIds_Ring(int numRings, T &ringNeighbours)
 	{
 		ringNeighbours.clear();
 
@@ -191,6 +191,16 @@ namespace zSpace
 		}
 	}
 
+	ZSPACE_INLINE void zItMeshScalarField::getNeighbour_Ring(int numRings, zIntArray &ringNeighbours)
+	{
+		getNeighbourIds_Ring(numRings, ringNeighbours);
+	}
+
+	ZSPACE_INLINE void zItMeshScalarField::getNeighbour_Ring(int numRings, zScratchIntArray &ringNeighbours)
+	{
+		getNeighbourIds_Ring(numRings, ringNeighbours);
+	}
+
 	ZSPACE_INLINE void zItMeshScalarField::getNeighbourPosition_Ring(int numRings, zPointArray &ringNeighbours)
 	{
 		ringNeighbours.clear();
@@ -383,7 +393,7 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
 		advance(iter, _index);
 	}
 
@@ -392,27 +402,26 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
-		int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
-
-		int _index = _index_X * fieldObj->field.n_Y + _index_Y;
-
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
-		advance(iter, _index);
+		int _index;
 
 		if (closestIndex)
 		{
-			zPointArray rNeighbourPos;
-			zIntArray rNeighbours;
+			// KD-tree of the field value positions, built by the field function set
+			if (fieldObj->kdTree.numPoints() != (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: field KD-tree not built, call computeKDTree of the field function set.");
 
-			getNeighbourPosition_Ring(1, rNeighbourPos);
-			getNeighbour_Ring(1, rNeighbours);
-
-			int idOut = coreUtils.getClosest_PointCloud(_pos, rNeighbourPos);
+			double distanceSquared;
+			_index = fieldObj->kdTree.getClosest(_pos, distanceSquared);
+		}
+		else
+		{
+			int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
+			int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
 
-			_index = rNeighbours[idOut];
-			advance(iter, _index);
+			_index = _index_X * fieldObj->field.n_Y + _index_Y;
 		}
+
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		advance(iter, _index);
 	}
 
 	ZSPACE_INLINE zItMeshVectorField::zItMeshVectorField(zObjMeshVectorField &_fieldObj, int _index_X, int _index_Y)
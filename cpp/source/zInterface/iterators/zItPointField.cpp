@@ -37,7 +37,7 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
 		advance(iter, _index);
 	}
 
@@ -46,28 +46,27 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
-		int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
-		int _index_Z = floor((_pos.z - fieldObj->field.minBB.z) / fieldObj->field.unit_Z);
-
-		int _index = _index_X * (fieldObj->field.n_Y *fieldObj->field.n_Z) + (_index_Y * fieldObj->field.n_Z) + _index_Z;
-
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
-		advance(iter, _index);
+		int _index;
 
 		if (closestIndex)
 		{
-			zPointArray rNeighbourPos;
-			zIntArray rNeighbours;
+			// KD-tree of the field value positions, built by the field function set
+			if (fieldObj->kdTree.numPoints() != (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: field KD-tree not built, call computeKDTree of the field function set.");
 
-			getNeighbourPosition_Ring(1, rNeighbourPos);
-			getNeighbour_Ring(1, rNeighbours);
-
-			int idOut = coreUtils.getClosest_PointCloud(_pos, rNeighbourPos);
+			double distanceSquared;
+			_index = fieldObj->kdTree.getClosest(_pos, distanceSquared);
+		}
+		else
+		{
+			int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
+			int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
+			int _index_Z = floor((_pos.z - fieldObj->field.minBB.z) / fieldObj->field.unit_Z);
 
-			_index = rNeighbours[idOut];
-			advance(iter, _index);
+			_index = _index_X * (fieldObj->field.n_Y *fieldObj->field.n_Z) + (_index_Y * fieldObj->field.n_Z) + _index_Z;
 		}
+
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		advance(iter, _index);
 	}
 
 	ZSPACE_INLINE zItPointScalarField::zItPointScalarField(zObjPointScalarField &_fieldObj, int _index_X, int _index_Y, int _index_Z)
@@ -348,7 +347,7 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
 		advance(iter, _index);
 	}
 
@@ -357,12 +356,25 @@ namespace zSpace
 		fieldObj = &_fieldObj;
 		iter = fieldObj->field.fieldValues.begin();
 
-		int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
-		int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
+		int _index;
 
-		int _index = _index_X * fieldObj->field.n_Y + _index_Y;
+		if (closestIndex)
+		{
+			// KD-tree of the field value positions, built by the field function set
+			if (fieldObj->kdTree.numPoints() != (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: field KD-tree not built, call computeKDTree of the field function set.");
 
-		if (_index < 0 && _index >= fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
+			double distanceSquared;
+			_index = fieldObj->kdTree.getClosest(_pos, distanceSquared);
+		}
+		else
+		{
+			int _index_X = floor((_pos.x - fieldObj->field.minBB.x) / fieldObj->field.unit_X);
+			int _index_Y = floor((_pos.y - fieldObj->field.minBB.y) / fieldObj->field.unit_Y);
+
+			_index = _index_X * fieldObj->field.n_Y + _index_Y;
+		}
+
+		if (_index < 0 || _index >= (int)fieldObj->field.fieldValues.size()) throw std::invalid_argument(" error: index out of bounds");
 		advance(iter, _index);
 	}
 
@@ -28,6 +28,7 @@ namespace zSpace
 #endif
 
 		displayVertices = false;
+		sparse = false;
 	}
 
 	//---- DESTRUCTOR
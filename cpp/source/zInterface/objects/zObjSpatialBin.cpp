@@ -27,6 +27,7 @@ namespace zSpace
 #endif
 
 		displayBounds = false;
+		sparse = false;
 	}
 
 	//---- DESTRUCTOR
@@ -40,6 +41,32 @@ namespace zSpace
 		displayBounds = _displayBounds;
 	}
 
+	//---- GET METHODS
+
+	ZSPACE_INLINE void zObjSpatialBin::getBins(vector<zBin> &bins)
+	{
+		int numBins = (binOffsets.size() > 0) ? (int)binOffsets.size() - 1 : 0;
+
+		bins.clear();
+		bins.assign(numBins, zBin());
+
+		for (int i = 0; i < numBins; i++)
+		{
+			int numObjects = 0;
+
+			for (int j = binOffsets[i]; j < binOffsets[i + 1]; j++)
+			{
+				while (numObjects <= binEntries[j].first)
+				{
+					bins[i].addObject();
+					numObjects++;
+				}
+
+				bins[i].addVertexIndex(binEntries[j].second, binEntries[j].first);
+			}
+		}
+	}
+
 	//---- OVERRIDE METHODS
 
 	ZSPACE_INLINE void zObjSpatialBin::getBounds(zPoint &minBB, zPoint &maxBB)
@@ -84,7 +111,7 @@ namespace zSpace
 			zVector bottom = pCloud.vertexPositions[i];
 			zVector top = pCloud.vertexPositions[i] + unit;
 
-			if (bins[i].contains())
+			if (binOffsets[i + 1] > binOffsets[i])
 			{
 				displayUtils->drawCube(bottom, top, zColor(0, 0, 0, 1));
 			}